@@ -100,6 +100,22 @@ uint32_t Aim_checkRimpConfiguration_result::read(::apache::thrift::protocol::TPr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -122,6 +138,14 @@ uint32_t Aim_checkRimpConfiguration_result::write(::apache::thrift::protocol::TP
     xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->re.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -161,6 +185,22 @@ uint32_t Aim_checkRimpConfiguration_presult::read(::apache::thrift::protocol::TP
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -294,6 +334,22 @@ uint32_t Aim_getDiskFileSize_result::read(::apache::thrift::protocol::TProtocol*
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -320,6 +376,14 @@ uint32_t Aim_getDiskFileSize_result::write(::apache::thrift::protocol::TProtocol
     xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->re.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -367,6 +431,22 @@ uint32_t Aim_getDiskFileSize_presult::read(::apache::thrift::protocol::TProtocol
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -467,14 +547,14 @@ uint32_t Aim_getDatastores_result::read(::apache::thrift::protocol::TProtocol* i
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size39;
-            ::apache::thrift::protocol::TType _etype42;
-            xfer += iprot->readListBegin(_etype42, _size39);
-            this->success.resize(_size39);
-            uint32_t _i43;
-            for (_i43 = 0; _i43 < _size39; ++_i43)
+            uint32_t _size101;
+            ::apache::thrift::protocol::TType _etype104;
+            xfer += iprot->readListBegin(_etype104, _size101);
+            this->success.resize(_size101);
+            uint32_t _i105;
+            for (_i105 = 0; _i105 < _size101; ++_i105)
             {
-              xfer += this->success[_i43].read(iprot);
+              xfer += this->success[_i105].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -491,6 +571,22 @@ uint32_t Aim_getDatastores_result::read(::apache::thrift::protocol::TProtocol* i
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -513,10 +609,10 @@ uint32_t Aim_getDatastores_result::write(::apache::thrift::protocol::TProtocol*
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<Datastore> ::const_iterator _iter44;
-      for (_iter44 = this->success.begin(); _iter44 != this->success.end(); ++_iter44)
+      std::vector<Datastore> ::const_iterator _iter106;
+      for (_iter106 = this->success.begin(); _iter106 != this->success.end(); ++_iter106)
       {
-        xfer += (*_iter44).write(oprot);
+        xfer += (*_iter106).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -525,6 +621,14 @@ uint32_t Aim_getDatastores_result::write(::apache::thrift::protocol::TProtocol*
     xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->re.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -560,14 +664,14 @@ uint32_t Aim_getDatastores_presult::read(::apache::thrift::protocol::TProtocol*
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size45;
-            ::apache::thrift::protocol::TType _etype48;
-            xfer += iprot->readListBegin(_etype48, _size45);
-            (*(this->success)).resize(_size45);
-            uint32_t _i49;
-            for (_i49 = 0; _i49 < _size45; ++_i49)
+            uint32_t _size107;
+            ::apache::thrift::protocol::TType _etype110;
+            xfer += iprot->readListBegin(_etype110, _size107);
+            (*(this->success)).resize(_size107);
+            uint32_t _i111;
+            for (_i111 = 0; _i111 < _size107; ++_i111)
             {
-              xfer += (*(this->success))[_i49].read(iprot);
+              xfer += (*(this->success))[_i111].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -584,6 +688,22 @@ uint32_t Aim_getDatastores_presult::read(::apache::thrift::protocol::TProtocol*
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -684,14 +804,14 @@ uint32_t Aim_getNetInterfaces_result::read(::apache::thrift::protocol::TProtocol
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size50;
-            ::apache::thrift::protocol::TType _etype53;
-            xfer += iprot->readListBegin(_etype53, _size50);
-            this->success.resize(_size50);
-            uint32_t _i54;
-            for (_i54 = 0; _i54 < _size50; ++_i54)
+            uint32_t _size112;
+            ::apache::thrift::protocol::TType _etype115;
+            xfer += iprot->readListBegin(_etype115, _size112);
+            this->success.resize(_size112);
+            uint32_t _i116;
+            for (_i116 = 0; _i116 < _size112; ++_i116)
             {
-              xfer += this->success[_i54].read(iprot);
+              xfer += this->success[_i116].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -708,6 +828,22 @@ uint32_t Aim_getNetInterfaces_result::read(::apache::thrift::protocol::TProtocol
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -730,10 +866,10 @@ uint32_t Aim_getNetInterfaces_result::write(::apache::thrift::protocol::TProtoco
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<NetInterface> ::const_iterator _iter55;
-      for (_iter55 = this->success.begin(); _iter55 != this->success.end(); ++_iter55)
+      std::vector<NetInterface> ::const_iterator _iter117;
+      for (_iter117 = this->success.begin(); _iter117 != this->success.end(); ++_iter117)
       {
-        xfer += (*_iter55).write(oprot);
+        xfer += (*_iter117).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -742,6 +878,14 @@ uint32_t Aim_getNetInterfaces_result::write(::apache::thrift::protocol::TProtoco
     xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->re.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -777,14 +921,14 @@ uint32_t Aim_getNetInterfaces_presult::read(::apache::thrift::protocol::TProtoco
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size56;
-            ::apache::thrift::protocol::TType _etype59;
-            xfer += iprot->readListBegin(_etype59, _size56);
-            (*(this->success)).resize(_size56);
-            uint32_t _i60;
-            for (_i60 = 0; _i60 < _size56; ++_i60)
+            uint32_t _size118;
+            ::apache::thrift::protocol::TType _etype121;
+            xfer += iprot->readListBegin(_etype121, _size118);
+            (*(this->success)).resize(_size118);
+            uint32_t _i122;
+            for (_i122 = 0; _i122 < _size118; ++_i122)
             {
-              xfer += (*(this->success))[_i60].read(iprot);
+              xfer += (*(this->success))[_i122].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -801,6 +945,22 @@ uint32_t Aim_getNetInterfaces_presult::read(::apache::thrift::protocol::TProtoco
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -958,6 +1118,22 @@ uint32_t Aim_copyFromRepositoryToDatastore_result::read(::apache::thrift::protoc
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -980,6 +1156,14 @@ uint32_t Aim_copyFromRepositoryToDatastore_result::write(::apache::thrift::proto
     xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->re.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1019,6 +1203,22 @@ uint32_t Aim_copyFromRepositoryToDatastore_presult::read(::apache::thrift::proto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1160,6 +1360,22 @@ uint32_t Aim_deleteVirtualImageFromDatastore_result::read(::apache::thrift::prot
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1182,6 +1398,14 @@ uint32_t Aim_deleteVirtualImageFromDatastore_result::write(::apache::thrift::pro
     xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->re.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1221,6 +1445,22 @@ uint32_t Aim_deleteVirtualImageFromDatastore_presult::read(::apache::thrift::pro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1394,6 +1634,22 @@ uint32_t Aim_copyFromDatastoreToRepository_result::read(::apache::thrift::protoc
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1416,6 +1672,14 @@ uint32_t Aim_copyFromDatastoreToRepository_result::write(::apache::thrift::proto
     xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->re.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1455,6 +1719,22 @@ uint32_t Aim_copyFromDatastoreToRepository_presult::read(::apache::thrift::proto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1596,6 +1876,22 @@ uint32_t Aim_instanceDisk_result::read(::apache::thrift::protocol::TProtocol* ip
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1618,6 +1914,14 @@ uint32_t Aim_instanceDisk_result::write(::apache::thrift::protocol::TProtocol* o
     xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->re.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1657,6 +1961,22 @@ uint32_t Aim_instanceDisk_presult::read(::apache::thrift::protocol::TProtocol* i
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1798,6 +2118,22 @@ uint32_t Aim_renameDisk_result::read(::apache::thrift::protocol::TProtocol* ipro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1820,6 +2156,14 @@ uint32_t Aim_renameDisk_result::write(::apache::thrift::protocol::TProtocol* opr
     xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->re.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1859,6 +2203,22 @@ uint32_t Aim_renameDisk_presult::read(::apache::thrift::protocol::TProtocol* ipr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -2016,6 +2376,22 @@ uint32_t Aim_createVLAN_result::read(::apache::thrift::protocol::TProtocol* ipro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -2038,6 +2414,14 @@ uint32_t Aim_createVLAN_result::write(::apache::thrift::protocol::TProtocol* opr
     xfer += oprot->writeFieldBegin("ve", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->ve.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -2077,6 +2461,22 @@ uint32_t Aim_createVLAN_presult::read(::apache::thrift::protocol::TProtocol* ipr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -2234,6 +2634,22 @@ uint32_t Aim_deleteVLAN_result::read(::apache::thrift::protocol::TProtocol* ipro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -2256,6 +2672,14 @@ uint32_t Aim_deleteVLAN_result::write(::apache::thrift::protocol::TProtocol* opr
     xfer += oprot->writeFieldBegin("ve", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->ve.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -2295,6 +2719,22 @@ uint32_t Aim_deleteVLAN_presult::read(::apache::thrift::protocol::TProtocol* ipr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -2399,6 +2839,22 @@ uint32_t Aim_checkVLANConfiguration_result::read(::apache::thrift::protocol::TPr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -2421,6 +2877,14 @@ uint32_t Aim_checkVLANConfiguration_result::write(::apache::thrift::protocol::TP
     xfer += oprot->writeFieldBegin("ve", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->ve.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -2460,8 +2924,24 @@ uint32_t Aim_checkVLANConfiguration_presult::read(::apache::thrift::protocol::TP
           xfer += iprot->skip(ftype);
         }
         break;
-      default:
-        xfer += iprot->skip(ftype);
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
         break;
     }
     xfer += iprot->readFieldEnd();
@@ -2572,6 +3052,22 @@ uint32_t Aim_getInitiatorIQN_result::read(::apache::thrift::protocol::TProtocol*
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -2598,6 +3094,14 @@ uint32_t Aim_getInitiatorIQN_result::write(::apache::thrift::protocol::TProtocol
     xfer += oprot->writeFieldBegin("se", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->se.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -2645,6 +3149,22 @@ uint32_t Aim_getInitiatorIQN_presult::read(::apache::thrift::protocol::TProtocol
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -2686,14 +3206,14 @@ uint32_t Aim_rescanISCSI_args::read(::apache::thrift::protocol::TProtocol* iprot
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->targets.clear();
-            uint32_t _size61;
-            ::apache::thrift::protocol::TType _etype64;
-            xfer += iprot->readListBegin(_etype64, _size61);
-            this->targets.resize(_size61);
-            uint32_t _i65;
-            for (_i65 = 0; _i65 < _size61; ++_i65)
+            uint32_t _size123;
+            ::apache::thrift::protocol::TType _etype126;
+            xfer += iprot->readListBegin(_etype126, _size123);
+            this->targets.resize(_size123);
+            uint32_t _i127;
+            for (_i127 = 0; _i127 < _size123; ++_i127)
             {
-              xfer += iprot->readString(this->targets[_i65]);
+              xfer += iprot->readString(this->targets[_i127]);
             }
             xfer += iprot->readListEnd();
           }
@@ -2722,10 +3242,10 @@ uint32_t Aim_rescanISCSI_args::write(::apache::thrift::protocol::TProtocol* opro
   xfer += oprot->writeFieldBegin("targets", ::apache::thrift::protocol::T_LIST, 1);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->targets.size()));
-    std::vector<std::string> ::const_iterator _iter66;
-    for (_iter66 = this->targets.begin(); _iter66 != this->targets.end(); ++_iter66)
+    std::vector<std::string> ::const_iterator _iter128;
+    for (_iter128 = this->targets.begin(); _iter128 != this->targets.end(); ++_iter128)
     {
-      xfer += oprot->writeString((*_iter66));
+      xfer += oprot->writeString((*_iter128));
     }
     xfer += oprot->writeListEnd();
   }
@@ -2750,10 +3270,10 @@ uint32_t Aim_rescanISCSI_pargs::write(::apache::thrift::protocol::TProtocol* opr
   xfer += oprot->writeFieldBegin("targets", ::apache::thrift::protocol::T_LIST, 1);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->targets)).size()));
-    std::vector<std::string> ::const_iterator _iter67;
-    for (_iter67 = (*(this->targets)).begin(); _iter67 != (*(this->targets)).end(); ++_iter67)
+    std::vector<std::string> ::const_iterator _iter129;
+    for (_iter129 = (*(this->targets)).begin(); _iter129 != (*(this->targets)).end(); ++_iter129)
     {
-      xfer += oprot->writeString((*_iter67));
+      xfer += oprot->writeString((*_iter129));
     }
     xfer += oprot->writeListEnd();
   }
@@ -2798,6 +3318,22 @@ uint32_t Aim_rescanISCSI_result::read(::apache::thrift::protocol::TProtocol* ipr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -2820,6 +3356,14 @@ uint32_t Aim_rescanISCSI_result::write(::apache::thrift::protocol::TProtocol* op
     xfer += oprot->writeFieldBegin("se", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->se.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -2859,6 +3403,22 @@ uint32_t Aim_rescanISCSI_presult::read(::apache::thrift::protocol::TProtocol* ip
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -2971,6 +3531,22 @@ uint32_t Aim_getNodeInfo_result::read(::apache::thrift::protocol::TProtocol* ipr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -2997,6 +3573,14 @@ uint32_t Aim_getNodeInfo_result::write(::apache::thrift::protocol::TProtocol* op
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -3044,6 +3628,22 @@ uint32_t Aim_getNodeInfo_presult::read(::apache::thrift::protocol::TProtocol* ip
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3169,6 +3769,22 @@ uint32_t Aim_defineDomain_result::read(::apache::thrift::protocol::TProtocol* ip
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3191,6 +3807,14 @@ uint32_t Aim_defineDomain_result::write(::apache::thrift::protocol::TProtocol* o
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -3230,6 +3854,22 @@ uint32_t Aim_defineDomain_presult::read(::apache::thrift::protocol::TProtocol* i
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3355,6 +3995,22 @@ uint32_t Aim_undefineDomain_result::read(::apache::thrift::protocol::TProtocol*
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3377,6 +4033,14 @@ uint32_t Aim_undefineDomain_result::write(::apache::thrift::protocol::TProtocol*
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -3416,6 +4080,22 @@ uint32_t Aim_undefineDomain_presult::read(::apache::thrift::protocol::TProtocol*
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3541,6 +4221,22 @@ uint32_t Aim_existDomain_result::read(::apache::thrift::protocol::TProtocol* ipr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3563,6 +4259,14 @@ uint32_t Aim_existDomain_result::write(::apache::thrift::protocol::TProtocol* op
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_BOOL, 0);
     xfer += oprot->writeBool(this->success);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -3602,6 +4306,22 @@ uint32_t Aim_existDomain_presult::read(::apache::thrift::protocol::TProtocol* ip
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3721,9 +4441,9 @@ uint32_t Aim_getDomainState_result::read(::apache::thrift::protocol::TProtocol*
     {
       case 0:
         if (ftype == ::apache::thrift::protocol::T_I32) {
-          int32_t ecast68;
-          xfer += iprot->readI32(ecast68);
-          this->success = (DomainState::type)ecast68;
+          int32_t ecast130;
+          xfer += iprot->readI32(ecast130);
+          this->success = (DomainState::type)ecast130;
           this->__isset.success = true;
         } else {
           xfer += iprot->skip(ftype);
@@ -3737,6 +4457,22 @@ uint32_t Aim_getDomainState_result::read(::apache::thrift::protocol::TProtocol*
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3763,6 +4499,14 @@ uint32_t Aim_getDomainState_result::write(::apache::thrift::protocol::TProtocol*
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -3796,9 +4540,9 @@ uint32_t Aim_getDomainState_presult::read(::apache::thrift::protocol::TProtocol*
     {
       case 0:
         if (ftype == ::apache::thrift::protocol::T_I32) {
-          int32_t ecast69;
-          xfer += iprot->readI32(ecast69);
-          (*(this->success)) = (DomainState::type)ecast69;
+          int32_t ecast131;
+          xfer += iprot->readI32(ecast131);
+          (*(this->success)) = (DomainState::type)ecast131;
           this->__isset.success = true;
         } else {
           xfer += iprot->skip(ftype);
@@ -3812,6 +4556,22 @@ uint32_t Aim_getDomainState_presult::read(::apache::thrift::protocol::TProtocol*
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3945,6 +4705,22 @@ uint32_t Aim_getDomainInfo_result::read(::apache::thrift::protocol::TProtocol* i
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -3971,6 +4747,14 @@ uint32_t Aim_getDomainInfo_result::write(::apache::thrift::protocol::TProtocol*
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -4018,6 +4802,22 @@ uint32_t Aim_getDomainInfo_presult::read(::apache::thrift::protocol::TProtocol*
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4118,14 +4918,14 @@ uint32_t Aim_getDomains_result::read(::apache::thrift::protocol::TProtocol* ipro
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size70;
-            ::apache::thrift::protocol::TType _etype73;
-            xfer += iprot->readListBegin(_etype73, _size70);
-            this->success.resize(_size70);
-            uint32_t _i74;
-            for (_i74 = 0; _i74 < _size70; ++_i74)
+            uint32_t _size132;
+            ::apache::thrift::protocol::TType _etype135;
+            xfer += iprot->readListBegin(_etype135, _size132);
+            this->success.resize(_size132);
+            uint32_t _i136;
+            for (_i136 = 0; _i136 < _size132; ++_i136)
             {
-              xfer += this->success[_i74].read(iprot);
+              xfer += this->success[_i136].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -4142,6 +4942,22 @@ uint32_t Aim_getDomains_result::read(::apache::thrift::protocol::TProtocol* ipro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4164,10 +4980,10 @@ uint32_t Aim_getDomains_result::write(::apache::thrift::protocol::TProtocol* opr
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<DomainInfo> ::const_iterator _iter75;
-      for (_iter75 = this->success.begin(); _iter75 != this->success.end(); ++_iter75)
+      std::vector<DomainInfo> ::const_iterator _iter137;
+      for (_iter137 = this->success.begin(); _iter137 != this->success.end(); ++_iter137)
       {
-        xfer += (*_iter75).write(oprot);
+        xfer += (*_iter137).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -4176,6 +4992,14 @@ uint32_t Aim_getDomains_result::write(::apache::thrift::protocol::TProtocol* opr
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -4211,14 +5035,14 @@ uint32_t Aim_getDomains_presult::read(::apache::thrift::protocol::TProtocol* ipr
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size76;
-            ::apache::thrift::protocol::TType _etype79;
-            xfer += iprot->readListBegin(_etype79, _size76);
-            (*(this->success)).resize(_size76);
-            uint32_t _i80;
-            for (_i80 = 0; _i80 < _size76; ++_i80)
+            uint32_t _size138;
+            ::apache::thrift::protocol::TType _etype141;
+            xfer += iprot->readListBegin(_etype141, _size138);
+            (*(this->success)).resize(_size138);
+            uint32_t _i142;
+            for (_i142 = 0; _i142 < _size138; ++_i142)
             {
-              xfer += (*(this->success))[_i80].read(iprot);
+              xfer += (*(this->success))[_i142].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -4235,6 +5059,22 @@ uint32_t Aim_getDomains_presult::read(::apache::thrift::protocol::TProtocol* ipr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4360,6 +5200,22 @@ uint32_t Aim_powerOn_result::read(::apache::thrift::protocol::TProtocol* iprot)
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4382,6 +5238,14 @@ uint32_t Aim_powerOn_result::write(::apache::thrift::protocol::TProtocol* oprot)
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -4421,6 +5285,22 @@ uint32_t Aim_powerOn_presult::read(::apache::thrift::protocol::TProtocol* iprot)
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4546,6 +5426,22 @@ uint32_t Aim_powerOff_result::read(::apache::thrift::protocol::TProtocol* iprot)
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4568,6 +5464,14 @@ uint32_t Aim_powerOff_result::write(::apache::thrift::protocol::TProtocol* oprot
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -4607,6 +5511,22 @@ uint32_t Aim_powerOff_presult::read(::apache::thrift::protocol::TProtocol* iprot
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4732,8 +5652,24 @@ uint32_t Aim_shutdown_result::read(::apache::thrift::protocol::TProtocol* iprot)
           xfer += iprot->skip(ftype);
         }
         break;
-      default:
-        xfer += iprot->skip(ftype);
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
         break;
     }
     xfer += iprot->readFieldEnd();
@@ -4754,6 +5690,14 @@ uint32_t Aim_shutdown_result::write(::apache::thrift::protocol::TProtocol* oprot
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -4793,6 +5737,22 @@ uint32_t Aim_shutdown_presult::read(::apache::thrift::protocol::TProtocol* iprot
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4918,6 +5878,22 @@ uint32_t Aim_reset_result::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4940,6 +5916,14 @@ uint32_t Aim_reset_result::write(::apache::thrift::protocol::TProtocol* oprot) c
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -4979,6 +5963,22 @@ uint32_t Aim_reset_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -5104,6 +6104,22 @@ uint32_t Aim_pause_result::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -5126,6 +6142,14 @@ uint32_t Aim_pause_result::write(::apache::thrift::protocol::TProtocol* oprot) c
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -5165,6 +6189,22 @@ uint32_t Aim_pause_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -5290,6 +6330,22 @@ uint32_t Aim_resume_result::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -5312,6 +6368,14 @@ uint32_t Aim_resume_result::write(::apache::thrift::protocol::TProtocol* oprot)
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -5351,6 +6415,22 @@ uint32_t Aim_resume_presult::read(::apache::thrift::protocol::TProtocol* iprot)
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -5524,6 +6604,22 @@ uint32_t Aim_createISCSIStoragePool_result::read(::apache::thrift::protocol::TPr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -5546,6 +6642,14 @@ uint32_t Aim_createISCSIStoragePool_result::write(::apache::thrift::protocol::TP
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -5585,6 +6689,22 @@ uint32_t Aim_createISCSIStoragePool_presult::read(::apache::thrift::protocol::TP
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -5758,6 +6878,22 @@ uint32_t Aim_createNFSStoragePool_result::read(::apache::thrift::protocol::TProt
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -5780,6 +6916,14 @@ uint32_t Aim_createNFSStoragePool_result::write(::apache::thrift::protocol::TPro
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -5819,6 +6963,22 @@ uint32_t Aim_createNFSStoragePool_presult::read(::apache::thrift::protocol::TPro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -5960,6 +7120,22 @@ uint32_t Aim_createDirStoragePool_result::read(::apache::thrift::protocol::TProt
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -5982,6 +7158,14 @@ uint32_t Aim_createDirStoragePool_result::write(::apache::thrift::protocol::TPro
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -6021,6 +7205,22 @@ uint32_t Aim_createDirStoragePool_presult::read(::apache::thrift::protocol::TPro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -6210,6 +7410,22 @@ uint32_t Aim_createDisk_result::read(::apache::thrift::protocol::TProtocol* ipro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -6232,6 +7448,14 @@ uint32_t Aim_createDisk_result::write(::apache::thrift::protocol::TProtocol* opr
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -6271,6 +7495,22 @@ uint32_t Aim_createDisk_presult::read(::apache::thrift::protocol::TProtocol* ipr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -6412,6 +7652,22 @@ uint32_t Aim_deleteDisk_result::read(::apache::thrift::protocol::TProtocol* ipro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -6434,6 +7690,14 @@ uint32_t Aim_deleteDisk_result::write(::apache::thrift::protocol::TProtocol* opr
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -6473,6 +7737,22 @@ uint32_t Aim_deleteDisk_presult::read(::apache::thrift::protocol::TProtocol* ipr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -6630,6 +7910,22 @@ uint32_t Aim_resizeVol_result::read(::apache::thrift::protocol::TProtocol* iprot
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -6652,6 +7948,14 @@ uint32_t Aim_resizeVol_result::write(::apache::thrift::protocol::TProtocol* opro
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -6691,6 +7995,22 @@ uint32_t Aim_resizeVol_presult::read(::apache::thrift::protocol::TProtocol* ipro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -6848,6 +8168,22 @@ uint32_t Aim_resizeDisk_result::read(::apache::thrift::protocol::TProtocol* ipro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -6870,6 +8206,14 @@ uint32_t Aim_resizeDisk_result::write(::apache::thrift::protocol::TProtocol* opr
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -6909,6 +8253,22 @@ uint32_t Aim_resizeDisk_presult::read(::apache::thrift::protocol::TProtocol* ipr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -7058,6 +8418,22 @@ uint32_t Aim_getDomainBlockInfo_result::read(::apache::thrift::protocol::TProtoc
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -7084,6 +8460,14 @@ uint32_t Aim_getDomainBlockInfo_result::write(::apache::thrift::protocol::TProto
     xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->libvirtException.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -7131,6 +8515,22 @@ uint32_t Aim_getDomainBlockInfo_presult::read(::apache::thrift::protocol::TProto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -7268,14 +8668,14 @@ uint32_t Aim_getDatapoints_result::read(::apache::thrift::protocol::TProtocol* i
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size81;
-            ::apache::thrift::protocol::TType _etype84;
-            xfer += iprot->readListBegin(_etype84, _size81);
-            this->success.resize(_size81);
-            uint32_t _i85;
-            for (_i85 = 0; _i85 < _size81; ++_i85)
+            uint32_t _size143;
+            ::apache::thrift::protocol::TType _etype146;
+            xfer += iprot->readListBegin(_etype146, _size143);
+            this->success.resize(_size143);
+            uint32_t _i147;
+            for (_i147 = 0; _i147 < _size143; ++_i147)
             {
-              xfer += this->success[_i85].read(iprot);
+              xfer += this->success[_i147].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -7284,6 +8684,22 @@ uint32_t Aim_getDatapoints_result::read(::apache::thrift::protocol::TProtocol* i
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -7306,14 +8722,22 @@ uint32_t Aim_getDatapoints_result::write(::apache::thrift::protocol::TProtocol*
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<Measure> ::const_iterator _iter86;
-      for (_iter86 = this->success.begin(); _iter86 != this->success.end(); ++_iter86)
+      std::vector<Measure> ::const_iterator _iter148;
+      for (_iter148 = this->success.begin(); _iter148 != this->success.end(); ++_iter148)
       {
-        xfer += (*_iter86).write(oprot);
+        xfer += (*_iter148).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -7349,14 +8773,14 @@ uint32_t Aim_getDatapoints_presult::read(::apache::thrift::protocol::TProtocol*
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size87;
-            ::apache::thrift::protocol::TType _etype90;
-            xfer += iprot->readListBegin(_etype90, _size87);
-            (*(this->success)).resize(_size87);
-            uint32_t _i91;
-            for (_i91 = 0; _i91 < _size87; ++_i91)
+            uint32_t _size149;
+            ::apache::thrift::protocol::TType _etype152;
+            xfer += iprot->readListBegin(_etype152, _size149);
+            (*(this->success)).resize(_size149);
+            uint32_t _i153;
+            for (_i153 = 0; _i153 < _size149; ++_i153)
             {
-              xfer += (*(this->success))[_i91].read(iprot);
+              xfer += (*(this->success))[_i153].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -7365,6 +8789,22 @@ uint32_t Aim_getDatapoints_presult::read(::apache::thrift::protocol::TProtocol*
           xfer += iprot->skip(ftype);
         }
         break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -7496,7 +8936,28 @@ uint32_t Aim_upload_result::read(::apache::thrift::protocol::TProtocol* iprot) {
     if (ftype == ::apache::thrift::protocol::T_STOP) {
       break;
     }
-    xfer += iprot->skip(ftype);
+    switch (fid)
+    {
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
     xfer += iprot->readFieldEnd();
   }
 
@@ -7511,6 +8972,15 @@ uint32_t Aim_upload_result::write(::apache::thrift::protocol::TProtocol* oprot)
 
   xfer += oprot->writeStructBegin("Aim_upload_result");
 
+  if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -7539,7 +9009,28 @@ uint32_t Aim_upload_presult::read(::apache::thrift::protocol::TProtocol* iprot)
     if (ftype == ::apache::thrift::protocol::T_STOP) {
       break;
     }
-    xfer += iprot->skip(ftype);
+    switch (fid)
+    {
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
     xfer += iprot->readFieldEnd();
   }
 
@@ -7548,194 +9039,8997 @@ uint32_t Aim_upload_presult::read(::apache::thrift::protocol::TProtocol* iprot)
   return xfer;
 }
 
-void AimClient::checkRimpConfiguration()
-{
-  send_checkRimpConfiguration();
-  recv_checkRimpConfiguration();
+
+Aim_getDomainsLite_args::~Aim_getDomainsLite_args() throw() {
 }
 
-void AimClient::send_checkRimpConfiguration()
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("checkRimpConfiguration", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_checkRimpConfiguration_pargs args;
-  args.write(oprot_);
+uint32_t Aim_getDomainsLite_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-void AimClient::recv_checkRimpConfiguration()
-{
+  xfer += iprot->readStructBegin(fname);
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  using ::apache::thrift::protocol::TProtocolException;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("checkRimpConfiguration") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  Aim_checkRimpConfiguration_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.re) {
-    throw result.re;
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    xfer += iprot->skip(ftype);
+    xfer += iprot->readFieldEnd();
   }
-  return;
-}
 
-int64_t AimClient::getDiskFileSize(const std::string& virtualImageDatastorePath)
-{
-  send_getDiskFileSize(virtualImageDatastorePath);
-  return recv_getDiskFileSize();
-}
+  xfer += iprot->readStructEnd();
 
-void AimClient::send_getDiskFileSize(const std::string& virtualImageDatastorePath)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("getDiskFileSize", ::apache::thrift::protocol::T_CALL, cseqid);
+  return xfer;
+}
 
-  Aim_getDiskFileSize_pargs args;
-  args.virtualImageDatastorePath = &virtualImageDatastorePath;
-  args.write(oprot_);
+uint32_t Aim_getDomainsLite_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_getDomainsLite_args");
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
 }
 
-int64_t AimClient::recv_getDiskFileSize()
-{
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+Aim_getDomainsLite_pargs::~Aim_getDomainsLite_pargs() throw() {
+}
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("getDiskFileSize") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  int64_t _return;
-  Aim_getDiskFileSize_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.success) {
-    return _return;
-  }
-  if (result.__isset.re) {
-    throw result.re;
-  }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDiskFileSize failed: unknown result");
-}
+uint32_t Aim_getDomainsLite_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_getDomainsLite_pargs");
 
-void AimClient::getDatastores(std::vector<Datastore> & _return)
-{
-  send_getDatastores();
-  recv_getDatastores(_return);
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
 }
 
-void AimClient::send_getDatastores()
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("getDatastores", ::apache::thrift::protocol::T_CALL, cseqid);
-
-  Aim_getDatastores_pargs args;
-  args.write(oprot_);
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+Aim_getDomainsLite_result::~Aim_getDomainsLite_result() throw() {
 }
 
-void AimClient::recv_getDatastores(std::vector<Datastore> & _return)
-{
 
-  int32_t rseqid = 0;
+uint32_t Aim_getDomainsLite_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
   std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("getDatastores") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  Aim_getDatastores_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  xfer += iprot->readStructBegin(fname);
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
-  }
-  if (result.__isset.re) {
-    throw result.re;
-  }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDatastores failed: unknown result");
-}
+  using ::apache::thrift::protocol::TProtocolException;
 
-void AimClient::getNetInterfaces(std::vector<NetInterface> & _return)
-{
-  send_getNetInterfaces();
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->success.clear();
+            uint32_t _size154;
+            ::apache::thrift::protocol::TType _etype157;
+            xfer += iprot->readListBegin(_etype157, _size154);
+            this->success.resize(_size154);
+            uint32_t _i158;
+            for (_i158 = 0; _i158 < _size154; ++_i158)
+            {
+              xfer += this->success[_i158].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->libvirtException.read(iprot);
+          this->__isset.libvirtException = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_getDomainsLite_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_getDomainsLite_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
+      std::vector<DomainInfo> ::const_iterator _iter159;
+      for (_iter159 = this->success.begin(); _iter159 != this->success.end(); ++_iter159)
+      {
+        xfer += (*_iter159).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.libvirtException) {
+    xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->libvirtException.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_getDomainsLite_presult::~Aim_getDomainsLite_presult() throw() {
+}
+
+
+uint32_t Aim_getDomainsLite_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size160;
+            ::apache::thrift::protocol::TType _etype163;
+            xfer += iprot->readListBegin(_etype163, _size160);
+            (*(this->success)).resize(_size160);
+            uint32_t _i164;
+            for (_i164 = 0; _i164 < _size160; ++_i164)
+            {
+              xfer += (*(this->success))[_i164].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->libvirtException.read(iprot);
+          this->__isset.libvirtException = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_getDomainsWithFields_args::~Aim_getDomainsWithFields_args() throw() {
+}
+
+
+uint32_t Aim_getDomainsWithFields_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast165;
+          xfer += iprot->readI32(ecast165);
+          this->fields = (DomainFields::type)ecast165;
+          this->__isset.fields = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_getDomainsWithFields_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_getDomainsWithFields_args");
+
+  xfer += oprot->writeFieldBegin("fields", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32((int32_t)this->fields);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_getDomainsWithFields_pargs::~Aim_getDomainsWithFields_pargs() throw() {
+}
+
+
+uint32_t Aim_getDomainsWithFields_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_getDomainsWithFields_pargs");
+
+  xfer += oprot->writeFieldBegin("fields", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32((int32_t)(*(this->fields)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_getDomainsWithFields_result::~Aim_getDomainsWithFields_result() throw() {
+}
+
+
+uint32_t Aim_getDomainsWithFields_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->success.clear();
+            uint32_t _size166;
+            ::apache::thrift::protocol::TType _etype169;
+            xfer += iprot->readListBegin(_etype169, _size166);
+            this->success.resize(_size166);
+            uint32_t _i170;
+            for (_i170 = 0; _i170 < _size166; ++_i170)
+            {
+              xfer += this->success[_i170].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->libvirtException.read(iprot);
+          this->__isset.libvirtException = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_getDomainsWithFields_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_getDomainsWithFields_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
+      std::vector<DomainInfo> ::const_iterator _iter171;
+      for (_iter171 = this->success.begin(); _iter171 != this->success.end(); ++_iter171)
+      {
+        xfer += (*_iter171).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.libvirtException) {
+    xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->libvirtException.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_getDomainsWithFields_presult::~Aim_getDomainsWithFields_presult() throw() {
+}
+
+
+uint32_t Aim_getDomainsWithFields_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size172;
+            ::apache::thrift::protocol::TType _etype175;
+            xfer += iprot->readListBegin(_etype175, _size172);
+            (*(this->success)).resize(_size172);
+            uint32_t _i176;
+            for (_i176 = 0; _i176 < _size172; ++_i176)
+            {
+              xfer += (*(this->success))[_i176].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->libvirtException.read(iprot);
+          this->__isset.libvirtException = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_getDomainsChangedSince_args::~Aim_getDomainsChangedSince_args() throw() {
+}
+
+
+uint32_t Aim_getDomainsChangedSince_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->generation);
+          this->__isset.generation = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast177;
+          xfer += iprot->readI32(ecast177);
+          this->fields = (DomainFields::type)ecast177;
+          this->__isset.fields = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_getDomainsChangedSince_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_getDomainsChangedSince_args");
+
+  xfer += oprot->writeFieldBegin("generation", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->generation);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("fields", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32((int32_t)this->fields);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_getDomainsChangedSince_pargs::~Aim_getDomainsChangedSince_pargs() throw() {
+}
+
+
+uint32_t Aim_getDomainsChangedSince_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_getDomainsChangedSince_pargs");
+
+  xfer += oprot->writeFieldBegin("generation", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64((*(this->generation)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("fields", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32((int32_t)(*(this->fields)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_getDomainsChangedSince_result::~Aim_getDomainsChangedSince_result() throw() {
+}
+
+
+uint32_t Aim_getDomainsChangedSince_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->libvirtException.read(iprot);
+          this->__isset.libvirtException = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_getDomainsChangedSince_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_getDomainsChangedSince_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.libvirtException) {
+    xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->libvirtException.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_getDomainsChangedSince_presult::~Aim_getDomainsChangedSince_presult() throw() {
+}
+
+
+uint32_t Aim_getDomainsChangedSince_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->libvirtException.read(iprot);
+          this->__isset.libvirtException = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_waitForEvents_args::~Aim_waitForEvents_args() throw() {
+}
+
+
+uint32_t Aim_waitForEvents_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->sinceId);
+          this->__isset.sinceId = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->timeoutMs);
+          this->__isset.timeoutMs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_waitForEvents_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_waitForEvents_args");
+
+  xfer += oprot->writeFieldBegin("sinceId", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->sinceId);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timeoutMs", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->timeoutMs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_waitForEvents_pargs::~Aim_waitForEvents_pargs() throw() {
+}
+
+
+uint32_t Aim_waitForEvents_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_waitForEvents_pargs");
+
+  xfer += oprot->writeFieldBegin("sinceId", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64((*(this->sinceId)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timeoutMs", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32((*(this->timeoutMs)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_waitForEvents_result::~Aim_waitForEvents_result() throw() {
+}
+
+
+uint32_t Aim_waitForEvents_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_waitForEvents_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_waitForEvents_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_waitForEvents_presult::~Aim_waitForEvents_presult() throw() {
+}
+
+
+uint32_t Aim_waitForEvents_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_startCopyFromRepositoryToDatastore_args::~Aim_startCopyFromRepositoryToDatastore_args() throw() {
+}
+
+
+uint32_t Aim_startCopyFromRepositoryToDatastore_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->virtualImageRepositoryPath);
+          this->__isset.virtualImageRepositoryPath = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->datastorePath);
+          this->__isset.datastorePath = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->virtualMachineUUID);
+          this->__isset.virtualMachineUUID = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_startCopyFromRepositoryToDatastore_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_startCopyFromRepositoryToDatastore_args");
+
+  xfer += oprot->writeFieldBegin("virtualImageRepositoryPath", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->virtualImageRepositoryPath);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("datastorePath", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->datastorePath);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("virtualMachineUUID", ::apache::thrift::protocol::T_STRING, 3);
+  xfer += oprot->writeString(this->virtualMachineUUID);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_startCopyFromRepositoryToDatastore_pargs::~Aim_startCopyFromRepositoryToDatastore_pargs() throw() {
+}
+
+
+uint32_t Aim_startCopyFromRepositoryToDatastore_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_startCopyFromRepositoryToDatastore_pargs");
+
+  xfer += oprot->writeFieldBegin("virtualImageRepositoryPath", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString((*(this->virtualImageRepositoryPath)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("datastorePath", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString((*(this->datastorePath)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("virtualMachineUUID", ::apache::thrift::protocol::T_STRING, 3);
+  xfer += oprot->writeString((*(this->virtualMachineUUID)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_startCopyFromRepositoryToDatastore_result::~Aim_startCopyFromRepositoryToDatastore_result() throw() {
+}
+
+
+uint32_t Aim_startCopyFromRepositoryToDatastore_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->success);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_startCopyFromRepositoryToDatastore_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_startCopyFromRepositoryToDatastore_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRING, 0);
+    xfer += oprot->writeString(this->success);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.re) {
+    xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->re.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_startCopyFromRepositoryToDatastore_presult::~Aim_startCopyFromRepositoryToDatastore_presult() throw() {
+}
+
+
+uint32_t Aim_startCopyFromRepositoryToDatastore_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString((*(this->success)));
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_startCopyFromDatastoreToRepository_args::~Aim_startCopyFromDatastoreToRepository_args() throw() {
+}
+
+
+uint32_t Aim_startCopyFromDatastoreToRepository_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->virtualMachineUUID);
+          this->__isset.virtualMachineUUID = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->snapshot);
+          this->__isset.snapshot = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->destinationRepositoryPath);
+          this->__isset.destinationRepositoryPath = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->sourceDatastorePath);
+          this->__isset.sourceDatastorePath = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_startCopyFromDatastoreToRepository_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_startCopyFromDatastoreToRepository_args");
+
+  xfer += oprot->writeFieldBegin("virtualMachineUUID", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->virtualMachineUUID);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("snapshot", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->snapshot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("destinationRepositoryPath", ::apache::thrift::protocol::T_STRING, 3);
+  xfer += oprot->writeString(this->destinationRepositoryPath);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("sourceDatastorePath", ::apache::thrift::protocol::T_STRING, 4);
+  xfer += oprot->writeString(this->sourceDatastorePath);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_startCopyFromDatastoreToRepository_pargs::~Aim_startCopyFromDatastoreToRepository_pargs() throw() {
+}
+
+
+uint32_t Aim_startCopyFromDatastoreToRepository_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_startCopyFromDatastoreToRepository_pargs");
+
+  xfer += oprot->writeFieldBegin("virtualMachineUUID", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString((*(this->virtualMachineUUID)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("snapshot", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString((*(this->snapshot)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("destinationRepositoryPath", ::apache::thrift::protocol::T_STRING, 3);
+  xfer += oprot->writeString((*(this->destinationRepositoryPath)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("sourceDatastorePath", ::apache::thrift::protocol::T_STRING, 4);
+  xfer += oprot->writeString((*(this->sourceDatastorePath)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_startCopyFromDatastoreToRepository_result::~Aim_startCopyFromDatastoreToRepository_result() throw() {
+}
+
+
+uint32_t Aim_startCopyFromDatastoreToRepository_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->success);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_startCopyFromDatastoreToRepository_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_startCopyFromDatastoreToRepository_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRING, 0);
+    xfer += oprot->writeString(this->success);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.re) {
+    xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->re.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_startCopyFromDatastoreToRepository_presult::~Aim_startCopyFromDatastoreToRepository_presult() throw() {
+}
+
+
+uint32_t Aim_startCopyFromDatastoreToRepository_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString((*(this->success)));
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_startCopy_args::~Aim_startCopy_args() throw() {
+}
+
+
+uint32_t Aim_startCopy_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->source);
+          this->__isset.source = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->destination);
+          this->__isset.destination = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_startCopy_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_startCopy_args");
+
+  xfer += oprot->writeFieldBegin("source", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->source);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("destination", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->destination);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_startCopy_pargs::~Aim_startCopy_pargs() throw() {
+}
+
+
+uint32_t Aim_startCopy_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_startCopy_pargs");
+
+  xfer += oprot->writeFieldBegin("source", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString((*(this->source)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("destination", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString((*(this->destination)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_startCopy_result::~Aim_startCopy_result() throw() {
+}
+
+
+uint32_t Aim_startCopy_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->success);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_startCopy_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_startCopy_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRING, 0);
+    xfer += oprot->writeString(this->success);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.re) {
+    xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->re.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_startCopy_presult::~Aim_startCopy_presult() throw() {
+}
+
+
+uint32_t Aim_startCopy_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString((*(this->success)));
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_getJobStatus_args::~Aim_getJobStatus_args() throw() {
+}
+
+
+uint32_t Aim_getJobStatus_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->jobId);
+          this->__isset.jobId = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_getJobStatus_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_getJobStatus_args");
+
+  xfer += oprot->writeFieldBegin("jobId", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->jobId);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_getJobStatus_pargs::~Aim_getJobStatus_pargs() throw() {
+}
+
+
+uint32_t Aim_getJobStatus_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_getJobStatus_pargs");
+
+  xfer += oprot->writeFieldBegin("jobId", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString((*(this->jobId)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_getJobStatus_result::~Aim_getJobStatus_result() throw() {
+}
+
+
+uint32_t Aim_getJobStatus_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_getJobStatus_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_getJobStatus_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.re) {
+    xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->re.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_getJobStatus_presult::~Aim_getJobStatus_presult() throw() {
+}
+
+
+uint32_t Aim_getJobStatus_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_cancelJob_args::~Aim_cancelJob_args() throw() {
+}
+
+
+uint32_t Aim_cancelJob_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->jobId);
+          this->__isset.jobId = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_cancelJob_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_cancelJob_args");
+
+  xfer += oprot->writeFieldBegin("jobId", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->jobId);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_cancelJob_pargs::~Aim_cancelJob_pargs() throw() {
+}
+
+
+uint32_t Aim_cancelJob_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_cancelJob_pargs");
+
+  xfer += oprot->writeFieldBegin("jobId", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString((*(this->jobId)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_cancelJob_result::~Aim_cancelJob_result() throw() {
+}
+
+
+uint32_t Aim_cancelJob_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_cancelJob_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_cancelJob_result");
+
+  if (this->__isset.re) {
+    xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->re.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_cancelJob_presult::~Aim_cancelJob_presult() throw() {
+}
+
+
+uint32_t Aim_cancelJob_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_getServerStats_args::~Aim_getServerStats_args() throw() {
+}
+
+
+uint32_t Aim_getServerStats_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    xfer += iprot->skip(ftype);
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_getServerStats_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_getServerStats_args");
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_getServerStats_pargs::~Aim_getServerStats_pargs() throw() {
+}
+
+
+uint32_t Aim_getServerStats_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_getServerStats_pargs");
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_getServerStats_result::~Aim_getServerStats_result() throw() {
+}
+
+
+uint32_t Aim_getServerStats_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_getServerStats_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_getServerStats_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_getServerStats_presult::~Aim_getServerStats_presult() throw() {
+}
+
+
+uint32_t Aim_getServerStats_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_openUpload_args::~Aim_openUpload_args() throw() {
+}
+
+
+uint32_t Aim_openUpload_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->path);
+          this->__isset.path = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->size);
+          this->__isset.size = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_openUpload_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_openUpload_args");
+
+  xfer += oprot->writeFieldBegin("path", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->path);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("size", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->size);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_openUpload_pargs::~Aim_openUpload_pargs() throw() {
+}
+
+
+uint32_t Aim_openUpload_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_openUpload_pargs");
+
+  xfer += oprot->writeFieldBegin("path", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString((*(this->path)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("size", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64((*(this->size)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_openUpload_result::~Aim_openUpload_result() throw() {
+}
+
+
+uint32_t Aim_openUpload_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->success);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_openUpload_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_openUpload_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRING, 0);
+    xfer += oprot->writeString(this->success);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.re) {
+    xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->re.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_openUpload_presult::~Aim_openUpload_presult() throw() {
+}
+
+
+uint32_t Aim_openUpload_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString((*(this->success)));
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_writeChunk_args::~Aim_writeChunk_args() throw() {
+}
+
+
+uint32_t Aim_writeChunk_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->uploadId);
+          this->__isset.uploadId = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->offset);
+          this->__isset.offset = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readBinary(this->data);
+          this->__isset.data = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_writeChunk_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_writeChunk_args");
+
+  xfer += oprot->writeFieldBegin("uploadId", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->uploadId);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("offset", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->offset);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("data", ::apache::thrift::protocol::T_STRING, 3);
+  xfer += oprot->writeBinary(this->data);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_writeChunk_pargs::~Aim_writeChunk_pargs() throw() {
+}
+
+
+uint32_t Aim_writeChunk_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_writeChunk_pargs");
+
+  xfer += oprot->writeFieldBegin("uploadId", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString((*(this->uploadId)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("offset", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64((*(this->offset)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("data", ::apache::thrift::protocol::T_STRING, 3);
+  xfer += oprot->writeBinary((*(this->data)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_writeChunk_result::~Aim_writeChunk_result() throw() {
+}
+
+
+uint32_t Aim_writeChunk_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_writeChunk_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_writeChunk_result");
+
+  if (this->__isset.re) {
+    xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->re.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_writeChunk_presult::~Aim_writeChunk_presult() throw() {
+}
+
+
+uint32_t Aim_writeChunk_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_commitUpload_args::~Aim_commitUpload_args() throw() {
+}
+
+
+uint32_t Aim_commitUpload_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->uploadId);
+          this->__isset.uploadId = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->crc32);
+          this->__isset.crc32 = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_commitUpload_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_commitUpload_args");
+
+  xfer += oprot->writeFieldBegin("uploadId", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->uploadId);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("crc32", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->crc32);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_commitUpload_pargs::~Aim_commitUpload_pargs() throw() {
+}
+
+
+uint32_t Aim_commitUpload_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_commitUpload_pargs");
+
+  xfer += oprot->writeFieldBegin("uploadId", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString((*(this->uploadId)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("crc32", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64((*(this->crc32)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_commitUpload_result::~Aim_commitUpload_result() throw() {
+}
+
+
+uint32_t Aim_commitUpload_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_commitUpload_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_commitUpload_result");
+
+  if (this->__isset.re) {
+    xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->re.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_commitUpload_presult::~Aim_commitUpload_presult() throw() {
+}
+
+
+uint32_t Aim_commitUpload_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_abortUpload_args::~Aim_abortUpload_args() throw() {
+}
+
+
+uint32_t Aim_abortUpload_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->uploadId);
+          this->__isset.uploadId = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_abortUpload_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_abortUpload_args");
+
+  xfer += oprot->writeFieldBegin("uploadId", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->uploadId);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_abortUpload_pargs::~Aim_abortUpload_pargs() throw() {
+}
+
+
+uint32_t Aim_abortUpload_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_abortUpload_pargs");
+
+  xfer += oprot->writeFieldBegin("uploadId", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString((*(this->uploadId)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_abortUpload_result::~Aim_abortUpload_result() throw() {
+}
+
+
+uint32_t Aim_abortUpload_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_abortUpload_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_abortUpload_result");
+
+  if (this->__isset.re) {
+    xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->re.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_abortUpload_presult::~Aim_abortUpload_presult() throw() {
+}
+
+
+uint32_t Aim_abortUpload_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_powerOnMany_args::~Aim_powerOnMany_args() throw() {
+}
+
+
+uint32_t Aim_powerOnMany_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->domainNames.clear();
+            uint32_t _size178;
+            ::apache::thrift::protocol::TType _etype181;
+            xfer += iprot->readListBegin(_etype181, _size178);
+            this->domainNames.resize(_size178);
+            uint32_t _i182;
+            for (_i182 = 0; _i182 < _size178; ++_i182)
+            {
+              xfer += iprot->readString(this->domainNames[_i182]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.domainNames = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->options.read(iprot);
+          this->__isset.options = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_powerOnMany_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_powerOnMany_args");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->domainNames.size()));
+    std::vector<std::string> ::const_iterator _iter183;
+    for (_iter183 = this->domainNames.begin(); _iter183 != this->domainNames.end(); ++_iter183)
+    {
+      xfer += oprot->writeString((*_iter183));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += this->options.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_powerOnMany_pargs::~Aim_powerOnMany_pargs() throw() {
+}
+
+
+uint32_t Aim_powerOnMany_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_powerOnMany_pargs");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->domainNames)).size()));
+    std::vector<std::string> ::const_iterator _iter184;
+    for (_iter184 = (*(this->domainNames)).begin(); _iter184 != (*(this->domainNames)).end(); ++_iter184)
+    {
+      xfer += oprot->writeString((*_iter184));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += (*(this->options)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_powerOnMany_result::~Aim_powerOnMany_result() throw() {
+}
+
+
+uint32_t Aim_powerOnMany_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->success.clear();
+            uint32_t _size185;
+            ::apache::thrift::protocol::TType _etype188;
+            xfer += iprot->readListBegin(_etype188, _size185);
+            this->success.resize(_size185);
+            uint32_t _i189;
+            for (_i189 = 0; _i189 < _size185; ++_i189)
+            {
+              xfer += this->success[_i189].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_powerOnMany_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_powerOnMany_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
+      std::vector<DomainResult> ::const_iterator _iter190;
+      for (_iter190 = this->success.begin(); _iter190 != this->success.end(); ++_iter190)
+      {
+        xfer += (*_iter190).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_powerOnMany_presult::~Aim_powerOnMany_presult() throw() {
+}
+
+
+uint32_t Aim_powerOnMany_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size191;
+            ::apache::thrift::protocol::TType _etype194;
+            xfer += iprot->readListBegin(_etype194, _size191);
+            (*(this->success)).resize(_size191);
+            uint32_t _i195;
+            for (_i195 = 0; _i195 < _size191; ++_i195)
+            {
+              xfer += (*(this->success))[_i195].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_powerOffMany_args::~Aim_powerOffMany_args() throw() {
+}
+
+
+uint32_t Aim_powerOffMany_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->domainNames.clear();
+            uint32_t _size196;
+            ::apache::thrift::protocol::TType _etype199;
+            xfer += iprot->readListBegin(_etype199, _size196);
+            this->domainNames.resize(_size196);
+            uint32_t _i200;
+            for (_i200 = 0; _i200 < _size196; ++_i200)
+            {
+              xfer += iprot->readString(this->domainNames[_i200]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.domainNames = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->options.read(iprot);
+          this->__isset.options = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_powerOffMany_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_powerOffMany_args");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->domainNames.size()));
+    std::vector<std::string> ::const_iterator _iter201;
+    for (_iter201 = this->domainNames.begin(); _iter201 != this->domainNames.end(); ++_iter201)
+    {
+      xfer += oprot->writeString((*_iter201));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += this->options.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_powerOffMany_pargs::~Aim_powerOffMany_pargs() throw() {
+}
+
+
+uint32_t Aim_powerOffMany_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_powerOffMany_pargs");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->domainNames)).size()));
+    std::vector<std::string> ::const_iterator _iter202;
+    for (_iter202 = (*(this->domainNames)).begin(); _iter202 != (*(this->domainNames)).end(); ++_iter202)
+    {
+      xfer += oprot->writeString((*_iter202));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += (*(this->options)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_powerOffMany_result::~Aim_powerOffMany_result() throw() {
+}
+
+
+uint32_t Aim_powerOffMany_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->success.clear();
+            uint32_t _size203;
+            ::apache::thrift::protocol::TType _etype206;
+            xfer += iprot->readListBegin(_etype206, _size203);
+            this->success.resize(_size203);
+            uint32_t _i207;
+            for (_i207 = 0; _i207 < _size203; ++_i207)
+            {
+              xfer += this->success[_i207].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_powerOffMany_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_powerOffMany_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
+      std::vector<DomainResult> ::const_iterator _iter208;
+      for (_iter208 = this->success.begin(); _iter208 != this->success.end(); ++_iter208)
+      {
+        xfer += (*_iter208).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_powerOffMany_presult::~Aim_powerOffMany_presult() throw() {
+}
+
+
+uint32_t Aim_powerOffMany_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size209;
+            ::apache::thrift::protocol::TType _etype212;
+            xfer += iprot->readListBegin(_etype212, _size209);
+            (*(this->success)).resize(_size209);
+            uint32_t _i213;
+            for (_i213 = 0; _i213 < _size209; ++_i213)
+            {
+              xfer += (*(this->success))[_i213].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_shutdownMany_args::~Aim_shutdownMany_args() throw() {
+}
+
+
+uint32_t Aim_shutdownMany_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->domainNames.clear();
+            uint32_t _size214;
+            ::apache::thrift::protocol::TType _etype217;
+            xfer += iprot->readListBegin(_etype217, _size214);
+            this->domainNames.resize(_size214);
+            uint32_t _i218;
+            for (_i218 = 0; _i218 < _size214; ++_i218)
+            {
+              xfer += iprot->readString(this->domainNames[_i218]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.domainNames = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->options.read(iprot);
+          this->__isset.options = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_shutdownMany_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_shutdownMany_args");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->domainNames.size()));
+    std::vector<std::string> ::const_iterator _iter219;
+    for (_iter219 = this->domainNames.begin(); _iter219 != this->domainNames.end(); ++_iter219)
+    {
+      xfer += oprot->writeString((*_iter219));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += this->options.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_shutdownMany_pargs::~Aim_shutdownMany_pargs() throw() {
+}
+
+
+uint32_t Aim_shutdownMany_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_shutdownMany_pargs");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->domainNames)).size()));
+    std::vector<std::string> ::const_iterator _iter220;
+    for (_iter220 = (*(this->domainNames)).begin(); _iter220 != (*(this->domainNames)).end(); ++_iter220)
+    {
+      xfer += oprot->writeString((*_iter220));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += (*(this->options)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_shutdownMany_result::~Aim_shutdownMany_result() throw() {
+}
+
+
+uint32_t Aim_shutdownMany_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->success.clear();
+            uint32_t _size221;
+            ::apache::thrift::protocol::TType _etype224;
+            xfer += iprot->readListBegin(_etype224, _size221);
+            this->success.resize(_size221);
+            uint32_t _i225;
+            for (_i225 = 0; _i225 < _size221; ++_i225)
+            {
+              xfer += this->success[_i225].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_shutdownMany_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_shutdownMany_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
+      std::vector<DomainResult> ::const_iterator _iter226;
+      for (_iter226 = this->success.begin(); _iter226 != this->success.end(); ++_iter226)
+      {
+        xfer += (*_iter226).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_shutdownMany_presult::~Aim_shutdownMany_presult() throw() {
+}
+
+
+uint32_t Aim_shutdownMany_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size227;
+            ::apache::thrift::protocol::TType _etype230;
+            xfer += iprot->readListBegin(_etype230, _size227);
+            (*(this->success)).resize(_size227);
+            uint32_t _i231;
+            for (_i231 = 0; _i231 < _size227; ++_i231)
+            {
+              xfer += (*(this->success))[_i231].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_resetMany_args::~Aim_resetMany_args() throw() {
+}
+
+
+uint32_t Aim_resetMany_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->domainNames.clear();
+            uint32_t _size232;
+            ::apache::thrift::protocol::TType _etype235;
+            xfer += iprot->readListBegin(_etype235, _size232);
+            this->domainNames.resize(_size232);
+            uint32_t _i236;
+            for (_i236 = 0; _i236 < _size232; ++_i236)
+            {
+              xfer += iprot->readString(this->domainNames[_i236]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.domainNames = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->options.read(iprot);
+          this->__isset.options = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_resetMany_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_resetMany_args");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->domainNames.size()));
+    std::vector<std::string> ::const_iterator _iter237;
+    for (_iter237 = this->domainNames.begin(); _iter237 != this->domainNames.end(); ++_iter237)
+    {
+      xfer += oprot->writeString((*_iter237));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += this->options.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_resetMany_pargs::~Aim_resetMany_pargs() throw() {
+}
+
+
+uint32_t Aim_resetMany_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_resetMany_pargs");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->domainNames)).size()));
+    std::vector<std::string> ::const_iterator _iter238;
+    for (_iter238 = (*(this->domainNames)).begin(); _iter238 != (*(this->domainNames)).end(); ++_iter238)
+    {
+      xfer += oprot->writeString((*_iter238));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += (*(this->options)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_resetMany_result::~Aim_resetMany_result() throw() {
+}
+
+
+uint32_t Aim_resetMany_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->success.clear();
+            uint32_t _size239;
+            ::apache::thrift::protocol::TType _etype242;
+            xfer += iprot->readListBegin(_etype242, _size239);
+            this->success.resize(_size239);
+            uint32_t _i243;
+            for (_i243 = 0; _i243 < _size239; ++_i243)
+            {
+              xfer += this->success[_i243].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_resetMany_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_resetMany_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
+      std::vector<DomainResult> ::const_iterator _iter244;
+      for (_iter244 = this->success.begin(); _iter244 != this->success.end(); ++_iter244)
+      {
+        xfer += (*_iter244).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_resetMany_presult::~Aim_resetMany_presult() throw() {
+}
+
+
+uint32_t Aim_resetMany_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size245;
+            ::apache::thrift::protocol::TType _etype248;
+            xfer += iprot->readListBegin(_etype248, _size245);
+            (*(this->success)).resize(_size245);
+            uint32_t _i249;
+            for (_i249 = 0; _i249 < _size245; ++_i249)
+            {
+              xfer += (*(this->success))[_i249].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_pauseMany_args::~Aim_pauseMany_args() throw() {
+}
+
+
+uint32_t Aim_pauseMany_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->domainNames.clear();
+            uint32_t _size250;
+            ::apache::thrift::protocol::TType _etype253;
+            xfer += iprot->readListBegin(_etype253, _size250);
+            this->domainNames.resize(_size250);
+            uint32_t _i254;
+            for (_i254 = 0; _i254 < _size250; ++_i254)
+            {
+              xfer += iprot->readString(this->domainNames[_i254]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.domainNames = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->options.read(iprot);
+          this->__isset.options = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_pauseMany_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_pauseMany_args");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->domainNames.size()));
+    std::vector<std::string> ::const_iterator _iter255;
+    for (_iter255 = this->domainNames.begin(); _iter255 != this->domainNames.end(); ++_iter255)
+    {
+      xfer += oprot->writeString((*_iter255));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += this->options.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_pauseMany_pargs::~Aim_pauseMany_pargs() throw() {
+}
+
+
+uint32_t Aim_pauseMany_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_pauseMany_pargs");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->domainNames)).size()));
+    std::vector<std::string> ::const_iterator _iter256;
+    for (_iter256 = (*(this->domainNames)).begin(); _iter256 != (*(this->domainNames)).end(); ++_iter256)
+    {
+      xfer += oprot->writeString((*_iter256));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += (*(this->options)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_pauseMany_result::~Aim_pauseMany_result() throw() {
+}
+
+
+uint32_t Aim_pauseMany_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->success.clear();
+            uint32_t _size257;
+            ::apache::thrift::protocol::TType _etype260;
+            xfer += iprot->readListBegin(_etype260, _size257);
+            this->success.resize(_size257);
+            uint32_t _i261;
+            for (_i261 = 0; _i261 < _size257; ++_i261)
+            {
+              xfer += this->success[_i261].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_pauseMany_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_pauseMany_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
+      std::vector<DomainResult> ::const_iterator _iter262;
+      for (_iter262 = this->success.begin(); _iter262 != this->success.end(); ++_iter262)
+      {
+        xfer += (*_iter262).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_pauseMany_presult::~Aim_pauseMany_presult() throw() {
+}
+
+
+uint32_t Aim_pauseMany_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size263;
+            ::apache::thrift::protocol::TType _etype266;
+            xfer += iprot->readListBegin(_etype266, _size263);
+            (*(this->success)).resize(_size263);
+            uint32_t _i267;
+            for (_i267 = 0; _i267 < _size263; ++_i267)
+            {
+              xfer += (*(this->success))[_i267].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_resumeMany_args::~Aim_resumeMany_args() throw() {
+}
+
+
+uint32_t Aim_resumeMany_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->domainNames.clear();
+            uint32_t _size268;
+            ::apache::thrift::protocol::TType _etype271;
+            xfer += iprot->readListBegin(_etype271, _size268);
+            this->domainNames.resize(_size268);
+            uint32_t _i272;
+            for (_i272 = 0; _i272 < _size268; ++_i272)
+            {
+              xfer += iprot->readString(this->domainNames[_i272]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.domainNames = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->options.read(iprot);
+          this->__isset.options = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_resumeMany_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_resumeMany_args");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->domainNames.size()));
+    std::vector<std::string> ::const_iterator _iter273;
+    for (_iter273 = this->domainNames.begin(); _iter273 != this->domainNames.end(); ++_iter273)
+    {
+      xfer += oprot->writeString((*_iter273));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += this->options.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_resumeMany_pargs::~Aim_resumeMany_pargs() throw() {
+}
+
+
+uint32_t Aim_resumeMany_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_resumeMany_pargs");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->domainNames)).size()));
+    std::vector<std::string> ::const_iterator _iter274;
+    for (_iter274 = (*(this->domainNames)).begin(); _iter274 != (*(this->domainNames)).end(); ++_iter274)
+    {
+      xfer += oprot->writeString((*_iter274));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += (*(this->options)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_resumeMany_result::~Aim_resumeMany_result() throw() {
+}
+
+
+uint32_t Aim_resumeMany_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->success.clear();
+            uint32_t _size275;
+            ::apache::thrift::protocol::TType _etype278;
+            xfer += iprot->readListBegin(_etype278, _size275);
+            this->success.resize(_size275);
+            uint32_t _i279;
+            for (_i279 = 0; _i279 < _size275; ++_i279)
+            {
+              xfer += this->success[_i279].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_resumeMany_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_resumeMany_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
+      std::vector<DomainResult> ::const_iterator _iter280;
+      for (_iter280 = this->success.begin(); _iter280 != this->success.end(); ++_iter280)
+      {
+        xfer += (*_iter280).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_resumeMany_presult::~Aim_resumeMany_presult() throw() {
+}
+
+
+uint32_t Aim_resumeMany_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size281;
+            ::apache::thrift::protocol::TType _etype284;
+            xfer += iprot->readListBegin(_etype284, _size281);
+            (*(this->success)).resize(_size281);
+            uint32_t _i285;
+            for (_i285 = 0; _i285 < _size281; ++_i285)
+            {
+              xfer += (*(this->success))[_i285].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_shutdownWithDeadline_args::~Aim_shutdownWithDeadline_args() throw() {
+}
+
+
+uint32_t Aim_shutdownWithDeadline_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->domainName);
+          this->__isset.domainName = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->timeoutSec);
+          this->__isset.timeoutSec = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_shutdownWithDeadline_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_shutdownWithDeadline_args");
+
+  xfer += oprot->writeFieldBegin("domainName", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->domainName);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timeoutSec", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->timeoutSec);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_shutdownWithDeadline_pargs::~Aim_shutdownWithDeadline_pargs() throw() {
+}
+
+
+uint32_t Aim_shutdownWithDeadline_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_shutdownWithDeadline_pargs");
+
+  xfer += oprot->writeFieldBegin("domainName", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString((*(this->domainName)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timeoutSec", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32((*(this->timeoutSec)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_shutdownWithDeadline_result::~Aim_shutdownWithDeadline_result() throw() {
+}
+
+
+uint32_t Aim_shutdownWithDeadline_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->libvirtException.read(iprot);
+          this->__isset.libvirtException = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_shutdownWithDeadline_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_shutdownWithDeadline_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.libvirtException) {
+    xfer += oprot->writeFieldBegin("libvirtException", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->libvirtException.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_shutdownWithDeadline_presult::~Aim_shutdownWithDeadline_presult() throw() {
+}
+
+
+uint32_t Aim_shutdownWithDeadline_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->libvirtException.read(iprot);
+          this->__isset.libvirtException = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_shutdownManyWithDeadline_args::~Aim_shutdownManyWithDeadline_args() throw() {
+}
+
+
+uint32_t Aim_shutdownManyWithDeadline_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->domainNames.clear();
+            uint32_t _size286;
+            ::apache::thrift::protocol::TType _etype289;
+            xfer += iprot->readListBegin(_etype289, _size286);
+            this->domainNames.resize(_size286);
+            uint32_t _i290;
+            for (_i290 = 0; _i290 < _size286; ++_i290)
+            {
+              xfer += iprot->readString(this->domainNames[_i290]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.domainNames = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->timeoutSec);
+          this->__isset.timeoutSec = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->options.read(iprot);
+          this->__isset.options = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_shutdownManyWithDeadline_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_shutdownManyWithDeadline_args");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->domainNames.size()));
+    std::vector<std::string> ::const_iterator _iter291;
+    for (_iter291 = this->domainNames.begin(); _iter291 != this->domainNames.end(); ++_iter291)
+    {
+      xfer += oprot->writeString((*_iter291));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timeoutSec", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->timeoutSec);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 3);
+  xfer += this->options.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_shutdownManyWithDeadline_pargs::~Aim_shutdownManyWithDeadline_pargs() throw() {
+}
+
+
+uint32_t Aim_shutdownManyWithDeadline_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_shutdownManyWithDeadline_pargs");
+
+  xfer += oprot->writeFieldBegin("domainNames", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->domainNames)).size()));
+    std::vector<std::string> ::const_iterator _iter292;
+    for (_iter292 = (*(this->domainNames)).begin(); _iter292 != (*(this->domainNames)).end(); ++_iter292)
+    {
+      xfer += oprot->writeString((*_iter292));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timeoutSec", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32((*(this->timeoutSec)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("options", ::apache::thrift::protocol::T_STRUCT, 3);
+  xfer += (*(this->options)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_shutdownManyWithDeadline_result::~Aim_shutdownManyWithDeadline_result() throw() {
+}
+
+
+uint32_t Aim_shutdownManyWithDeadline_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->success.clear();
+            uint32_t _size293;
+            ::apache::thrift::protocol::TType _etype296;
+            xfer += iprot->readListBegin(_etype296, _size293);
+            this->success.resize(_size293);
+            uint32_t _i297;
+            for (_i297 = 0; _i297 < _size293; ++_i297)
+            {
+              xfer += this->success[_i297].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_shutdownManyWithDeadline_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_shutdownManyWithDeadline_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
+      std::vector<DomainResult> ::const_iterator _iter298;
+      for (_iter298 = this->success.begin(); _iter298 != this->success.end(); ++_iter298)
+      {
+        xfer += (*_iter298).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_shutdownManyWithDeadline_presult::~Aim_shutdownManyWithDeadline_presult() throw() {
+}
+
+
+uint32_t Aim_shutdownManyWithDeadline_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size299;
+            ::apache::thrift::protocol::TType _etype302;
+            xfer += iprot->readListBegin(_etype302, _size299);
+            (*(this->success)).resize(_size299);
+            uint32_t _i303;
+            for (_i303 = 0; _i303 < _size299; ++_i303)
+            {
+              xfer += (*(this->success))[_i303].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+Aim_readChunk_args::~Aim_readChunk_args() throw() {
+}
+
+
+uint32_t Aim_readChunk_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->path);
+          this->__isset.path = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->offset);
+          this->__isset.offset = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->length);
+          this->__isset.length = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->compress);
+          this->__isset.compress = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_readChunk_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_readChunk_args");
+
+  xfer += oprot->writeFieldBegin("path", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->path);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("offset", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->offset);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("length", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->length);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("compress", ::apache::thrift::protocol::T_BOOL, 4);
+  xfer += oprot->writeBool(this->compress);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_readChunk_pargs::~Aim_readChunk_pargs() throw() {
+}
+
+
+uint32_t Aim_readChunk_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("Aim_readChunk_pargs");
+
+  xfer += oprot->writeFieldBegin("path", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString((*(this->path)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("offset", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64((*(this->offset)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("length", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32((*(this->length)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("compress", ::apache::thrift::protocol::T_BOOL, 4);
+  xfer += oprot->writeBool((*(this->compress)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+
+Aim_readChunk_result::~Aim_readChunk_result() throw() {
+}
+
+
+uint32_t Aim_readChunk_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Aim_readChunk_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Aim_readChunk_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.re) {
+    xfer += oprot->writeFieldBegin("re", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->re.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.timeout) {
+    xfer += oprot->writeFieldBegin("timeout", ::apache::thrift::protocol::T_STRUCT, 98);
+    xfer += this->timeout.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overload) {
+    xfer += oprot->writeFieldBegin("overload", ::apache::thrift::protocol::T_STRUCT, 99);
+    xfer += this->overload.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Aim_readChunk_presult::~Aim_readChunk_presult() throw() {
+}
+
+
+uint32_t Aim_readChunk_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->re.read(iprot);
+          this->__isset.re = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 98:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->timeout.read(iprot);
+          this->__isset.timeout = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 99:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overload.read(iprot);
+          this->__isset.overload = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+void AimClient::checkRimpConfiguration()
+{
+  send_checkRimpConfiguration();
+  recv_checkRimpConfiguration();
+}
+
+void AimClient::send_checkRimpConfiguration()
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("checkRimpConfiguration", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_checkRimpConfiguration_pargs args;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_checkRimpConfiguration()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("checkRimpConfiguration") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_checkRimpConfiguration_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.re) {
+    throw result.re;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+int64_t AimClient::getDiskFileSize(const std::string& virtualImageDatastorePath)
+{
+  send_getDiskFileSize(virtualImageDatastorePath);
+  return recv_getDiskFileSize();
+}
+
+void AimClient::send_getDiskFileSize(const std::string& virtualImageDatastorePath)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getDiskFileSize", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getDiskFileSize_pargs args;
+  args.virtualImageDatastorePath = &virtualImageDatastorePath;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+int64_t AimClient::recv_getDiskFileSize()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getDiskFileSize") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  int64_t _return;
+  Aim_getDiskFileSize_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    return _return;
+  }
+  if (result.__isset.re) {
+    throw result.re;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDiskFileSize failed: unknown result");
+}
+
+void AimClient::getDatastores(std::vector<Datastore> & _return)
+{
+  send_getDatastores();
+  recv_getDatastores(_return);
+}
+
+void AimClient::send_getDatastores()
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getDatastores", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getDatastores_pargs args;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_getDatastores(std::vector<Datastore> & _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getDatastores") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_getDatastores_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.re) {
+    throw result.re;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDatastores failed: unknown result");
+}
+
+void AimClient::getNetInterfaces(std::vector<NetInterface> & _return)
+{
+  send_getNetInterfaces();
   recv_getNetInterfaces(_return);
 }
 
-void AimClient::send_getNetInterfaces()
+void AimClient::send_getNetInterfaces()
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getNetInterfaces", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getNetInterfaces_pargs args;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_getNetInterfaces(std::vector<NetInterface> & _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getNetInterfaces") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_getNetInterfaces_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.re) {
+    throw result.re;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getNetInterfaces failed: unknown result");
+}
+
+void AimClient::copyFromRepositoryToDatastore(const std::string& virtualImageRepositoryPath, const std::string& datastorePath, const std::string& virtualMachineUUID)
+{
+  send_copyFromRepositoryToDatastore(virtualImageRepositoryPath, datastorePath, virtualMachineUUID);
+  recv_copyFromRepositoryToDatastore();
+}
+
+void AimClient::send_copyFromRepositoryToDatastore(const std::string& virtualImageRepositoryPath, const std::string& datastorePath, const std::string& virtualMachineUUID)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("copyFromRepositoryToDatastore", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_copyFromRepositoryToDatastore_pargs args;
+  args.virtualImageRepositoryPath = &virtualImageRepositoryPath;
+  args.datastorePath = &datastorePath;
+  args.virtualMachineUUID = &virtualMachineUUID;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_copyFromRepositoryToDatastore()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("copyFromRepositoryToDatastore") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_copyFromRepositoryToDatastore_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.re) {
+    throw result.re;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::deleteVirtualImageFromDatastore(const std::string& datastorePath, const std::string& virtualMachineUUID)
+{
+  send_deleteVirtualImageFromDatastore(datastorePath, virtualMachineUUID);
+  recv_deleteVirtualImageFromDatastore();
+}
+
+void AimClient::send_deleteVirtualImageFromDatastore(const std::string& datastorePath, const std::string& virtualMachineUUID)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("deleteVirtualImageFromDatastore", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_deleteVirtualImageFromDatastore_pargs args;
+  args.datastorePath = &datastorePath;
+  args.virtualMachineUUID = &virtualMachineUUID;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_deleteVirtualImageFromDatastore()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("deleteVirtualImageFromDatastore") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_deleteVirtualImageFromDatastore_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.re) {
+    throw result.re;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::copyFromDatastoreToRepository(const std::string& virtualMachineUUID, const std::string& snapshot, const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath)
+{
+  send_copyFromDatastoreToRepository(virtualMachineUUID, snapshot, destinationRepositoryPath, sourceDatastorePath);
+  recv_copyFromDatastoreToRepository();
+}
+
+void AimClient::send_copyFromDatastoreToRepository(const std::string& virtualMachineUUID, const std::string& snapshot, const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("copyFromDatastoreToRepository", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_copyFromDatastoreToRepository_pargs args;
+  args.virtualMachineUUID = &virtualMachineUUID;
+  args.snapshot = &snapshot;
+  args.destinationRepositoryPath = &destinationRepositoryPath;
+  args.sourceDatastorePath = &sourceDatastorePath;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_copyFromDatastoreToRepository()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("copyFromDatastoreToRepository") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_copyFromDatastoreToRepository_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.re) {
+    throw result.re;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::instanceDisk(const std::string& source, const std::string& destination)
+{
+  send_instanceDisk(source, destination);
+  recv_instanceDisk();
+}
+
+void AimClient::send_instanceDisk(const std::string& source, const std::string& destination)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("instanceDisk", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_instanceDisk_pargs args;
+  args.source = &source;
+  args.destination = &destination;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_instanceDisk()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("instanceDisk") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_instanceDisk_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.re) {
+    throw result.re;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::renameDisk(const std::string& oldPath, const std::string& newPath)
+{
+  send_renameDisk(oldPath, newPath);
+  recv_renameDisk();
+}
+
+void AimClient::send_renameDisk(const std::string& oldPath, const std::string& newPath)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("renameDisk", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_renameDisk_pargs args;
+  args.oldPath = &oldPath;
+  args.newPath = &newPath;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_renameDisk()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("renameDisk") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_renameDisk_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.re) {
+    throw result.re;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::createVLAN(const int32_t vlanTag, const std::string& vlanInterface, const std::string& bridgeInterface)
+{
+  send_createVLAN(vlanTag, vlanInterface, bridgeInterface);
+  recv_createVLAN();
+}
+
+void AimClient::send_createVLAN(const int32_t vlanTag, const std::string& vlanInterface, const std::string& bridgeInterface)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("createVLAN", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_createVLAN_pargs args;
+  args.vlanTag = &vlanTag;
+  args.vlanInterface = &vlanInterface;
+  args.bridgeInterface = &bridgeInterface;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_createVLAN()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("createVLAN") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_createVLAN_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.ve) {
+    throw result.ve;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::deleteVLAN(const int32_t vlanTag, const std::string& vlanInterface, const std::string& bridgeInterface)
+{
+  send_deleteVLAN(vlanTag, vlanInterface, bridgeInterface);
+  recv_deleteVLAN();
+}
+
+void AimClient::send_deleteVLAN(const int32_t vlanTag, const std::string& vlanInterface, const std::string& bridgeInterface)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("deleteVLAN", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_deleteVLAN_pargs args;
+  args.vlanTag = &vlanTag;
+  args.vlanInterface = &vlanInterface;
+  args.bridgeInterface = &bridgeInterface;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_deleteVLAN()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("deleteVLAN") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_deleteVLAN_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.ve) {
+    throw result.ve;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::checkVLANConfiguration()
+{
+  send_checkVLANConfiguration();
+  recv_checkVLANConfiguration();
+}
+
+void AimClient::send_checkVLANConfiguration()
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("checkVLANConfiguration", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_checkVLANConfiguration_pargs args;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_checkVLANConfiguration()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("checkVLANConfiguration") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_checkVLANConfiguration_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.ve) {
+    throw result.ve;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::getInitiatorIQN(std::string& _return)
+{
+  send_getInitiatorIQN();
+  recv_getInitiatorIQN(_return);
+}
+
+void AimClient::send_getInitiatorIQN()
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getInitiatorIQN", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getInitiatorIQN_pargs args;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_getInitiatorIQN(std::string& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getInitiatorIQN") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_getInitiatorIQN_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.se) {
+    throw result.se;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getInitiatorIQN failed: unknown result");
+}
+
+void AimClient::rescanISCSI(const std::vector<std::string> & targets)
+{
+  send_rescanISCSI(targets);
+  recv_rescanISCSI();
+}
+
+void AimClient::send_rescanISCSI(const std::vector<std::string> & targets)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("rescanISCSI", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_rescanISCSI_pargs args;
+  args.targets = &targets;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_rescanISCSI()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("rescanISCSI") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_rescanISCSI_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.se) {
+    throw result.se;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::getNodeInfo(NodeInfo& _return)
+{
+  send_getNodeInfo();
+  recv_getNodeInfo(_return);
+}
+
+void AimClient::send_getNodeInfo()
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getNodeInfo", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getNodeInfo_pargs args;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_getNodeInfo(NodeInfo& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getNodeInfo") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_getNodeInfo_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getNodeInfo failed: unknown result");
+}
+
+void AimClient::defineDomain(const std::string& xmlDesc)
+{
+  send_defineDomain(xmlDesc);
+  recv_defineDomain();
+}
+
+void AimClient::send_defineDomain(const std::string& xmlDesc)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("defineDomain", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_defineDomain_pargs args;
+  args.xmlDesc = &xmlDesc;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_defineDomain()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("defineDomain") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_defineDomain_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::undefineDomain(const std::string& domainName)
+{
+  send_undefineDomain(domainName);
+  recv_undefineDomain();
+}
+
+void AimClient::send_undefineDomain(const std::string& domainName)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("undefineDomain", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_undefineDomain_pargs args;
+  args.domainName = &domainName;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_undefineDomain()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("undefineDomain") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_undefineDomain_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+bool AimClient::existDomain(const std::string& domainName)
+{
+  send_existDomain(domainName);
+  return recv_existDomain();
+}
+
+void AimClient::send_existDomain(const std::string& domainName)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("existDomain", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_existDomain_pargs args;
+  args.domainName = &domainName;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+bool AimClient::recv_existDomain()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("existDomain") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  bool _return;
+  Aim_existDomain_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    return _return;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "existDomain failed: unknown result");
+}
+
+DomainState::type AimClient::getDomainState(const std::string& domainName)
+{
+  send_getDomainState(domainName);
+  return recv_getDomainState();
+}
+
+void AimClient::send_getDomainState(const std::string& domainName)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getDomainState", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getDomainState_pargs args;
+  args.domainName = &domainName;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+DomainState::type AimClient::recv_getDomainState()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getDomainState") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  DomainState::type _return;
+  Aim_getDomainState_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    return _return;
+  }
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDomainState failed: unknown result");
+}
+
+void AimClient::getDomainInfo(DomainInfo& _return, const std::string& domainName)
+{
+  send_getDomainInfo(domainName);
+  recv_getDomainInfo(_return);
+}
+
+void AimClient::send_getDomainInfo(const std::string& domainName)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getDomainInfo", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getDomainInfo_pargs args;
+  args.domainName = &domainName;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_getDomainInfo(DomainInfo& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getDomainInfo") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_getDomainInfo_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDomainInfo failed: unknown result");
+}
+
+void AimClient::getDomains(std::vector<DomainInfo> & _return)
+{
+  send_getDomains();
+  recv_getDomains(_return);
+}
+
+void AimClient::send_getDomains()
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getDomains", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getDomains_pargs args;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_getDomains(std::vector<DomainInfo> & _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getDomains") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_getDomains_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDomains failed: unknown result");
+}
+
+void AimClient::powerOn(const std::string& domainName)
+{
+  send_powerOn(domainName);
+  recv_powerOn();
+}
+
+void AimClient::send_powerOn(const std::string& domainName)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("powerOn", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_powerOn_pargs args;
+  args.domainName = &domainName;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_powerOn()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("powerOn") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_powerOn_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::powerOff(const std::string& domainName)
+{
+  send_powerOff(domainName);
+  recv_powerOff();
+}
+
+void AimClient::send_powerOff(const std::string& domainName)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("powerOff", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_powerOff_pargs args;
+  args.domainName = &domainName;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_powerOff()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("powerOff") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_powerOff_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::shutdown(const std::string& domainName)
+{
+  send_shutdown(domainName);
+  recv_shutdown();
+}
+
+void AimClient::send_shutdown(const std::string& domainName)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("shutdown", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_shutdown_pargs args;
+  args.domainName = &domainName;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_shutdown()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("shutdown") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_shutdown_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::reset(const std::string& domainName)
+{
+  send_reset(domainName);
+  recv_reset();
+}
+
+void AimClient::send_reset(const std::string& domainName)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("reset", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_reset_pargs args;
+  args.domainName = &domainName;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_reset()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("reset") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_reset_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::pause(const std::string& domainName)
+{
+  send_pause(domainName);
+  recv_pause();
+}
+
+void AimClient::send_pause(const std::string& domainName)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("pause", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_pause_pargs args;
+  args.domainName = &domainName;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_pause()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("pause") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_pause_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::resume(const std::string& domainName)
+{
+  send_resume(domainName);
+  recv_resume();
+}
+
+void AimClient::send_resume(const std::string& domainName)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("resume", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_resume_pargs args;
+  args.domainName = &domainName;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_resume()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("resume") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_resume_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::createISCSIStoragePool(const std::string& name, const std::string& host, const std::string& iqn, const std::string& targetPath)
+{
+  send_createISCSIStoragePool(name, host, iqn, targetPath);
+  recv_createISCSIStoragePool();
+}
+
+void AimClient::send_createISCSIStoragePool(const std::string& name, const std::string& host, const std::string& iqn, const std::string& targetPath)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("createISCSIStoragePool", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_createISCSIStoragePool_pargs args;
+  args.name = &name;
+  args.host = &host;
+  args.iqn = &iqn;
+  args.targetPath = &targetPath;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_createISCSIStoragePool()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("createISCSIStoragePool") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_createISCSIStoragePool_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::createNFSStoragePool(const std::string& name, const std::string& host, const std::string& dir, const std::string& targetPath)
+{
+  send_createNFSStoragePool(name, host, dir, targetPath);
+  recv_createNFSStoragePool();
+}
+
+void AimClient::send_createNFSStoragePool(const std::string& name, const std::string& host, const std::string& dir, const std::string& targetPath)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("createNFSStoragePool", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_createNFSStoragePool_pargs args;
+  args.name = &name;
+  args.host = &host;
+  args.dir = &dir;
+  args.targetPath = &targetPath;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_createNFSStoragePool()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("createNFSStoragePool") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_createNFSStoragePool_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::createDirStoragePool(const std::string& name, const std::string& targetPath)
+{
+  send_createDirStoragePool(name, targetPath);
+  recv_createDirStoragePool();
+}
+
+void AimClient::send_createDirStoragePool(const std::string& name, const std::string& targetPath)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("createDirStoragePool", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_createDirStoragePool_pargs args;
+  args.name = &name;
+  args.targetPath = &targetPath;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_createDirStoragePool()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("createDirStoragePool") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_createDirStoragePool_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::createDisk(const std::string& poolName, const std::string& name, const double capacityInKb, const double allocationInKb, const std::string& format)
+{
+  send_createDisk(poolName, name, capacityInKb, allocationInKb, format);
+  recv_createDisk();
+}
+
+void AimClient::send_createDisk(const std::string& poolName, const std::string& name, const double capacityInKb, const double allocationInKb, const std::string& format)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("createDisk", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_createDisk_pargs args;
+  args.poolName = &poolName;
+  args.name = &name;
+  args.capacityInKb = &capacityInKb;
+  args.allocationInKb = &allocationInKb;
+  args.format = &format;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_createDisk()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("createDisk") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_createDisk_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::deleteDisk(const std::string& poolName, const std::string& name)
+{
+  send_deleteDisk(poolName, name);
+  recv_deleteDisk();
+}
+
+void AimClient::send_deleteDisk(const std::string& poolName, const std::string& name)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("deleteDisk", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_deleteDisk_pargs args;
+  args.poolName = &poolName;
+  args.name = &name;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_deleteDisk()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("deleteDisk") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_deleteDisk_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::resizeVol(const std::string& poolName, const std::string& name, const double capacityInKb)
+{
+  send_resizeVol(poolName, name, capacityInKb);
+  recv_resizeVol();
+}
+
+void AimClient::send_resizeVol(const std::string& poolName, const std::string& name, const double capacityInKb)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("resizeVol", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_resizeVol_pargs args;
+  args.poolName = &poolName;
+  args.name = &name;
+  args.capacityInKb = &capacityInKb;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_resizeVol()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("resizeVol") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_resizeVol_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::resizeDisk(const std::string& domainName, const std::string& diskPath, const double diskSizeInKb)
+{
+  send_resizeDisk(domainName, diskPath, diskSizeInKb);
+  recv_resizeDisk();
+}
+
+void AimClient::send_resizeDisk(const std::string& domainName, const std::string& diskPath, const double diskSizeInKb)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("resizeDisk", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_resizeDisk_pargs args;
+  args.domainName = &domainName;
+  args.diskPath = &diskPath;
+  args.diskSizeInKb = &diskSizeInKb;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_resizeDisk()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("resizeDisk") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_resizeDisk_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::getDomainBlockInfo(DomainBlockInfo& _return, const std::string& domainName, const std::string& diskPath)
+{
+  send_getDomainBlockInfo(domainName, diskPath);
+  recv_getDomainBlockInfo(_return);
+}
+
+void AimClient::send_getDomainBlockInfo(const std::string& domainName, const std::string& diskPath)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getDomainBlockInfo", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getDomainBlockInfo_pargs args;
+  args.domainName = &domainName;
+  args.diskPath = &diskPath;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_getDomainBlockInfo(DomainBlockInfo& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getDomainBlockInfo") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_getDomainBlockInfo_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDomainBlockInfo failed: unknown result");
+}
+
+void AimClient::getDatapoints(std::vector<Measure> & _return, const std::string& domainName, const int32_t timestamp)
+{
+  send_getDatapoints(domainName, timestamp);
+  recv_getDatapoints(_return);
+}
+
+void AimClient::send_getDatapoints(const std::string& domainName, const int32_t timestamp)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getDatapoints", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getDatapoints_pargs args;
+  args.domainName = &domainName;
+  args.timestamp = &timestamp;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_getDatapoints(std::vector<Measure> & _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getDatapoints") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_getDatapoints_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDatapoints failed: unknown result");
+}
+
+void AimClient::upload(const BinaryFile& file, const std::string& path)
+{
+  send_upload(file, path);
+  recv_upload();
+}
+
+void AimClient::send_upload(const BinaryFile& file, const std::string& path)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("upload", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_upload_pargs args;
+  args.file = &file;
+  args.path = &path;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_upload()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("upload") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_upload_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  return;
+}
+
+void AimClient::getDomainsLite(std::vector<DomainInfo> & _return)
+{
+  send_getDomainsLite();
+  recv_getDomainsLite(_return);
+}
+
+void AimClient::send_getDomainsLite()
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getDomainsLite", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getDomainsLite_pargs args;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_getDomainsLite(std::vector<DomainInfo> & _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getDomainsLite") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_getDomainsLite_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDomainsLite failed: unknown result");
+}
+
+void AimClient::getDomainsWithFields(std::vector<DomainInfo> & _return, const DomainFields::type fields)
+{
+  send_getDomainsWithFields(fields);
+  recv_getDomainsWithFields(_return);
+}
+
+void AimClient::send_getDomainsWithFields(const DomainFields::type fields)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getDomainsWithFields", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getDomainsWithFields_pargs args;
+  args.fields = &fields;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_getDomainsWithFields(std::vector<DomainInfo> & _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getDomainsWithFields") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_getDomainsWithFields_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDomainsWithFields failed: unknown result");
+}
+
+void AimClient::getDomainsChangedSince(DomainChanges& _return, const int64_t generation, const DomainFields::type fields)
+{
+  send_getDomainsChangedSince(generation, fields);
+  recv_getDomainsChangedSince(_return);
+}
+
+void AimClient::send_getDomainsChangedSince(const int64_t generation, const DomainFields::type fields)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("getDomainsChangedSince", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_getDomainsChangedSince_pargs args;
+  args.generation = &generation;
+  args.fields = &fields;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_getDomainsChangedSince(DomainChanges& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("getDomainsChangedSince") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_getDomainsChangedSince_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.libvirtException) {
+    throw result.libvirtException;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDomainsChangedSince failed: unknown result");
+}
+
+void AimClient::waitForEvents(DomainEvents& _return, const int64_t sinceId, const int32_t timeoutMs)
+{
+  send_waitForEvents(sinceId, timeoutMs);
+  recv_waitForEvents(_return);
+}
+
+void AimClient::send_waitForEvents(const int64_t sinceId, const int32_t timeoutMs)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("waitForEvents", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_waitForEvents_pargs args;
+  args.sinceId = &sinceId;
+  args.timeoutMs = &timeoutMs;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_waitForEvents(DomainEvents& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("waitForEvents") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_waitForEvents_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "waitForEvents failed: unknown result");
+}
+
+void AimClient::startCopyFromRepositoryToDatastore(std::string& _return, const std::string& virtualImageRepositoryPath, const std::string& datastorePath, const std::string& virtualMachineUUID)
+{
+  send_startCopyFromRepositoryToDatastore(virtualImageRepositoryPath, datastorePath, virtualMachineUUID);
+  recv_startCopyFromRepositoryToDatastore(_return);
+}
+
+void AimClient::send_startCopyFromRepositoryToDatastore(const std::string& virtualImageRepositoryPath, const std::string& datastorePath, const std::string& virtualMachineUUID)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("startCopyFromRepositoryToDatastore", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_startCopyFromRepositoryToDatastore_pargs args;
+  args.virtualImageRepositoryPath = &virtualImageRepositoryPath;
+  args.datastorePath = &datastorePath;
+  args.virtualMachineUUID = &virtualMachineUUID;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_startCopyFromRepositoryToDatastore(std::string& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("startCopyFromRepositoryToDatastore") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_startCopyFromRepositoryToDatastore_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.re) {
+    throw result.re;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "startCopyFromRepositoryToDatastore failed: unknown result");
+}
+
+void AimClient::startCopyFromDatastoreToRepository(std::string& _return, const std::string& virtualMachineUUID, const std::string& snapshot, const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath)
+{
+  send_startCopyFromDatastoreToRepository(virtualMachineUUID, snapshot, destinationRepositoryPath, sourceDatastorePath);
+  recv_startCopyFromDatastoreToRepository(_return);
+}
+
+void AimClient::send_startCopyFromDatastoreToRepository(const std::string& virtualMachineUUID, const std::string& snapshot, const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("startCopyFromDatastoreToRepository", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_startCopyFromDatastoreToRepository_pargs args;
+  args.virtualMachineUUID = &virtualMachineUUID;
+  args.snapshot = &snapshot;
+  args.destinationRepositoryPath = &destinationRepositoryPath;
+  args.sourceDatastorePath = &sourceDatastorePath;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_startCopyFromDatastoreToRepository(std::string& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("startCopyFromDatastoreToRepository") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_startCopyFromDatastoreToRepository_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.re) {
+    throw result.re;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "startCopyFromDatastoreToRepository failed: unknown result");
+}
+
+void AimClient::startCopy(std::string& _return, const std::string& source, const std::string& destination)
+{
+  send_startCopy(source, destination);
+  recv_startCopy(_return);
+}
+
+void AimClient::send_startCopy(const std::string& source, const std::string& destination)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("getNetInterfaces", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("startCopy", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_getNetInterfaces_pargs args;
+  Aim_startCopy_pargs args;
+  args.source = &source;
+  args.destination = &destination;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -7743,7 +18037,7 @@ void AimClient::send_getNetInterfaces()
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_getNetInterfaces(std::vector<NetInterface> & _return)
+void AimClient::recv_startCopy(std::string& _return)
 {
 
   int32_t rseqid = 0;
@@ -7763,12 +18057,12 @@ void AimClient::recv_getNetInterfaces(std::vector<NetInterface> & _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("getNetInterfaces") != 0) {
+  if (fname.compare("startCopy") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_getNetInterfaces_presult result;
+  Aim_startCopy_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -7781,24 +18075,28 @@ void AimClient::recv_getNetInterfaces(std::vector<NetInterface> & _return)
   if (result.__isset.re) {
     throw result.re;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getNetInterfaces failed: unknown result");
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "startCopy failed: unknown result");
 }
 
-void AimClient::copyFromRepositoryToDatastore(const std::string& virtualImageRepositoryPath, const std::string& datastorePath, const std::string& virtualMachineUUID)
+void AimClient::getJobStatus(JobStatus& _return, const std::string& jobId)
 {
-  send_copyFromRepositoryToDatastore(virtualImageRepositoryPath, datastorePath, virtualMachineUUID);
-  recv_copyFromRepositoryToDatastore();
+  send_getJobStatus(jobId);
+  recv_getJobStatus(_return);
 }
 
-void AimClient::send_copyFromRepositoryToDatastore(const std::string& virtualImageRepositoryPath, const std::string& datastorePath, const std::string& virtualMachineUUID)
+void AimClient::send_getJobStatus(const std::string& jobId)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("copyFromRepositoryToDatastore", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("getJobStatus", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_copyFromRepositoryToDatastore_pargs args;
-  args.virtualImageRepositoryPath = &virtualImageRepositoryPath;
-  args.datastorePath = &datastorePath;
-  args.virtualMachineUUID = &virtualMachineUUID;
+  Aim_getJobStatus_pargs args;
+  args.jobId = &jobId;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -7806,7 +18104,7 @@ void AimClient::send_copyFromRepositoryToDatastore(const std::string& virtualIma
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_copyFromRepositoryToDatastore()
+void AimClient::recv_getJobStatus(JobStatus& _return)
 {
 
   int32_t rseqid = 0;
@@ -7826,36 +18124,46 @@ void AimClient::recv_copyFromRepositoryToDatastore()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("copyFromRepositoryToDatastore") != 0) {
+  if (fname.compare("getJobStatus") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_copyFromRepositoryToDatastore_presult result;
+  Aim_getJobStatus_presult result;
+  result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
   if (result.__isset.re) {
     throw result.re;
   }
-  return;
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getJobStatus failed: unknown result");
 }
 
-void AimClient::deleteVirtualImageFromDatastore(const std::string& datastorePath, const std::string& virtualMachineUUID)
+void AimClient::cancelJob(const std::string& jobId)
 {
-  send_deleteVirtualImageFromDatastore(datastorePath, virtualMachineUUID);
-  recv_deleteVirtualImageFromDatastore();
+  send_cancelJob(jobId);
+  recv_cancelJob();
 }
 
-void AimClient::send_deleteVirtualImageFromDatastore(const std::string& datastorePath, const std::string& virtualMachineUUID)
+void AimClient::send_cancelJob(const std::string& jobId)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("deleteVirtualImageFromDatastore", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("cancelJob", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_deleteVirtualImageFromDatastore_pargs args;
-  args.datastorePath = &datastorePath;
-  args.virtualMachineUUID = &virtualMachineUUID;
+  Aim_cancelJob_pargs args;
+  args.jobId = &jobId;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -7863,7 +18171,7 @@ void AimClient::send_deleteVirtualImageFromDatastore(const std::string& datastor
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_deleteVirtualImageFromDatastore()
+void AimClient::recv_cancelJob()
 {
 
   int32_t rseqid = 0;
@@ -7883,12 +18191,12 @@ void AimClient::recv_deleteVirtualImageFromDatastore()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("deleteVirtualImageFromDatastore") != 0) {
+  if (fname.compare("cancelJob") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_deleteVirtualImageFromDatastore_presult result;
+  Aim_cancelJob_presult result;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
@@ -7896,25 +18204,27 @@ void AimClient::recv_deleteVirtualImageFromDatastore()
   if (result.__isset.re) {
     throw result.re;
   }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
   return;
 }
 
-void AimClient::copyFromDatastoreToRepository(const std::string& virtualMachineUUID, const std::string& snapshot, const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath)
+void AimClient::getServerStats(ServerStats& _return)
 {
-  send_copyFromDatastoreToRepository(virtualMachineUUID, snapshot, destinationRepositoryPath, sourceDatastorePath);
-  recv_copyFromDatastoreToRepository();
+  send_getServerStats();
+  recv_getServerStats(_return);
 }
 
-void AimClient::send_copyFromDatastoreToRepository(const std::string& virtualMachineUUID, const std::string& snapshot, const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath)
+void AimClient::send_getServerStats()
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("copyFromDatastoreToRepository", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("getServerStats", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_copyFromDatastoreToRepository_pargs args;
-  args.virtualMachineUUID = &virtualMachineUUID;
-  args.snapshot = &snapshot;
-  args.destinationRepositoryPath = &destinationRepositoryPath;
-  args.sourceDatastorePath = &sourceDatastorePath;
+  Aim_getServerStats_pargs args;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -7922,7 +18232,7 @@ void AimClient::send_copyFromDatastoreToRepository(const std::string& virtualMac
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_copyFromDatastoreToRepository()
+void AimClient::recv_getServerStats(ServerStats& _return)
 {
 
   int32_t rseqid = 0;
@@ -7942,36 +18252,110 @@ void AimClient::recv_copyFromDatastoreToRepository()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("copyFromDatastoreToRepository") != 0) {
+  if (fname.compare("getServerStats") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_copyFromDatastoreToRepository_presult result;
+  Aim_getServerStats_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getServerStats failed: unknown result");
+}
+
+void AimClient::openUpload(std::string& _return, const std::string& path, const int64_t size)
+{
+  send_openUpload(path, size);
+  recv_openUpload(_return);
+}
+
+void AimClient::send_openUpload(const std::string& path, const int64_t size)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("openUpload", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Aim_openUpload_pargs args;
+  args.path = &path;
+  args.size = &size;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void AimClient::recv_openUpload(std::string& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("openUpload") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Aim_openUpload_presult result;
+  result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
   if (result.__isset.re) {
     throw result.re;
   }
-  return;
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "openUpload failed: unknown result");
 }
 
-void AimClient::instanceDisk(const std::string& source, const std::string& destination)
+void AimClient::writeChunk(const std::string& uploadId, const int64_t offset, const std::string& data)
 {
-  send_instanceDisk(source, destination);
-  recv_instanceDisk();
+  send_writeChunk(uploadId, offset, data);
+  recv_writeChunk();
 }
 
-void AimClient::send_instanceDisk(const std::string& source, const std::string& destination)
+void AimClient::send_writeChunk(const std::string& uploadId, const int64_t offset, const std::string& data)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("instanceDisk", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("writeChunk", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_instanceDisk_pargs args;
-  args.source = &source;
-  args.destination = &destination;
+  Aim_writeChunk_pargs args;
+  args.uploadId = &uploadId;
+  args.offset = &offset;
+  args.data = &data;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -7979,7 +18363,7 @@ void AimClient::send_instanceDisk(const std::string& source, const std::string&
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_instanceDisk()
+void AimClient::recv_writeChunk()
 {
 
   int32_t rseqid = 0;
@@ -7999,12 +18383,12 @@ void AimClient::recv_instanceDisk()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("instanceDisk") != 0) {
+  if (fname.compare("writeChunk") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_instanceDisk_presult result;
+  Aim_writeChunk_presult result;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
@@ -8012,23 +18396,29 @@ void AimClient::recv_instanceDisk()
   if (result.__isset.re) {
     throw result.re;
   }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
   return;
 }
 
-void AimClient::renameDisk(const std::string& oldPath, const std::string& newPath)
+void AimClient::commitUpload(const std::string& uploadId, const int64_t crc32)
 {
-  send_renameDisk(oldPath, newPath);
-  recv_renameDisk();
+  send_commitUpload(uploadId, crc32);
+  recv_commitUpload();
 }
 
-void AimClient::send_renameDisk(const std::string& oldPath, const std::string& newPath)
+void AimClient::send_commitUpload(const std::string& uploadId, const int64_t crc32)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("renameDisk", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("commitUpload", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_renameDisk_pargs args;
-  args.oldPath = &oldPath;
-  args.newPath = &newPath;
+  Aim_commitUpload_pargs args;
+  args.uploadId = &uploadId;
+  args.crc32 = &crc32;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -8036,7 +18426,7 @@ void AimClient::send_renameDisk(const std::string& oldPath, const std::string& n
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_renameDisk()
+void AimClient::recv_commitUpload()
 {
 
   int32_t rseqid = 0;
@@ -8056,12 +18446,12 @@ void AimClient::recv_renameDisk()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("renameDisk") != 0) {
+  if (fname.compare("commitUpload") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_renameDisk_presult result;
+  Aim_commitUpload_presult result;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
@@ -8069,24 +18459,28 @@ void AimClient::recv_renameDisk()
   if (result.__isset.re) {
     throw result.re;
   }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
   return;
 }
 
-void AimClient::createVLAN(const int32_t vlanTag, const std::string& vlanInterface, const std::string& bridgeInterface)
+void AimClient::abortUpload(const std::string& uploadId)
 {
-  send_createVLAN(vlanTag, vlanInterface, bridgeInterface);
-  recv_createVLAN();
+  send_abortUpload(uploadId);
+  recv_abortUpload();
 }
 
-void AimClient::send_createVLAN(const int32_t vlanTag, const std::string& vlanInterface, const std::string& bridgeInterface)
+void AimClient::send_abortUpload(const std::string& uploadId)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("createVLAN", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("abortUpload", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_createVLAN_pargs args;
-  args.vlanTag = &vlanTag;
-  args.vlanInterface = &vlanInterface;
-  args.bridgeInterface = &bridgeInterface;
+  Aim_abortUpload_pargs args;
+  args.uploadId = &uploadId;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -8094,7 +18488,7 @@ void AimClient::send_createVLAN(const int32_t vlanTag, const std::string& vlanIn
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_createVLAN()
+void AimClient::recv_abortUpload()
 {
 
   int32_t rseqid = 0;
@@ -8114,37 +18508,42 @@ void AimClient::recv_createVLAN()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("createVLAN") != 0) {
+  if (fname.compare("abortUpload") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_createVLAN_presult result;
+  Aim_abortUpload_presult result;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
-  if (result.__isset.ve) {
-    throw result.ve;
+  if (result.__isset.re) {
+    throw result.re;
+  }
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
   }
   return;
 }
 
-void AimClient::deleteVLAN(const int32_t vlanTag, const std::string& vlanInterface, const std::string& bridgeInterface)
+void AimClient::powerOnMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options)
 {
-  send_deleteVLAN(vlanTag, vlanInterface, bridgeInterface);
-  recv_deleteVLAN();
+  send_powerOnMany(domainNames, options);
+  recv_powerOnMany(_return);
 }
 
-void AimClient::send_deleteVLAN(const int32_t vlanTag, const std::string& vlanInterface, const std::string& bridgeInterface)
+void AimClient::send_powerOnMany(const std::vector<std::string> & domainNames, const BatchOptions& options)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("deleteVLAN", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("powerOnMany", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_deleteVLAN_pargs args;
-  args.vlanTag = &vlanTag;
-  args.vlanInterface = &vlanInterface;
-  args.bridgeInterface = &bridgeInterface;
+  Aim_powerOnMany_pargs args;
+  args.domainNames = &domainNames;
+  args.options = &options;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -8152,7 +18551,7 @@ void AimClient::send_deleteVLAN(const int32_t vlanTag, const std::string& vlanIn
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_deleteVLAN()
+void AimClient::recv_powerOnMany(std::vector<DomainResult> & _return)
 {
 
   int32_t rseqid = 0;
@@ -8172,34 +18571,44 @@ void AimClient::recv_deleteVLAN()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("deleteVLAN") != 0) {
+  if (fname.compare("powerOnMany") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_deleteVLAN_presult result;
+  Aim_powerOnMany_presult result;
+  result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
-  if (result.__isset.ve) {
-    throw result.ve;
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
-  return;
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "powerOnMany failed: unknown result");
 }
 
-void AimClient::checkVLANConfiguration()
+void AimClient::powerOffMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options)
 {
-  send_checkVLANConfiguration();
-  recv_checkVLANConfiguration();
+  send_powerOffMany(domainNames, options);
+  recv_powerOffMany(_return);
 }
 
-void AimClient::send_checkVLANConfiguration()
+void AimClient::send_powerOffMany(const std::vector<std::string> & domainNames, const BatchOptions& options)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("checkVLANConfiguration", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("powerOffMany", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_checkVLANConfiguration_pargs args;
+  Aim_powerOffMany_pargs args;
+  args.domainNames = &domainNames;
+  args.options = &options;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -8207,7 +18616,7 @@ void AimClient::send_checkVLANConfiguration()
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_checkVLANConfiguration()
+void AimClient::recv_powerOffMany(std::vector<DomainResult> & _return)
 {
 
   int32_t rseqid = 0;
@@ -8227,34 +18636,44 @@ void AimClient::recv_checkVLANConfiguration()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("checkVLANConfiguration") != 0) {
+  if (fname.compare("powerOffMany") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_checkVLANConfiguration_presult result;
+  Aim_powerOffMany_presult result;
+  result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
-  if (result.__isset.ve) {
-    throw result.ve;
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
-  return;
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "powerOffMany failed: unknown result");
 }
 
-void AimClient::getInitiatorIQN(std::string& _return)
+void AimClient::shutdownMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options)
 {
-  send_getInitiatorIQN();
-  recv_getInitiatorIQN(_return);
+  send_shutdownMany(domainNames, options);
+  recv_shutdownMany(_return);
 }
 
-void AimClient::send_getInitiatorIQN()
+void AimClient::send_shutdownMany(const std::vector<std::string> & domainNames, const BatchOptions& options)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("getInitiatorIQN", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("shutdownMany", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_getInitiatorIQN_pargs args;
+  Aim_shutdownMany_pargs args;
+  args.domainNames = &domainNames;
+  args.options = &options;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -8262,7 +18681,7 @@ void AimClient::send_getInitiatorIQN()
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_getInitiatorIQN(std::string& _return)
+void AimClient::recv_shutdownMany(std::vector<DomainResult> & _return)
 {
 
   int32_t rseqid = 0;
@@ -8282,12 +18701,12 @@ void AimClient::recv_getInitiatorIQN(std::string& _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("getInitiatorIQN") != 0) {
+  if (fname.compare("shutdownMany") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_getInitiatorIQN_presult result;
+  Aim_shutdownMany_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -8297,25 +18716,29 @@ void AimClient::recv_getInitiatorIQN(std::string& _return)
     // _return pointer has now been filled
     return;
   }
-  if (result.__isset.se) {
-    throw result.se;
+  if (result.__isset.timeout) {
+    throw result.timeout;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getInitiatorIQN failed: unknown result");
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "shutdownMany failed: unknown result");
 }
 
-void AimClient::rescanISCSI(const std::vector<std::string> & targets)
+void AimClient::resetMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options)
 {
-  send_rescanISCSI(targets);
-  recv_rescanISCSI();
+  send_resetMany(domainNames, options);
+  recv_resetMany(_return);
 }
 
-void AimClient::send_rescanISCSI(const std::vector<std::string> & targets)
+void AimClient::send_resetMany(const std::vector<std::string> & domainNames, const BatchOptions& options)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("rescanISCSI", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("resetMany", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_rescanISCSI_pargs args;
-  args.targets = &targets;
+  Aim_resetMany_pargs args;
+  args.domainNames = &domainNames;
+  args.options = &options;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -8323,7 +18746,7 @@ void AimClient::send_rescanISCSI(const std::vector<std::string> & targets)
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_rescanISCSI()
+void AimClient::recv_resetMany(std::vector<DomainResult> & _return)
 {
 
   int32_t rseqid = 0;
@@ -8343,34 +18766,44 @@ void AimClient::recv_rescanISCSI()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("rescanISCSI") != 0) {
+  if (fname.compare("resetMany") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_rescanISCSI_presult result;
+  Aim_resetMany_presult result;
+  result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
-  if (result.__isset.se) {
-    throw result.se;
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
-  return;
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "resetMany failed: unknown result");
 }
 
-void AimClient::getNodeInfo(NodeInfo& _return)
+void AimClient::pauseMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options)
 {
-  send_getNodeInfo();
-  recv_getNodeInfo(_return);
+  send_pauseMany(domainNames, options);
+  recv_pauseMany(_return);
 }
 
-void AimClient::send_getNodeInfo()
+void AimClient::send_pauseMany(const std::vector<std::string> & domainNames, const BatchOptions& options)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("getNodeInfo", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("pauseMany", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_getNodeInfo_pargs args;
+  Aim_pauseMany_pargs args;
+  args.domainNames = &domainNames;
+  args.options = &options;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -8378,7 +18811,7 @@ void AimClient::send_getNodeInfo()
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_getNodeInfo(NodeInfo& _return)
+void AimClient::recv_pauseMany(std::vector<DomainResult> & _return)
 {
 
   int32_t rseqid = 0;
@@ -8398,12 +18831,12 @@ void AimClient::recv_getNodeInfo(NodeInfo& _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("getNodeInfo") != 0) {
+  if (fname.compare("pauseMany") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_getNodeInfo_presult result;
+  Aim_pauseMany_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -8413,25 +18846,29 @@ void AimClient::recv_getNodeInfo(NodeInfo& _return)
     // _return pointer has now been filled
     return;
   }
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (result.__isset.timeout) {
+    throw result.timeout;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getNodeInfo failed: unknown result");
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "pauseMany failed: unknown result");
 }
 
-void AimClient::defineDomain(const std::string& xmlDesc)
+void AimClient::resumeMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options)
 {
-  send_defineDomain(xmlDesc);
-  recv_defineDomain();
+  send_resumeMany(domainNames, options);
+  recv_resumeMany(_return);
 }
 
-void AimClient::send_defineDomain(const std::string& xmlDesc)
+void AimClient::send_resumeMany(const std::vector<std::string> & domainNames, const BatchOptions& options)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("defineDomain", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("resumeMany", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_defineDomain_pargs args;
-  args.xmlDesc = &xmlDesc;
+  Aim_resumeMany_pargs args;
+  args.domainNames = &domainNames;
+  args.options = &options;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -8439,7 +18876,7 @@ void AimClient::send_defineDomain(const std::string& xmlDesc)
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_defineDomain()
+void AimClient::recv_resumeMany(std::vector<DomainResult> & _return)
 {
 
   int32_t rseqid = 0;
@@ -8459,35 +18896,44 @@ void AimClient::recv_defineDomain()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("defineDomain") != 0) {
+  if (fname.compare("resumeMany") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_defineDomain_presult result;
+  Aim_resumeMany_presult result;
+  result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
   }
-  return;
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "resumeMany failed: unknown result");
 }
 
-void AimClient::undefineDomain(const std::string& domainName)
+void AimClient::shutdownWithDeadline(DomainResult& _return, const std::string& domainName, const int32_t timeoutSec)
 {
-  send_undefineDomain(domainName);
-  recv_undefineDomain();
+  send_shutdownWithDeadline(domainName, timeoutSec);
+  recv_shutdownWithDeadline(_return);
 }
 
-void AimClient::send_undefineDomain(const std::string& domainName)
+void AimClient::send_shutdownWithDeadline(const std::string& domainName, const int32_t timeoutSec)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("undefineDomain", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("shutdownWithDeadline", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_undefineDomain_pargs args;
+  Aim_shutdownWithDeadline_pargs args;
   args.domainName = &domainName;
+  args.timeoutSec = &timeoutSec;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -8495,7 +18941,7 @@ void AimClient::send_undefineDomain(const std::string& domainName)
   oprot_->getTransport()->flush();
 }
 
-void AimClient::recv_undefineDomain()
+void AimClient::recv_shutdownWithDeadline(DomainResult& _return)
 {
 
   int32_t rseqid = 0;
@@ -8515,35 +18961,48 @@ void AimClient::recv_undefineDomain()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("undefineDomain") != 0) {
+  if (fname.compare("shutdownWithDeadline") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Aim_undefineDomain_presult result;
+  Aim_shutdownWithDeadline_presult result;
+  result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
   if (result.__isset.libvirtException) {
     throw result.libvirtException;
   }
-  return;
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "shutdownWithDeadline failed: unknown result");
 }
 
-bool AimClient::existDomain(const std::string& domainName)
+void AimClient::shutdownManyWithDeadline(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const int32_t timeoutSec, const BatchOptions& options)
 {
-  send_existDomain(domainName);
-  return recv_existDomain();
+  send_shutdownManyWithDeadline(domainNames, timeoutSec, options);
+  recv_shutdownManyWithDeadline(_return);
 }
 
-void AimClient::send_existDomain(const std::string& domainName)
+void AimClient::send_shutdownManyWithDeadline(const std::vector<std::string> & domainNames, const int32_t timeoutSec, const BatchOptions& options)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("existDomain", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("shutdownManyWithDeadline", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_existDomain_pargs args;
-  args.domainName = &domainName;
+  Aim_shutdownManyWithDeadline_pargs args;
+  args.domainNames = &domainNames;
+  args.timeoutSec = &timeoutSec;
+  args.options = &options;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -8551,7 +19010,7 @@ void AimClient::send_existDomain(const std::string& domainName)
   oprot_->getTransport()->flush();
 }
 
-bool AimClient::recv_existDomain()
+void AimClient::recv_shutdownManyWithDeadline(std::vector<DomainResult> & _return)
 {
 
   int32_t rseqid = 0;
@@ -8571,37 +19030,46 @@ bool AimClient::recv_existDomain()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("existDomain") != 0) {
+  if (fname.compare("shutdownManyWithDeadline") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  bool _return;
-  Aim_existDomain_presult result;
+  Aim_shutdownManyWithDeadline_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
   if (result.__isset.success) {
-    return _return;
+    // _return pointer has now been filled
+    return;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "existDomain failed: unknown result");
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "shutdownManyWithDeadline failed: unknown result");
 }
 
-DomainState::type AimClient::getDomainState(const std::string& domainName)
+void AimClient::readChunk(FileChunk& _return, const std::string& path, const int64_t offset, const int32_t length, const bool compress)
 {
-  send_getDomainState(domainName);
-  return recv_getDomainState();
+  send_readChunk(path, offset, length, compress);
+  recv_readChunk(_return);
 }
 
-void AimClient::send_getDomainState(const std::string& domainName)
+void AimClient::send_readChunk(const std::string& path, const int64_t offset, const int32_t length, const bool compress)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("getDomainState", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("readChunk", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Aim_getDomainState_pargs args;
-  args.domainName = &domainName;
+  Aim_readChunk_pargs args;
+  args.path = &path;
+  args.offset = &offset;
+  args.length = &length;
+  args.compress = &compress;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -8609,7 +19077,7 @@ void AimClient::send_getDomainState(const std::string& domainName)
   oprot_->getTransport()->flush();
 }
 
-DomainState::type AimClient::recv_getDomainState()
+void AimClient::recv_readChunk(FileChunk& _return)
 {
 
   int32_t rseqid = 0;
@@ -8629,1120 +19097,1524 @@ DomainState::type AimClient::recv_getDomainState()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("getDomainState") != 0) {
+  if (fname.compare("readChunk") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  DomainState::type _return;
-  Aim_getDomainState_presult result;
+  Aim_readChunk_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
   if (result.__isset.success) {
-    return _return;
+    // _return pointer has now been filled
+    return;
   }
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (result.__isset.re) {
+    throw result.re;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDomainState failed: unknown result");
+  if (result.__isset.timeout) {
+    throw result.timeout;
+  }
+  if (result.__isset.overload) {
+    throw result.overload;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "readChunk failed: unknown result");
 }
 
-void AimClient::getDomainInfo(DomainInfo& _return, const std::string& domainName)
+bool AimProcessor::dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext) {
+  ProcessMap::iterator pfn;
+  pfn = processMap_.find(fname);
+  if (pfn == processMap_.end()) {
+    iprot->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot->readMessageEnd();
+    iprot->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(::apache::thrift::TApplicationException::UNKNOWN_METHOD, "Invalid method name: '"+fname+"'");
+    oprot->writeMessageBegin(fname, ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return true;
+  }
+  (this->*(pfn->second))(seqid, iprot, oprot, callContext);
+  return true;
+}
+
+void AimProcessor::process_checkRimpConfiguration(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  send_getDomainInfo(domainName);
-  recv_getDomainInfo(_return);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.checkRimpConfiguration", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.checkRimpConfiguration");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.checkRimpConfiguration");
+  }
+
+  Aim_checkRimpConfiguration_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.checkRimpConfiguration", bytes);
+  }
+
+  Aim_checkRimpConfiguration_result result;
+  try {
+    iface_->checkRimpConfiguration();
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.checkRimpConfiguration");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("checkRimpConfiguration", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.checkRimpConfiguration");
+  }
+
+  oprot->writeMessageBegin("checkRimpConfiguration", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.checkRimpConfiguration", bytes);
+  }
 }
 
-void AimClient::send_getDomainInfo(const std::string& domainName)
+void AimProcessor::process_getDiskFileSize(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("getDomainInfo", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.getDiskFileSize", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDiskFileSize");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.getDiskFileSize");
+  }
+
+  Aim_getDiskFileSize_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.getDiskFileSize", bytes);
+  }
+
+  Aim_getDiskFileSize_result result;
+  try {
+    result.success = iface_->getDiskFileSize(args.virtualImageDatastorePath);
+    result.__isset.success = true;
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.getDiskFileSize");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("getDiskFileSize", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.getDiskFileSize");
+  }
+
+  oprot->writeMessageBegin("getDiskFileSize", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.getDiskFileSize", bytes);
+  }
+}
+
+void AimProcessor::process_getDatastores(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.getDatastores", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDatastores");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.getDatastores");
+  }
+
+  Aim_getDatastores_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.getDatastores", bytes);
+  }
+
+  Aim_getDatastores_result result;
+  try {
+    iface_->getDatastores(result.success);
+    result.__isset.success = true;
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.getDatastores");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("getDatastores", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.getDatastores");
+  }
 
-  Aim_getDomainInfo_pargs args;
-  args.domainName = &domainName;
-  args.write(oprot_);
+  oprot->writeMessageBegin("getDatastores", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.getDatastores", bytes);
+  }
 }
 
-void AimClient::recv_getDomainInfo(DomainInfo& _return)
+void AimProcessor::process_getNetInterfaces(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
-
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.getNetInterfaces", callContext);
   }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getNetInterfaces");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.getNetInterfaces");
   }
-  if (fname.compare("getDomainInfo") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+
+  Aim_getNetInterfaces_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.getNetInterfaces", bytes);
   }
-  Aim_getDomainInfo_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
+  Aim_getNetInterfaces_result result;
+  try {
+    iface_->getNetInterfaces(result.success);
+    result.__isset.success = true;
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.getNetInterfaces");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("getNetInterfaces", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
     return;
   }
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
-  }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDomainInfo failed: unknown result");
-}
-
-void AimClient::getDomains(std::vector<DomainInfo> & _return)
-{
-  send_getDomains();
-  recv_getDomains(_return);
-}
 
-void AimClient::send_getDomains()
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("getDomains", ::apache::thrift::protocol::T_CALL, cseqid);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.getNetInterfaces");
+  }
 
-  Aim_getDomains_pargs args;
-  args.write(oprot_);
+  oprot->writeMessageBegin("getNetInterfaces", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.getNetInterfaces", bytes);
+  }
 }
 
-void AimClient::recv_getDomains(std::vector<DomainInfo> & _return)
+void AimProcessor::process_copyFromRepositoryToDatastore(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
-
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.copyFromRepositoryToDatastore", callContext);
   }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.copyFromRepositoryToDatastore");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.copyFromRepositoryToDatastore");
   }
-  if (fname.compare("getDomains") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+
+  Aim_copyFromRepositoryToDatastore_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.copyFromRepositoryToDatastore", bytes);
   }
-  Aim_getDomains_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
+  Aim_copyFromRepositoryToDatastore_result result;
+  try {
+    iface_->copyFromRepositoryToDatastore(args.virtualImageRepositoryPath, args.datastorePath, args.virtualMachineUUID);
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.copyFromRepositoryToDatastore");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("copyFromRepositoryToDatastore", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
     return;
   }
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.copyFromRepositoryToDatastore");
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDomains failed: unknown result");
-}
 
-void AimClient::powerOn(const std::string& domainName)
-{
-  send_powerOn(domainName);
-  recv_powerOn();
+  oprot->writeMessageBegin("copyFromRepositoryToDatastore", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.copyFromRepositoryToDatastore", bytes);
+  }
 }
 
-void AimClient::send_powerOn(const std::string& domainName)
+void AimProcessor::process_deleteVirtualImageFromDatastore(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("powerOn", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.deleteVirtualImageFromDatastore", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.deleteVirtualImageFromDatastore");
 
-  Aim_powerOn_pargs args;
-  args.domainName = &domainName;
-  args.write(oprot_);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.deleteVirtualImageFromDatastore");
+  }
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  Aim_deleteVirtualImageFromDatastore_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-void AimClient::recv_powerOn()
-{
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.deleteVirtualImageFromDatastore", bytes);
+  }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  Aim_deleteVirtualImageFromDatastore_result result;
+  try {
+    iface_->deleteVirtualImageFromDatastore(args.datastorePath, args.virtualMachineUUID);
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.deleteVirtualImageFromDatastore");
+    }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("powerOn") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  Aim_powerOn_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("deleteVirtualImageFromDatastore", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.deleteVirtualImageFromDatastore");
   }
-  return;
-}
 
-void AimClient::powerOff(const std::string& domainName)
-{
-  send_powerOff(domainName);
-  recv_powerOff();
+  oprot->writeMessageBegin("deleteVirtualImageFromDatastore", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.deleteVirtualImageFromDatastore", bytes);
+  }
 }
 
-void AimClient::send_powerOff(const std::string& domainName)
+void AimProcessor::process_copyFromDatastoreToRepository(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("powerOff", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.copyFromDatastoreToRepository", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.copyFromDatastoreToRepository");
 
-  Aim_powerOff_pargs args;
-  args.domainName = &domainName;
-  args.write(oprot_);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.copyFromDatastoreToRepository");
+  }
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  Aim_copyFromDatastoreToRepository_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-void AimClient::recv_powerOff()
-{
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.copyFromDatastoreToRepository", bytes);
+  }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  Aim_copyFromDatastoreToRepository_result result;
+  try {
+    iface_->copyFromDatastoreToRepository(args.virtualMachineUUID, args.snapshot, args.destinationRepositoryPath, args.sourceDatastorePath);
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.copyFromDatastoreToRepository");
+    }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("powerOff") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("copyFromDatastoreToRepository", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
   }
-  Aim_powerOff_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.copyFromDatastoreToRepository");
   }
-  return;
-}
 
-void AimClient::shutdown(const std::string& domainName)
-{
-  send_shutdown(domainName);
-  recv_shutdown();
+  oprot->writeMessageBegin("copyFromDatastoreToRepository", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.copyFromDatastoreToRepository", bytes);
+  }
 }
 
-void AimClient::send_shutdown(const std::string& domainName)
+void AimProcessor::process_instanceDisk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("shutdown", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.instanceDisk", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.instanceDisk");
 
-  Aim_shutdown_pargs args;
-  args.domainName = &domainName;
-  args.write(oprot_);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.instanceDisk");
+  }
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  Aim_instanceDisk_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-void AimClient::recv_shutdown()
-{
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.instanceDisk", bytes);
+  }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  Aim_instanceDisk_result result;
+  try {
+    iface_->instanceDisk(args.source, args.destination);
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.instanceDisk");
+    }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("shutdown") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("instanceDisk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
   }
-  Aim_shutdown_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.instanceDisk");
   }
-  return;
-}
 
-void AimClient::reset(const std::string& domainName)
-{
-  send_reset(domainName);
-  recv_reset();
+  oprot->writeMessageBegin("instanceDisk", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.instanceDisk", bytes);
+  }
 }
 
-void AimClient::send_reset(const std::string& domainName)
+void AimProcessor::process_renameDisk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("reset", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.renameDisk", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.renameDisk");
 
-  Aim_reset_pargs args;
-  args.domainName = &domainName;
-  args.write(oprot_);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.renameDisk");
+  }
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  Aim_renameDisk_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-void AimClient::recv_reset()
-{
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.renameDisk", bytes);
+  }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  Aim_renameDisk_result result;
+  try {
+    iface_->renameDisk(args.oldPath, args.newPath);
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.renameDisk");
+    }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("reset") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("renameDisk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
   }
-  Aim_reset_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.renameDisk");
   }
-  return;
-}
 
-void AimClient::pause(const std::string& domainName)
-{
-  send_pause(domainName);
-  recv_pause();
+  oprot->writeMessageBegin("renameDisk", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.renameDisk", bytes);
+  }
 }
 
-void AimClient::send_pause(const std::string& domainName)
+void AimProcessor::process_createVLAN(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("pause", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.createVLAN", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.createVLAN");
 
-  Aim_pause_pargs args;
-  args.domainName = &domainName;
-  args.write(oprot_);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.createVLAN");
+  }
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  Aim_createVLAN_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-void AimClient::recv_pause()
-{
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.createVLAN", bytes);
+  }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  Aim_createVLAN_result result;
+  try {
+    iface_->createVLAN(args.vlanTag, args.vlanInterface, args.bridgeInterface);
+  } catch (VLanException &ve) {
+    result.ve = ve;
+    result.__isset.ve = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.createVLAN");
+    }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("pause") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("createVLAN", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
   }
-  Aim_pause_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.createVLAN");
   }
-  return;
-}
 
-void AimClient::resume(const std::string& domainName)
-{
-  send_resume(domainName);
-  recv_resume();
+  oprot->writeMessageBegin("createVLAN", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.createVLAN", bytes);
+  }
 }
 
-void AimClient::send_resume(const std::string& domainName)
+void AimProcessor::process_deleteVLAN(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("resume", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.deleteVLAN", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.deleteVLAN");
 
-  Aim_resume_pargs args;
-  args.domainName = &domainName;
-  args.write(oprot_);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.deleteVLAN");
+  }
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  Aim_deleteVLAN_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-void AimClient::recv_resume()
-{
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.deleteVLAN", bytes);
+  }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  Aim_deleteVLAN_result result;
+  try {
+    iface_->deleteVLAN(args.vlanTag, args.vlanInterface, args.bridgeInterface);
+  } catch (VLanException &ve) {
+    result.ve = ve;
+    result.__isset.ve = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.deleteVLAN");
+    }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("deleteVLAN", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
   }
-  if (fname.compare("resume") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.deleteVLAN");
   }
-  Aim_resume_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  oprot->writeMessageBegin("deleteVLAN", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.deleteVLAN", bytes);
   }
-  return;
 }
 
-void AimClient::createISCSIStoragePool(const std::string& name, const std::string& host, const std::string& iqn, const std::string& targetPath)
+void AimProcessor::process_checkVLANConfiguration(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  send_createISCSIStoragePool(name, host, iqn, targetPath);
-  recv_createISCSIStoragePool();
-}
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.checkVLANConfiguration", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.checkVLANConfiguration");
 
-void AimClient::send_createISCSIStoragePool(const std::string& name, const std::string& host, const std::string& iqn, const std::string& targetPath)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("createISCSIStoragePool", ::apache::thrift::protocol::T_CALL, cseqid);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.checkVLANConfiguration");
+  }
 
-  Aim_createISCSIStoragePool_pargs args;
-  args.name = &name;
-  args.host = &host;
-  args.iqn = &iqn;
-  args.targetPath = &targetPath;
-  args.write(oprot_);
+  Aim_checkVLANConfiguration_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.checkVLANConfiguration", bytes);
+  }
+
+  Aim_checkVLANConfiguration_result result;
+  try {
+    iface_->checkVLANConfiguration();
+  } catch (VLanException &ve) {
+    result.ve = ve;
+    result.__isset.ve = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.checkVLANConfiguration");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("checkVLANConfiguration", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.checkVLANConfiguration");
+  }
+
+  oprot->writeMessageBegin("checkVLANConfiguration", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.checkVLANConfiguration", bytes);
+  }
 }
 
-void AimClient::recv_createISCSIStoragePool()
+void AimProcessor::process_getInitiatorIQN(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.getInitiatorIQN", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getInitiatorIQN");
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
-
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.getInitiatorIQN");
   }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+
+  Aim_getInitiatorIQN_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.getInitiatorIQN", bytes);
   }
-  if (fname.compare("createISCSIStoragePool") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+
+  Aim_getInitiatorIQN_result result;
+  try {
+    iface_->getInitiatorIQN(result.success);
+    result.__isset.success = true;
+  } catch (StorageException &se) {
+    result.se = se;
+    result.__isset.se = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.getInitiatorIQN");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("getInitiatorIQN", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
   }
-  Aim_createISCSIStoragePool_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.getInitiatorIQN");
   }
-  return;
-}
 
-void AimClient::createNFSStoragePool(const std::string& name, const std::string& host, const std::string& dir, const std::string& targetPath)
-{
-  send_createNFSStoragePool(name, host, dir, targetPath);
-  recv_createNFSStoragePool();
+  oprot->writeMessageBegin("getInitiatorIQN", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.getInitiatorIQN", bytes);
+  }
 }
 
-void AimClient::send_createNFSStoragePool(const std::string& name, const std::string& host, const std::string& dir, const std::string& targetPath)
+void AimProcessor::process_rescanISCSI(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("createNFSStoragePool", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.rescanISCSI", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.rescanISCSI");
 
-  Aim_createNFSStoragePool_pargs args;
-  args.name = &name;
-  args.host = &host;
-  args.dir = &dir;
-  args.targetPath = &targetPath;
-  args.write(oprot_);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.rescanISCSI");
+  }
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  Aim_rescanISCSI_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-void AimClient::recv_createNFSStoragePool()
-{
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.rescanISCSI", bytes);
+  }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  Aim_rescanISCSI_result result;
+  try {
+    iface_->rescanISCSI(args.targets);
+  } catch (StorageException &se) {
+    result.se = se;
+    result.__isset.se = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.rescanISCSI");
+    }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("createNFSStoragePool") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("rescanISCSI", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
   }
-  Aim_createNFSStoragePool_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.rescanISCSI");
   }
-  return;
-}
 
-void AimClient::createDirStoragePool(const std::string& name, const std::string& targetPath)
-{
-  send_createDirStoragePool(name, targetPath);
-  recv_createDirStoragePool();
+  oprot->writeMessageBegin("rescanISCSI", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.rescanISCSI", bytes);
+  }
 }
 
-void AimClient::send_createDirStoragePool(const std::string& name, const std::string& targetPath)
+void AimProcessor::process_getNodeInfo(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("createDirStoragePool", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.getNodeInfo", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getNodeInfo");
 
-  Aim_createDirStoragePool_pargs args;
-  args.name = &name;
-  args.targetPath = &targetPath;
-  args.write(oprot_);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.getNodeInfo");
+  }
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  Aim_getNodeInfo_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-void AimClient::recv_createDirStoragePool()
-{
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.getNodeInfo", bytes);
+  }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  Aim_getNodeInfo_result result;
+  try {
+    iface_->getNodeInfo(result.success);
+    result.__isset.success = true;
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.getNodeInfo");
+    }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("createDirStoragePool") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("getNodeInfo", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
   }
-  Aim_createDirStoragePool_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.getNodeInfo");
   }
-  return;
-}
 
-void AimClient::createDisk(const std::string& poolName, const std::string& name, const double capacityInKb, const double allocationInKb, const std::string& format)
-{
-  send_createDisk(poolName, name, capacityInKb, allocationInKb, format);
-  recv_createDisk();
+  oprot->writeMessageBegin("getNodeInfo", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.getNodeInfo", bytes);
+  }
 }
 
-void AimClient::send_createDisk(const std::string& poolName, const std::string& name, const double capacityInKb, const double allocationInKb, const std::string& format)
+void AimProcessor::process_defineDomain(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("createDisk", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.defineDomain", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.defineDomain");
 
-  Aim_createDisk_pargs args;
-  args.poolName = &poolName;
-  args.name = &name;
-  args.capacityInKb = &capacityInKb;
-  args.allocationInKb = &allocationInKb;
-  args.format = &format;
-  args.write(oprot_);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.defineDomain");
+  }
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  Aim_defineDomain_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-void AimClient::recv_createDisk()
-{
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.defineDomain", bytes);
+  }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  Aim_defineDomain_result result;
+  try {
+    iface_->defineDomain(args.xmlDesc);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.defineDomain");
+    }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("createDisk") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("defineDomain", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
   }
-  Aim_createDisk_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.defineDomain");
   }
-  return;
-}
 
-void AimClient::deleteDisk(const std::string& poolName, const std::string& name)
-{
-  send_deleteDisk(poolName, name);
-  recv_deleteDisk();
+  oprot->writeMessageBegin("defineDomain", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.defineDomain", bytes);
+  }
 }
 
-void AimClient::send_deleteDisk(const std::string& poolName, const std::string& name)
+void AimProcessor::process_undefineDomain(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("deleteDisk", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.undefineDomain", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.undefineDomain");
 
-  Aim_deleteDisk_pargs args;
-  args.poolName = &poolName;
-  args.name = &name;
-  args.write(oprot_);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.undefineDomain");
+  }
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  Aim_undefineDomain_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-void AimClient::recv_deleteDisk()
-{
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.undefineDomain", bytes);
+  }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  Aim_undefineDomain_result result;
+  try {
+    iface_->undefineDomain(args.domainName);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.undefineDomain");
+    }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("deleteDisk") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("undefineDomain", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
   }
-  Aim_deleteDisk_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.undefineDomain");
   }
-  return;
-}
 
-void AimClient::resizeVol(const std::string& poolName, const std::string& name, const double capacityInKb)
-{
-  send_resizeVol(poolName, name, capacityInKb);
-  recv_resizeVol();
+  oprot->writeMessageBegin("undefineDomain", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.undefineDomain", bytes);
+  }
 }
 
-void AimClient::send_resizeVol(const std::string& poolName, const std::string& name, const double capacityInKb)
+void AimProcessor::process_existDomain(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("resizeVol", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.existDomain", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.existDomain");
 
-  Aim_resizeVol_pargs args;
-  args.poolName = &poolName;
-  args.name = &name;
-  args.capacityInKb = &capacityInKb;
-  args.write(oprot_);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.existDomain");
+  }
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  Aim_existDomain_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-void AimClient::recv_resizeVol()
-{
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.existDomain", bytes);
+  }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  Aim_existDomain_result result;
+  try {
+    result.success = iface_->existDomain(args.domainName);
+    result.__isset.success = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.existDomain");
+    }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-  }
-  if (fname.compare("resizeVol") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("existDomain", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
   }
-  Aim_resizeVol_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.existDomain");
   }
-  return;
-}
 
-void AimClient::resizeDisk(const std::string& domainName, const std::string& diskPath, const double diskSizeInKb)
-{
-  send_resizeDisk(domainName, diskPath, diskSizeInKb);
-  recv_resizeDisk();
+  oprot->writeMessageBegin("existDomain", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.existDomain", bytes);
+  }
 }
 
-void AimClient::send_resizeDisk(const std::string& domainName, const std::string& diskPath, const double diskSizeInKb)
+void AimProcessor::process_getDomainState(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("resizeDisk", ::apache::thrift::protocol::T_CALL, cseqid);
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.getDomainState", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDomainState");
 
-  Aim_resizeDisk_pargs args;
-  args.domainName = &domainName;
-  args.diskPath = &diskPath;
-  args.diskSizeInKb = &diskSizeInKb;
-  args.write(oprot_);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.getDomainState");
+  }
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  Aim_getDomainState_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-void AimClient::recv_resizeDisk()
-{
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.getDomainState", bytes);
+  }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+  Aim_getDomainState_result result;
+  try {
+    result.success = iface_->getDomainState(args.domainName);
+    result.__isset.success = true;
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.getDomainState");
+    }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
-  }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("getDomainState", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
   }
-  if (fname.compare("resizeDisk") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.getDomainState");
   }
-  Aim_resizeDisk_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+  oprot->writeMessageBegin("getDomainState", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.getDomainState", bytes);
   }
-  return;
 }
 
-void AimClient::getDomainBlockInfo(DomainBlockInfo& _return, const std::string& domainName, const std::string& diskPath)
+void AimProcessor::process_getDomainInfo(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-  send_getDomainBlockInfo(domainName, diskPath);
-  recv_getDomainBlockInfo(_return);
-}
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.getDomainInfo", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDomainInfo");
 
-void AimClient::send_getDomainBlockInfo(const std::string& domainName, const std::string& diskPath)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("getDomainBlockInfo", ::apache::thrift::protocol::T_CALL, cseqid);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.getDomainInfo");
+  }
 
-  Aim_getDomainBlockInfo_pargs args;
-  args.domainName = &domainName;
-  args.diskPath = &diskPath;
-  args.write(oprot_);
+  Aim_getDomainInfo_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
-}
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.getDomainInfo", bytes);
+  }
 
-void AimClient::recv_getDomainBlockInfo(DomainBlockInfo& _return)
-{
+  Aim_getDomainInfo_result result;
+  try {
+    iface_->getDomainInfo(result.success, args.domainName);
+    result.__isset.success = true;
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.getDomainInfo");
+    }
 
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("getDomainInfo", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
 
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.getDomainInfo");
   }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+
+  oprot->writeMessageBegin("getDomainInfo", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.getDomainInfo", bytes);
   }
-  if (fname.compare("getDomainBlockInfo") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+}
+
+void AimProcessor::process_getDomains(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.getDomains", callContext);
   }
-  Aim_getDomainBlockInfo_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDomains");
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.getDomains");
   }
-  if (result.__isset.libvirtException) {
-    throw result.libvirtException;
+
+  Aim_getDomains_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.getDomains", bytes);
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDomainBlockInfo failed: unknown result");
-}
 
-void AimClient::getDatapoints(std::vector<Measure> & _return, const std::string& domainName, const int32_t timestamp)
-{
-  send_getDatapoints(domainName, timestamp);
-  recv_getDatapoints(_return);
-}
+  Aim_getDomains_result result;
+  try {
+    iface_->getDomains(result.success);
+    result.__isset.success = true;
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.getDomains");
+    }
 
-void AimClient::send_getDatapoints(const std::string& domainName, const int32_t timestamp)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("getDatapoints", ::apache::thrift::protocol::T_CALL, cseqid);
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("getDomains", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.getDomains");
+  }
 
-  Aim_getDatapoints_pargs args;
-  args.domainName = &domainName;
-  args.timestamp = &timestamp;
-  args.write(oprot_);
+  oprot->writeMessageBegin("getDomains", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.getDomains", bytes);
+  }
 }
 
-void AimClient::recv_getDatapoints(std::vector<Measure> & _return)
+void AimProcessor::process_powerOn(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
-
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.powerOn", callContext);
   }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.powerOn");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.powerOn");
   }
-  if (fname.compare("getDatapoints") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+
+  Aim_powerOn_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.powerOn", bytes);
   }
-  Aim_getDatapoints_presult result;
-  result.success = &_return;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
+  Aim_powerOn_result result;
+  try {
+    iface_->powerOn(args.domainName);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.powerOn");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("powerOn", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
     return;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "getDatapoints failed: unknown result");
-}
-
-void AimClient::upload(const BinaryFile& file, const std::string& path)
-{
-  send_upload(file, path);
-  recv_upload();
-}
 
-void AimClient::send_upload(const BinaryFile& file, const std::string& path)
-{
-  int32_t cseqid = 0;
-  oprot_->writeMessageBegin("upload", ::apache::thrift::protocol::T_CALL, cseqid);
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.powerOn");
+  }
 
-  Aim_upload_pargs args;
-  args.file = &file;
-  args.path = &path;
-  args.write(oprot_);
+  oprot->writeMessageBegin("powerOn", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
 
-  oprot_->writeMessageEnd();
-  oprot_->getTransport()->writeEnd();
-  oprot_->getTransport()->flush();
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.powerOn", bytes);
+  }
 }
 
-void AimClient::recv_upload()
+void AimProcessor::process_powerOff(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
-
-  int32_t rseqid = 0;
-  std::string fname;
-  ::apache::thrift::protocol::TMessageType mtype;
-
-  iprot_->readMessageBegin(fname, mtype, rseqid);
-  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
-    ::apache::thrift::TApplicationException x;
-    x.read(iprot_);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
-    throw x;
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("Aim.powerOff", callContext);
   }
-  if (mtype != ::apache::thrift::protocol::T_REPLY) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.powerOff");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "Aim.powerOff");
   }
-  if (fname.compare("upload") != 0) {
-    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot_->readMessageEnd();
-    iprot_->getTransport()->readEnd();
+
+  Aim_powerOff_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "Aim.powerOff", bytes);
   }
-  Aim_upload_presult result;
-  result.read(iprot_);
-  iprot_->readMessageEnd();
-  iprot_->getTransport()->readEnd();
 
-  return;
-}
+  Aim_powerOff_result result;
+  try {
+    iface_->powerOff(args.domainName);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "Aim.powerOff");
+    }
 
-bool AimProcessor::dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext) {
-  ProcessMap::iterator pfn;
-  pfn = processMap_.find(fname);
-  if (pfn == processMap_.end()) {
-    iprot->skip(::apache::thrift::protocol::T_STRUCT);
-    iprot->readMessageEnd();
-    iprot->getTransport()->readEnd();
-    ::apache::thrift::TApplicationException x(::apache::thrift::TApplicationException::UNKNOWN_METHOD, "Invalid method name: '"+fname+"'");
-    oprot->writeMessageBegin(fname, ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("powerOff", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
     oprot->getTransport()->flush();
-    return true;
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "Aim.powerOff");
+  }
+
+  oprot->writeMessageBegin("powerOff", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "Aim.powerOff", bytes);
   }
-  (this->*(pfn->second))(seqid, iprot, oprot, callContext);
-  return true;
 }
 
-void AimProcessor::process_checkRimpConfiguration(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_shutdown(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.checkRimpConfiguration", callContext);
+    ctx = this->eventHandler_->getContext("Aim.shutdown", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.checkRimpConfiguration");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.shutdown");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.checkRimpConfiguration");
+    this->eventHandler_->preRead(ctx, "Aim.shutdown");
   }
 
-  Aim_checkRimpConfiguration_args args;
+  Aim_shutdown_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.checkRimpConfiguration", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.shutdown", bytes);
   }
 
-  Aim_checkRimpConfiguration_result result;
+  Aim_shutdown_result result;
   try {
-    iface_->checkRimpConfiguration();
-  } catch (RimpException &re) {
-    result.re = re;
-    result.__isset.re = true;
+    iface_->shutdown(args.domainName);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.checkRimpConfiguration");
+      this->eventHandler_->handlerError(ctx, "Aim.shutdown");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("checkRimpConfiguration", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("shutdown", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -9751,55 +20623,60 @@ void AimProcessor::process_checkRimpConfiguration(int32_t seqid, ::apache::thrif
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.checkRimpConfiguration");
+    this->eventHandler_->preWrite(ctx, "Aim.shutdown");
   }
 
-  oprot->writeMessageBegin("checkRimpConfiguration", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("shutdown", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.checkRimpConfiguration", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.shutdown", bytes);
   }
 }
 
-void AimProcessor::process_getDiskFileSize(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_reset(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.getDiskFileSize", callContext);
+    ctx = this->eventHandler_->getContext("Aim.reset", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDiskFileSize");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.reset");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.getDiskFileSize");
+    this->eventHandler_->preRead(ctx, "Aim.reset");
   }
 
-  Aim_getDiskFileSize_args args;
+  Aim_reset_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.getDiskFileSize", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.reset", bytes);
   }
 
-  Aim_getDiskFileSize_result result;
+  Aim_reset_result result;
   try {
-    result.success = iface_->getDiskFileSize(args.virtualImageDatastorePath);
-    result.__isset.success = true;
-  } catch (RimpException &re) {
-    result.re = re;
-    result.__isset.re = true;
+    iface_->reset(args.domainName);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.getDiskFileSize");
+      this->eventHandler_->handlerError(ctx, "Aim.reset");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("getDiskFileSize", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("reset", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -9808,55 +20685,60 @@ void AimProcessor::process_getDiskFileSize(int32_t seqid, ::apache::thrift::prot
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.getDiskFileSize");
+    this->eventHandler_->preWrite(ctx, "Aim.reset");
   }
 
-  oprot->writeMessageBegin("getDiskFileSize", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("reset", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.getDiskFileSize", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.reset", bytes);
   }
 }
 
-void AimProcessor::process_getDatastores(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_pause(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.getDatastores", callContext);
+    ctx = this->eventHandler_->getContext("Aim.pause", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDatastores");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.pause");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.getDatastores");
+    this->eventHandler_->preRead(ctx, "Aim.pause");
   }
 
-  Aim_getDatastores_args args;
+  Aim_pause_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.getDatastores", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.pause", bytes);
   }
 
-  Aim_getDatastores_result result;
+  Aim_pause_result result;
   try {
-    iface_->getDatastores(result.success);
-    result.__isset.success = true;
-  } catch (RimpException &re) {
-    result.re = re;
-    result.__isset.re = true;
+    iface_->pause(args.domainName);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.getDatastores");
+      this->eventHandler_->handlerError(ctx, "Aim.pause");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("getDatastores", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("pause", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -9865,55 +20747,60 @@ void AimProcessor::process_getDatastores(int32_t seqid, ::apache::thrift::protoc
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.getDatastores");
+    this->eventHandler_->preWrite(ctx, "Aim.pause");
   }
 
-  oprot->writeMessageBegin("getDatastores", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("pause", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.getDatastores", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.pause", bytes);
   }
 }
 
-void AimProcessor::process_getNetInterfaces(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_resume(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.getNetInterfaces", callContext);
+    ctx = this->eventHandler_->getContext("Aim.resume", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getNetInterfaces");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.resume");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.getNetInterfaces");
+    this->eventHandler_->preRead(ctx, "Aim.resume");
   }
 
-  Aim_getNetInterfaces_args args;
+  Aim_resume_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.getNetInterfaces", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.resume", bytes);
   }
 
-  Aim_getNetInterfaces_result result;
+  Aim_resume_result result;
   try {
-    iface_->getNetInterfaces(result.success);
-    result.__isset.success = true;
-  } catch (RimpException &re) {
-    result.re = re;
-    result.__isset.re = true;
+    iface_->resume(args.domainName);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.getNetInterfaces");
+      this->eventHandler_->handlerError(ctx, "Aim.resume");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("getNetInterfaces", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("resume", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -9922,54 +20809,60 @@ void AimProcessor::process_getNetInterfaces(int32_t seqid, ::apache::thrift::pro
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.getNetInterfaces");
+    this->eventHandler_->preWrite(ctx, "Aim.resume");
   }
 
-  oprot->writeMessageBegin("getNetInterfaces", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("resume", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.getNetInterfaces", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.resume", bytes);
   }
 }
 
-void AimProcessor::process_copyFromRepositoryToDatastore(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_createISCSIStoragePool(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.copyFromRepositoryToDatastore", callContext);
+    ctx = this->eventHandler_->getContext("Aim.createISCSIStoragePool", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.copyFromRepositoryToDatastore");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.createISCSIStoragePool");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.copyFromRepositoryToDatastore");
+    this->eventHandler_->preRead(ctx, "Aim.createISCSIStoragePool");
   }
 
-  Aim_copyFromRepositoryToDatastore_args args;
+  Aim_createISCSIStoragePool_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.copyFromRepositoryToDatastore", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.createISCSIStoragePool", bytes);
   }
 
-  Aim_copyFromRepositoryToDatastore_result result;
+  Aim_createISCSIStoragePool_result result;
   try {
-    iface_->copyFromRepositoryToDatastore(args.virtualImageRepositoryPath, args.datastorePath, args.virtualMachineUUID);
-  } catch (RimpException &re) {
-    result.re = re;
-    result.__isset.re = true;
+    iface_->createISCSIStoragePool(args.name, args.host, args.iqn, args.targetPath);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.copyFromRepositoryToDatastore");
+      this->eventHandler_->handlerError(ctx, "Aim.createISCSIStoragePool");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("copyFromRepositoryToDatastore", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("createISCSIStoragePool", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -9978,54 +20871,60 @@ void AimProcessor::process_copyFromRepositoryToDatastore(int32_t seqid, ::apache
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.copyFromRepositoryToDatastore");
+    this->eventHandler_->preWrite(ctx, "Aim.createISCSIStoragePool");
   }
 
-  oprot->writeMessageBegin("copyFromRepositoryToDatastore", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("createISCSIStoragePool", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.copyFromRepositoryToDatastore", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.createISCSIStoragePool", bytes);
   }
 }
 
-void AimProcessor::process_deleteVirtualImageFromDatastore(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_createNFSStoragePool(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.deleteVirtualImageFromDatastore", callContext);
+    ctx = this->eventHandler_->getContext("Aim.createNFSStoragePool", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.deleteVirtualImageFromDatastore");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.createNFSStoragePool");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.deleteVirtualImageFromDatastore");
+    this->eventHandler_->preRead(ctx, "Aim.createNFSStoragePool");
   }
 
-  Aim_deleteVirtualImageFromDatastore_args args;
+  Aim_createNFSStoragePool_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.deleteVirtualImageFromDatastore", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.createNFSStoragePool", bytes);
   }
 
-  Aim_deleteVirtualImageFromDatastore_result result;
+  Aim_createNFSStoragePool_result result;
   try {
-    iface_->deleteVirtualImageFromDatastore(args.datastorePath, args.virtualMachineUUID);
-  } catch (RimpException &re) {
-    result.re = re;
-    result.__isset.re = true;
+    iface_->createNFSStoragePool(args.name, args.host, args.dir, args.targetPath);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.deleteVirtualImageFromDatastore");
+      this->eventHandler_->handlerError(ctx, "Aim.createNFSStoragePool");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("deleteVirtualImageFromDatastore", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("createNFSStoragePool", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10034,54 +20933,60 @@ void AimProcessor::process_deleteVirtualImageFromDatastore(int32_t seqid, ::apac
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.deleteVirtualImageFromDatastore");
+    this->eventHandler_->preWrite(ctx, "Aim.createNFSStoragePool");
   }
 
-  oprot->writeMessageBegin("deleteVirtualImageFromDatastore", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("createNFSStoragePool", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.deleteVirtualImageFromDatastore", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.createNFSStoragePool", bytes);
   }
 }
 
-void AimProcessor::process_copyFromDatastoreToRepository(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_createDirStoragePool(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.copyFromDatastoreToRepository", callContext);
+    ctx = this->eventHandler_->getContext("Aim.createDirStoragePool", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.copyFromDatastoreToRepository");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.createDirStoragePool");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.copyFromDatastoreToRepository");
+    this->eventHandler_->preRead(ctx, "Aim.createDirStoragePool");
   }
 
-  Aim_copyFromDatastoreToRepository_args args;
+  Aim_createDirStoragePool_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.copyFromDatastoreToRepository", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.createDirStoragePool", bytes);
   }
 
-  Aim_copyFromDatastoreToRepository_result result;
+  Aim_createDirStoragePool_result result;
   try {
-    iface_->copyFromDatastoreToRepository(args.virtualMachineUUID, args.snapshot, args.destinationRepositoryPath, args.sourceDatastorePath);
-  } catch (RimpException &re) {
-    result.re = re;
-    result.__isset.re = true;
+    iface_->createDirStoragePool(args.name, args.targetPath);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.copyFromDatastoreToRepository");
+      this->eventHandler_->handlerError(ctx, "Aim.createDirStoragePool");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("copyFromDatastoreToRepository", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("createDirStoragePool", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10090,54 +20995,60 @@ void AimProcessor::process_copyFromDatastoreToRepository(int32_t seqid, ::apache
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.copyFromDatastoreToRepository");
+    this->eventHandler_->preWrite(ctx, "Aim.createDirStoragePool");
   }
 
-  oprot->writeMessageBegin("copyFromDatastoreToRepository", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("createDirStoragePool", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.copyFromDatastoreToRepository", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.createDirStoragePool", bytes);
   }
 }
 
-void AimProcessor::process_instanceDisk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_createDisk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.instanceDisk", callContext);
+    ctx = this->eventHandler_->getContext("Aim.createDisk", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.instanceDisk");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.createDisk");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.instanceDisk");
+    this->eventHandler_->preRead(ctx, "Aim.createDisk");
   }
 
-  Aim_instanceDisk_args args;
+  Aim_createDisk_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.instanceDisk", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.createDisk", bytes);
   }
 
-  Aim_instanceDisk_result result;
+  Aim_createDisk_result result;
   try {
-    iface_->instanceDisk(args.source, args.destination);
-  } catch (RimpException &re) {
-    result.re = re;
-    result.__isset.re = true;
+    iface_->createDisk(args.poolName, args.name, args.capacityInKb, args.allocationInKb, args.format);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.instanceDisk");
+      this->eventHandler_->handlerError(ctx, "Aim.createDisk");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("instanceDisk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("createDisk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10146,54 +21057,60 @@ void AimProcessor::process_instanceDisk(int32_t seqid, ::apache::thrift::protoco
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.instanceDisk");
+    this->eventHandler_->preWrite(ctx, "Aim.createDisk");
   }
 
-  oprot->writeMessageBegin("instanceDisk", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("createDisk", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.instanceDisk", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.createDisk", bytes);
   }
 }
 
-void AimProcessor::process_renameDisk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_deleteDisk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.renameDisk", callContext);
+    ctx = this->eventHandler_->getContext("Aim.deleteDisk", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.renameDisk");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.deleteDisk");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.renameDisk");
+    this->eventHandler_->preRead(ctx, "Aim.deleteDisk");
   }
 
-  Aim_renameDisk_args args;
+  Aim_deleteDisk_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.renameDisk", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.deleteDisk", bytes);
   }
 
-  Aim_renameDisk_result result;
+  Aim_deleteDisk_result result;
   try {
-    iface_->renameDisk(args.oldPath, args.newPath);
-  } catch (RimpException &re) {
-    result.re = re;
-    result.__isset.re = true;
+    iface_->deleteDisk(args.poolName, args.name);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.renameDisk");
+      this->eventHandler_->handlerError(ctx, "Aim.deleteDisk");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("renameDisk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("deleteDisk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10202,54 +21119,60 @@ void AimProcessor::process_renameDisk(int32_t seqid, ::apache::thrift::protocol:
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.renameDisk");
+    this->eventHandler_->preWrite(ctx, "Aim.deleteDisk");
   }
 
-  oprot->writeMessageBegin("renameDisk", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("deleteDisk", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.renameDisk", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.deleteDisk", bytes);
   }
 }
 
-void AimProcessor::process_createVLAN(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_resizeVol(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.createVLAN", callContext);
+    ctx = this->eventHandler_->getContext("Aim.resizeVol", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.createVLAN");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.resizeVol");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.createVLAN");
+    this->eventHandler_->preRead(ctx, "Aim.resizeVol");
   }
 
-  Aim_createVLAN_args args;
+  Aim_resizeVol_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.createVLAN", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.resizeVol", bytes);
   }
 
-  Aim_createVLAN_result result;
+  Aim_resizeVol_result result;
   try {
-    iface_->createVLAN(args.vlanTag, args.vlanInterface, args.bridgeInterface);
-  } catch (VLanException &ve) {
-    result.ve = ve;
-    result.__isset.ve = true;
+    iface_->resizeVol(args.poolName, args.name, args.capacityInKb);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.createVLAN");
+      this->eventHandler_->handlerError(ctx, "Aim.resizeVol");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("createVLAN", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("resizeVol", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10258,54 +21181,60 @@ void AimProcessor::process_createVLAN(int32_t seqid, ::apache::thrift::protocol:
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.createVLAN");
+    this->eventHandler_->preWrite(ctx, "Aim.resizeVol");
   }
 
-  oprot->writeMessageBegin("createVLAN", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("resizeVol", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.createVLAN", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.resizeVol", bytes);
   }
 }
 
-void AimProcessor::process_deleteVLAN(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_resizeDisk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.deleteVLAN", callContext);
+    ctx = this->eventHandler_->getContext("Aim.resizeDisk", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.deleteVLAN");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.resizeDisk");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.deleteVLAN");
+    this->eventHandler_->preRead(ctx, "Aim.resizeDisk");
   }
 
-  Aim_deleteVLAN_args args;
+  Aim_resizeDisk_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.deleteVLAN", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.resizeDisk", bytes);
   }
 
-  Aim_deleteVLAN_result result;
+  Aim_resizeDisk_result result;
   try {
-    iface_->deleteVLAN(args.vlanTag, args.vlanInterface, args.bridgeInterface);
-  } catch (VLanException &ve) {
-    result.ve = ve;
-    result.__isset.ve = true;
+    iface_->resizeDisk(args.domainName, args.diskPath, args.diskSizeInKb);
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.deleteVLAN");
+      this->eventHandler_->handlerError(ctx, "Aim.resizeDisk");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("deleteVLAN", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("resizeDisk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10314,54 +21243,61 @@ void AimProcessor::process_deleteVLAN(int32_t seqid, ::apache::thrift::protocol:
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.deleteVLAN");
+    this->eventHandler_->preWrite(ctx, "Aim.resizeDisk");
   }
 
-  oprot->writeMessageBegin("deleteVLAN", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("resizeDisk", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.deleteVLAN", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.resizeDisk", bytes);
   }
 }
 
-void AimProcessor::process_checkVLANConfiguration(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_getDomainBlockInfo(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.checkVLANConfiguration", callContext);
+    ctx = this->eventHandler_->getContext("Aim.getDomainBlockInfo", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.checkVLANConfiguration");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDomainBlockInfo");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.checkVLANConfiguration");
+    this->eventHandler_->preRead(ctx, "Aim.getDomainBlockInfo");
   }
 
-  Aim_checkVLANConfiguration_args args;
+  Aim_getDomainBlockInfo_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.checkVLANConfiguration", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.getDomainBlockInfo", bytes);
   }
 
-  Aim_checkVLANConfiguration_result result;
+  Aim_getDomainBlockInfo_result result;
   try {
-    iface_->checkVLANConfiguration();
-  } catch (VLanException &ve) {
-    result.ve = ve;
-    result.__isset.ve = true;
+    iface_->getDomainBlockInfo(result.success, args.domainName, args.diskPath);
+    result.__isset.success = true;
+  } catch (LibvirtException &libvirtException) {
+    result.libvirtException = libvirtException;
+    result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.checkVLANConfiguration");
+      this->eventHandler_->handlerError(ctx, "Aim.getDomainBlockInfo");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("checkVLANConfiguration", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("getDomainBlockInfo", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10370,55 +21306,58 @@ void AimProcessor::process_checkVLANConfiguration(int32_t seqid, ::apache::thrif
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.checkVLANConfiguration");
+    this->eventHandler_->preWrite(ctx, "Aim.getDomainBlockInfo");
   }
 
-  oprot->writeMessageBegin("checkVLANConfiguration", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("getDomainBlockInfo", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.checkVLANConfiguration", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.getDomainBlockInfo", bytes);
   }
 }
 
-void AimProcessor::process_getInitiatorIQN(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_getDatapoints(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.getInitiatorIQN", callContext);
+    ctx = this->eventHandler_->getContext("Aim.getDatapoints", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getInitiatorIQN");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDatapoints");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.getInitiatorIQN");
+    this->eventHandler_->preRead(ctx, "Aim.getDatapoints");
   }
 
-  Aim_getInitiatorIQN_args args;
+  Aim_getDatapoints_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.getInitiatorIQN", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.getDatapoints", bytes);
   }
 
-  Aim_getInitiatorIQN_result result;
+  Aim_getDatapoints_result result;
   try {
-    iface_->getInitiatorIQN(result.success);
+    iface_->getDatapoints(result.success, args.domainName, args.timestamp);
     result.__isset.success = true;
-  } catch (StorageException &se) {
-    result.se = se;
-    result.__isset.se = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.getInitiatorIQN");
+      this->eventHandler_->handlerError(ctx, "Aim.getDatapoints");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("getInitiatorIQN", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("getDatapoints", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10427,54 +21366,57 @@ void AimProcessor::process_getInitiatorIQN(int32_t seqid, ::apache::thrift::prot
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.getInitiatorIQN");
+    this->eventHandler_->preWrite(ctx, "Aim.getDatapoints");
   }
 
-  oprot->writeMessageBegin("getInitiatorIQN", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("getDatapoints", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.getInitiatorIQN", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.getDatapoints", bytes);
   }
 }
 
-void AimProcessor::process_rescanISCSI(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_upload(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.rescanISCSI", callContext);
+    ctx = this->eventHandler_->getContext("Aim.upload", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.rescanISCSI");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.upload");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.rescanISCSI");
+    this->eventHandler_->preRead(ctx, "Aim.upload");
   }
 
-  Aim_rescanISCSI_args args;
+  Aim_upload_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.rescanISCSI", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.upload", bytes);
   }
 
-  Aim_rescanISCSI_result result;
+  Aim_upload_result result;
   try {
-    iface_->rescanISCSI(args.targets);
-  } catch (StorageException &se) {
-    result.se = se;
-    result.__isset.se = true;
+    iface_->upload(args.file, args.path);
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.rescanISCSI");
+      this->eventHandler_->handlerError(ctx, "Aim.upload");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("rescanISCSI", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("upload", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10483,55 +21425,61 @@ void AimProcessor::process_rescanISCSI(int32_t seqid, ::apache::thrift::protocol
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.rescanISCSI");
+    this->eventHandler_->preWrite(ctx, "Aim.upload");
   }
 
-  oprot->writeMessageBegin("rescanISCSI", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("upload", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.rescanISCSI", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.upload", bytes);
   }
 }
 
-void AimProcessor::process_getNodeInfo(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_getDomainsLite(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.getNodeInfo", callContext);
+    ctx = this->eventHandler_->getContext("Aim.getDomainsLite", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getNodeInfo");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDomainsLite");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.getNodeInfo");
+    this->eventHandler_->preRead(ctx, "Aim.getDomainsLite");
   }
 
-  Aim_getNodeInfo_args args;
+  Aim_getDomainsLite_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.getNodeInfo", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.getDomainsLite", bytes);
   }
 
-  Aim_getNodeInfo_result result;
+  Aim_getDomainsLite_result result;
   try {
-    iface_->getNodeInfo(result.success);
+    iface_->getDomainsLite(result.success);
     result.__isset.success = true;
   } catch (LibvirtException &libvirtException) {
     result.libvirtException = libvirtException;
     result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.getNodeInfo");
+      this->eventHandler_->handlerError(ctx, "Aim.getDomainsLite");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("getNodeInfo", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("getDomainsLite", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10540,54 +21488,61 @@ void AimProcessor::process_getNodeInfo(int32_t seqid, ::apache::thrift::protocol
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.getNodeInfo");
+    this->eventHandler_->preWrite(ctx, "Aim.getDomainsLite");
   }
 
-  oprot->writeMessageBegin("getNodeInfo", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("getDomainsLite", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.getNodeInfo", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.getDomainsLite", bytes);
   }
 }
 
-void AimProcessor::process_defineDomain(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_getDomainsWithFields(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.defineDomain", callContext);
+    ctx = this->eventHandler_->getContext("Aim.getDomainsWithFields", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.defineDomain");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDomainsWithFields");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.defineDomain");
+    this->eventHandler_->preRead(ctx, "Aim.getDomainsWithFields");
   }
 
-  Aim_defineDomain_args args;
+  Aim_getDomainsWithFields_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.defineDomain", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.getDomainsWithFields", bytes);
   }
 
-  Aim_defineDomain_result result;
+  Aim_getDomainsWithFields_result result;
   try {
-    iface_->defineDomain(args.xmlDesc);
+    iface_->getDomainsWithFields(result.success, args.fields);
+    result.__isset.success = true;
   } catch (LibvirtException &libvirtException) {
     result.libvirtException = libvirtException;
     result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.defineDomain");
+      this->eventHandler_->handlerError(ctx, "Aim.getDomainsWithFields");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("defineDomain", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("getDomainsWithFields", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10596,54 +21551,61 @@ void AimProcessor::process_defineDomain(int32_t seqid, ::apache::thrift::protoco
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.defineDomain");
+    this->eventHandler_->preWrite(ctx, "Aim.getDomainsWithFields");
   }
 
-  oprot->writeMessageBegin("defineDomain", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("getDomainsWithFields", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.defineDomain", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.getDomainsWithFields", bytes);
   }
 }
 
-void AimProcessor::process_undefineDomain(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_getDomainsChangedSince(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.undefineDomain", callContext);
+    ctx = this->eventHandler_->getContext("Aim.getDomainsChangedSince", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.undefineDomain");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDomainsChangedSince");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.undefineDomain");
+    this->eventHandler_->preRead(ctx, "Aim.getDomainsChangedSince");
   }
 
-  Aim_undefineDomain_args args;
+  Aim_getDomainsChangedSince_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.undefineDomain", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.getDomainsChangedSince", bytes);
   }
 
-  Aim_undefineDomain_result result;
+  Aim_getDomainsChangedSince_result result;
   try {
-    iface_->undefineDomain(args.domainName);
+    iface_->getDomainsChangedSince(result.success, args.generation, args.fields);
+    result.__isset.success = true;
   } catch (LibvirtException &libvirtException) {
     result.libvirtException = libvirtException;
     result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.undefineDomain");
+      this->eventHandler_->handlerError(ctx, "Aim.getDomainsChangedSince");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("undefineDomain", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("getDomainsChangedSince", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10652,52 +21614,58 @@ void AimProcessor::process_undefineDomain(int32_t seqid, ::apache::thrift::proto
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.undefineDomain");
+    this->eventHandler_->preWrite(ctx, "Aim.getDomainsChangedSince");
   }
 
-  oprot->writeMessageBegin("undefineDomain", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("getDomainsChangedSince", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.undefineDomain", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.getDomainsChangedSince", bytes);
   }
 }
 
-void AimProcessor::process_existDomain(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_waitForEvents(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.existDomain", callContext);
+    ctx = this->eventHandler_->getContext("Aim.waitForEvents", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.existDomain");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.waitForEvents");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.existDomain");
+    this->eventHandler_->preRead(ctx, "Aim.waitForEvents");
   }
 
-  Aim_existDomain_args args;
+  Aim_waitForEvents_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.existDomain", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.waitForEvents", bytes);
   }
 
-  Aim_existDomain_result result;
+  Aim_waitForEvents_result result;
   try {
-    result.success = iface_->existDomain(args.domainName);
+    iface_->waitForEvents(result.success, args.sinceId, args.timeoutMs);
     result.__isset.success = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.existDomain");
+      this->eventHandler_->handlerError(ctx, "Aim.waitForEvents");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("existDomain", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("waitForEvents", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10706,55 +21674,61 @@ void AimProcessor::process_existDomain(int32_t seqid, ::apache::thrift::protocol
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.existDomain");
+    this->eventHandler_->preWrite(ctx, "Aim.waitForEvents");
   }
 
-  oprot->writeMessageBegin("existDomain", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("waitForEvents", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.existDomain", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.waitForEvents", bytes);
   }
 }
 
-void AimProcessor::process_getDomainState(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_startCopyFromRepositoryToDatastore(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.getDomainState", callContext);
+    ctx = this->eventHandler_->getContext("Aim.startCopyFromRepositoryToDatastore", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDomainState");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.startCopyFromRepositoryToDatastore");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.getDomainState");
+    this->eventHandler_->preRead(ctx, "Aim.startCopyFromRepositoryToDatastore");
   }
 
-  Aim_getDomainState_args args;
+  Aim_startCopyFromRepositoryToDatastore_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.getDomainState", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.startCopyFromRepositoryToDatastore", bytes);
   }
 
-  Aim_getDomainState_result result;
+  Aim_startCopyFromRepositoryToDatastore_result result;
   try {
-    result.success = iface_->getDomainState(args.domainName);
+    iface_->startCopyFromRepositoryToDatastore(result.success, args.virtualImageRepositoryPath, args.datastorePath, args.virtualMachineUUID);
     result.__isset.success = true;
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.getDomainState");
+      this->eventHandler_->handlerError(ctx, "Aim.startCopyFromRepositoryToDatastore");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("getDomainState", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("startCopyFromRepositoryToDatastore", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10763,55 +21737,61 @@ void AimProcessor::process_getDomainState(int32_t seqid, ::apache::thrift::proto
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.getDomainState");
+    this->eventHandler_->preWrite(ctx, "Aim.startCopyFromRepositoryToDatastore");
   }
 
-  oprot->writeMessageBegin("getDomainState", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("startCopyFromRepositoryToDatastore", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.getDomainState", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.startCopyFromRepositoryToDatastore", bytes);
   }
 }
 
-void AimProcessor::process_getDomainInfo(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_startCopyFromDatastoreToRepository(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.getDomainInfo", callContext);
+    ctx = this->eventHandler_->getContext("Aim.startCopyFromDatastoreToRepository", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDomainInfo");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.startCopyFromDatastoreToRepository");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.getDomainInfo");
+    this->eventHandler_->preRead(ctx, "Aim.startCopyFromDatastoreToRepository");
   }
 
-  Aim_getDomainInfo_args args;
+  Aim_startCopyFromDatastoreToRepository_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.getDomainInfo", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.startCopyFromDatastoreToRepository", bytes);
   }
 
-  Aim_getDomainInfo_result result;
+  Aim_startCopyFromDatastoreToRepository_result result;
   try {
-    iface_->getDomainInfo(result.success, args.domainName);
+    iface_->startCopyFromDatastoreToRepository(result.success, args.virtualMachineUUID, args.snapshot, args.destinationRepositoryPath, args.sourceDatastorePath);
     result.__isset.success = true;
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.getDomainInfo");
+      this->eventHandler_->handlerError(ctx, "Aim.startCopyFromDatastoreToRepository");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("getDomainInfo", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("startCopyFromDatastoreToRepository", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10820,55 +21800,61 @@ void AimProcessor::process_getDomainInfo(int32_t seqid, ::apache::thrift::protoc
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.getDomainInfo");
+    this->eventHandler_->preWrite(ctx, "Aim.startCopyFromDatastoreToRepository");
   }
 
-  oprot->writeMessageBegin("getDomainInfo", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("startCopyFromDatastoreToRepository", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.getDomainInfo", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.startCopyFromDatastoreToRepository", bytes);
   }
 }
 
-void AimProcessor::process_getDomains(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_startCopy(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.getDomains", callContext);
+    ctx = this->eventHandler_->getContext("Aim.startCopy", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDomains");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.startCopy");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.getDomains");
+    this->eventHandler_->preRead(ctx, "Aim.startCopy");
   }
 
-  Aim_getDomains_args args;
+  Aim_startCopy_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.getDomains", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.startCopy", bytes);
   }
 
-  Aim_getDomains_result result;
+  Aim_startCopy_result result;
   try {
-    iface_->getDomains(result.success);
+    iface_->startCopy(result.success, args.source, args.destination);
     result.__isset.success = true;
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.getDomains");
+      this->eventHandler_->handlerError(ctx, "Aim.startCopy");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("getDomains", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("startCopy", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10877,54 +21863,61 @@ void AimProcessor::process_getDomains(int32_t seqid, ::apache::thrift::protocol:
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.getDomains");
+    this->eventHandler_->preWrite(ctx, "Aim.startCopy");
   }
 
-  oprot->writeMessageBegin("getDomains", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("startCopy", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.getDomains", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.startCopy", bytes);
   }
 }
 
-void AimProcessor::process_powerOn(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_getJobStatus(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.powerOn", callContext);
+    ctx = this->eventHandler_->getContext("Aim.getJobStatus", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.powerOn");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getJobStatus");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.powerOn");
+    this->eventHandler_->preRead(ctx, "Aim.getJobStatus");
   }
 
-  Aim_powerOn_args args;
+  Aim_getJobStatus_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.powerOn", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.getJobStatus", bytes);
   }
 
-  Aim_powerOn_result result;
+  Aim_getJobStatus_result result;
   try {
-    iface_->powerOn(args.domainName);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->getJobStatus(result.success, args.jobId);
+    result.__isset.success = true;
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.powerOn");
+      this->eventHandler_->handlerError(ctx, "Aim.getJobStatus");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("powerOn", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("getJobStatus", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10933,54 +21926,60 @@ void AimProcessor::process_powerOn(int32_t seqid, ::apache::thrift::protocol::TP
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.powerOn");
+    this->eventHandler_->preWrite(ctx, "Aim.getJobStatus");
   }
 
-  oprot->writeMessageBegin("powerOn", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("getJobStatus", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.powerOn", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.getJobStatus", bytes);
   }
 }
 
-void AimProcessor::process_powerOff(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_cancelJob(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.powerOff", callContext);
+    ctx = this->eventHandler_->getContext("Aim.cancelJob", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.powerOff");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.cancelJob");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.powerOff");
+    this->eventHandler_->preRead(ctx, "Aim.cancelJob");
   }
 
-  Aim_powerOff_args args;
+  Aim_cancelJob_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.powerOff", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.cancelJob", bytes);
   }
 
-  Aim_powerOff_result result;
+  Aim_cancelJob_result result;
   try {
-    iface_->powerOff(args.domainName);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->cancelJob(args.jobId);
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.powerOff");
+      this->eventHandler_->handlerError(ctx, "Aim.cancelJob");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("powerOff", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("cancelJob", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -10989,54 +21988,55 @@ void AimProcessor::process_powerOff(int32_t seqid, ::apache::thrift::protocol::T
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.powerOff");
+    this->eventHandler_->preWrite(ctx, "Aim.cancelJob");
   }
 
-  oprot->writeMessageBegin("powerOff", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("cancelJob", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.powerOff", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.cancelJob", bytes);
   }
 }
 
-void AimProcessor::process_shutdown(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_getServerStats(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.shutdown", callContext);
+    ctx = this->eventHandler_->getContext("Aim.getServerStats", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.shutdown");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getServerStats");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.shutdown");
+    this->eventHandler_->preRead(ctx, "Aim.getServerStats");
   }
 
-  Aim_shutdown_args args;
+  Aim_getServerStats_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.shutdown", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.getServerStats", bytes);
   }
 
-  Aim_shutdown_result result;
+  Aim_getServerStats_result result;
   try {
-    iface_->shutdown(args.domainName);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->getServerStats(result.success);
+    result.__isset.success = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.shutdown");
+      this->eventHandler_->handlerError(ctx, "Aim.getServerStats");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("shutdown", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("getServerStats", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11045,54 +22045,61 @@ void AimProcessor::process_shutdown(int32_t seqid, ::apache::thrift::protocol::T
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.shutdown");
+    this->eventHandler_->preWrite(ctx, "Aim.getServerStats");
   }
 
-  oprot->writeMessageBegin("shutdown", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("getServerStats", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.shutdown", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.getServerStats", bytes);
   }
 }
 
-void AimProcessor::process_reset(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_openUpload(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.reset", callContext);
+    ctx = this->eventHandler_->getContext("Aim.openUpload", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.reset");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.openUpload");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.reset");
+    this->eventHandler_->preRead(ctx, "Aim.openUpload");
   }
 
-  Aim_reset_args args;
+  Aim_openUpload_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.reset", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.openUpload", bytes);
   }
 
-  Aim_reset_result result;
+  Aim_openUpload_result result;
   try {
-    iface_->reset(args.domainName);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->openUpload(result.success, args.path, args.size);
+    result.__isset.success = true;
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.reset");
+      this->eventHandler_->handlerError(ctx, "Aim.openUpload");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("reset", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("openUpload", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11101,54 +22108,60 @@ void AimProcessor::process_reset(int32_t seqid, ::apache::thrift::protocol::TPro
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.reset");
+    this->eventHandler_->preWrite(ctx, "Aim.openUpload");
   }
 
-  oprot->writeMessageBegin("reset", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("openUpload", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.reset", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.openUpload", bytes);
   }
 }
 
-void AimProcessor::process_pause(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_writeChunk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.pause", callContext);
+    ctx = this->eventHandler_->getContext("Aim.writeChunk", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.pause");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.writeChunk");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.pause");
+    this->eventHandler_->preRead(ctx, "Aim.writeChunk");
   }
 
-  Aim_pause_args args;
+  Aim_writeChunk_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.pause", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.writeChunk", bytes);
   }
 
-  Aim_pause_result result;
+  Aim_writeChunk_result result;
   try {
-    iface_->pause(args.domainName);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->writeChunk(args.uploadId, args.offset, args.data);
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.pause");
+      this->eventHandler_->handlerError(ctx, "Aim.writeChunk");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("pause", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("writeChunk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11157,54 +22170,60 @@ void AimProcessor::process_pause(int32_t seqid, ::apache::thrift::protocol::TPro
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.pause");
+    this->eventHandler_->preWrite(ctx, "Aim.writeChunk");
   }
 
-  oprot->writeMessageBegin("pause", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("writeChunk", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.pause", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.writeChunk", bytes);
   }
 }
 
-void AimProcessor::process_resume(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_commitUpload(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.resume", callContext);
+    ctx = this->eventHandler_->getContext("Aim.commitUpload", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.resume");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.commitUpload");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.resume");
+    this->eventHandler_->preRead(ctx, "Aim.commitUpload");
   }
 
-  Aim_resume_args args;
+  Aim_commitUpload_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.resume", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.commitUpload", bytes);
   }
 
-  Aim_resume_result result;
+  Aim_commitUpload_result result;
   try {
-    iface_->resume(args.domainName);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->commitUpload(args.uploadId, args.crc32);
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.resume");
+      this->eventHandler_->handlerError(ctx, "Aim.commitUpload");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("resume", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("commitUpload", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11213,54 +22232,60 @@ void AimProcessor::process_resume(int32_t seqid, ::apache::thrift::protocol::TPr
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.resume");
+    this->eventHandler_->preWrite(ctx, "Aim.commitUpload");
   }
 
-  oprot->writeMessageBegin("resume", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("commitUpload", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.resume", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.commitUpload", bytes);
   }
 }
 
-void AimProcessor::process_createISCSIStoragePool(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_abortUpload(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.createISCSIStoragePool", callContext);
+    ctx = this->eventHandler_->getContext("Aim.abortUpload", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.createISCSIStoragePool");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.abortUpload");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.createISCSIStoragePool");
+    this->eventHandler_->preRead(ctx, "Aim.abortUpload");
   }
 
-  Aim_createISCSIStoragePool_args args;
+  Aim_abortUpload_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.createISCSIStoragePool", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.abortUpload", bytes);
   }
 
-  Aim_createISCSIStoragePool_result result;
+  Aim_abortUpload_result result;
   try {
-    iface_->createISCSIStoragePool(args.name, args.host, args.iqn, args.targetPath);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->abortUpload(args.uploadId);
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.createISCSIStoragePool");
+      this->eventHandler_->handlerError(ctx, "Aim.abortUpload");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("createISCSIStoragePool", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("abortUpload", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11269,54 +22294,58 @@ void AimProcessor::process_createISCSIStoragePool(int32_t seqid, ::apache::thrif
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.createISCSIStoragePool");
+    this->eventHandler_->preWrite(ctx, "Aim.abortUpload");
   }
 
-  oprot->writeMessageBegin("createISCSIStoragePool", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("abortUpload", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.createISCSIStoragePool", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.abortUpload", bytes);
   }
 }
 
-void AimProcessor::process_createNFSStoragePool(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_powerOnMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.createNFSStoragePool", callContext);
+    ctx = this->eventHandler_->getContext("Aim.powerOnMany", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.createNFSStoragePool");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.powerOnMany");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.createNFSStoragePool");
+    this->eventHandler_->preRead(ctx, "Aim.powerOnMany");
   }
 
-  Aim_createNFSStoragePool_args args;
+  Aim_powerOnMany_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.createNFSStoragePool", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.powerOnMany", bytes);
   }
 
-  Aim_createNFSStoragePool_result result;
+  Aim_powerOnMany_result result;
   try {
-    iface_->createNFSStoragePool(args.name, args.host, args.dir, args.targetPath);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->powerOnMany(result.success, args.domainNames, args.options);
+    result.__isset.success = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.createNFSStoragePool");
+      this->eventHandler_->handlerError(ctx, "Aim.powerOnMany");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("createNFSStoragePool", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("powerOnMany", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11325,54 +22354,58 @@ void AimProcessor::process_createNFSStoragePool(int32_t seqid, ::apache::thrift:
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.createNFSStoragePool");
+    this->eventHandler_->preWrite(ctx, "Aim.powerOnMany");
   }
 
-  oprot->writeMessageBegin("createNFSStoragePool", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("powerOnMany", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.createNFSStoragePool", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.powerOnMany", bytes);
   }
 }
 
-void AimProcessor::process_createDirStoragePool(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_powerOffMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.createDirStoragePool", callContext);
+    ctx = this->eventHandler_->getContext("Aim.powerOffMany", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.createDirStoragePool");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.powerOffMany");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.createDirStoragePool");
+    this->eventHandler_->preRead(ctx, "Aim.powerOffMany");
   }
 
-  Aim_createDirStoragePool_args args;
+  Aim_powerOffMany_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.createDirStoragePool", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.powerOffMany", bytes);
   }
 
-  Aim_createDirStoragePool_result result;
+  Aim_powerOffMany_result result;
   try {
-    iface_->createDirStoragePool(args.name, args.targetPath);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->powerOffMany(result.success, args.domainNames, args.options);
+    result.__isset.success = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.createDirStoragePool");
+      this->eventHandler_->handlerError(ctx, "Aim.powerOffMany");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("createDirStoragePool", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("powerOffMany", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11381,54 +22414,58 @@ void AimProcessor::process_createDirStoragePool(int32_t seqid, ::apache::thrift:
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.createDirStoragePool");
+    this->eventHandler_->preWrite(ctx, "Aim.powerOffMany");
   }
 
-  oprot->writeMessageBegin("createDirStoragePool", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("powerOffMany", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.createDirStoragePool", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.powerOffMany", bytes);
   }
 }
 
-void AimProcessor::process_createDisk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_shutdownMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.createDisk", callContext);
+    ctx = this->eventHandler_->getContext("Aim.shutdownMany", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.createDisk");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.shutdownMany");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.createDisk");
+    this->eventHandler_->preRead(ctx, "Aim.shutdownMany");
   }
 
-  Aim_createDisk_args args;
+  Aim_shutdownMany_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.createDisk", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.shutdownMany", bytes);
   }
 
-  Aim_createDisk_result result;
+  Aim_shutdownMany_result result;
   try {
-    iface_->createDisk(args.poolName, args.name, args.capacityInKb, args.allocationInKb, args.format);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->shutdownMany(result.success, args.domainNames, args.options);
+    result.__isset.success = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.createDisk");
+      this->eventHandler_->handlerError(ctx, "Aim.shutdownMany");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("createDisk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("shutdownMany", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11437,54 +22474,58 @@ void AimProcessor::process_createDisk(int32_t seqid, ::apache::thrift::protocol:
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.createDisk");
+    this->eventHandler_->preWrite(ctx, "Aim.shutdownMany");
   }
 
-  oprot->writeMessageBegin("createDisk", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("shutdownMany", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.createDisk", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.shutdownMany", bytes);
   }
 }
 
-void AimProcessor::process_deleteDisk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_resetMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.deleteDisk", callContext);
+    ctx = this->eventHandler_->getContext("Aim.resetMany", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.deleteDisk");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.resetMany");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.deleteDisk");
+    this->eventHandler_->preRead(ctx, "Aim.resetMany");
   }
 
-  Aim_deleteDisk_args args;
+  Aim_resetMany_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.deleteDisk", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.resetMany", bytes);
   }
 
-  Aim_deleteDisk_result result;
+  Aim_resetMany_result result;
   try {
-    iface_->deleteDisk(args.poolName, args.name);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->resetMany(result.success, args.domainNames, args.options);
+    result.__isset.success = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.deleteDisk");
+      this->eventHandler_->handlerError(ctx, "Aim.resetMany");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("deleteDisk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("resetMany", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11493,54 +22534,58 @@ void AimProcessor::process_deleteDisk(int32_t seqid, ::apache::thrift::protocol:
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.deleteDisk");
+    this->eventHandler_->preWrite(ctx, "Aim.resetMany");
   }
 
-  oprot->writeMessageBegin("deleteDisk", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("resetMany", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.deleteDisk", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.resetMany", bytes);
   }
 }
 
-void AimProcessor::process_resizeVol(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_pauseMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.resizeVol", callContext);
+    ctx = this->eventHandler_->getContext("Aim.pauseMany", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.resizeVol");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.pauseMany");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.resizeVol");
+    this->eventHandler_->preRead(ctx, "Aim.pauseMany");
   }
 
-  Aim_resizeVol_args args;
+  Aim_pauseMany_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.resizeVol", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.pauseMany", bytes);
   }
 
-  Aim_resizeVol_result result;
+  Aim_pauseMany_result result;
   try {
-    iface_->resizeVol(args.poolName, args.name, args.capacityInKb);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->pauseMany(result.success, args.domainNames, args.options);
+    result.__isset.success = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.resizeVol");
+      this->eventHandler_->handlerError(ctx, "Aim.pauseMany");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("resizeVol", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("pauseMany", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11549,54 +22594,58 @@ void AimProcessor::process_resizeVol(int32_t seqid, ::apache::thrift::protocol::
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.resizeVol");
+    this->eventHandler_->preWrite(ctx, "Aim.pauseMany");
   }
 
-  oprot->writeMessageBegin("resizeVol", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("pauseMany", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.resizeVol", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.pauseMany", bytes);
   }
 }
 
-void AimProcessor::process_resizeDisk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_resumeMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.resizeDisk", callContext);
+    ctx = this->eventHandler_->getContext("Aim.resumeMany", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.resizeDisk");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.resumeMany");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.resizeDisk");
+    this->eventHandler_->preRead(ctx, "Aim.resumeMany");
   }
 
-  Aim_resizeDisk_args args;
+  Aim_resumeMany_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.resizeDisk", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.resumeMany", bytes);
   }
 
-  Aim_resizeDisk_result result;
+  Aim_resumeMany_result result;
   try {
-    iface_->resizeDisk(args.domainName, args.diskPath, args.diskSizeInKb);
-  } catch (LibvirtException &libvirtException) {
-    result.libvirtException = libvirtException;
-    result.__isset.libvirtException = true;
+    iface_->resumeMany(result.success, args.domainNames, args.options);
+    result.__isset.success = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.resizeDisk");
+      this->eventHandler_->handlerError(ctx, "Aim.resumeMany");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("resizeDisk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("resumeMany", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11605,55 +22654,61 @@ void AimProcessor::process_resizeDisk(int32_t seqid, ::apache::thrift::protocol:
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.resizeDisk");
+    this->eventHandler_->preWrite(ctx, "Aim.resumeMany");
   }
 
-  oprot->writeMessageBegin("resizeDisk", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("resumeMany", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.resizeDisk", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.resumeMany", bytes);
   }
 }
 
-void AimProcessor::process_getDomainBlockInfo(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_shutdownWithDeadline(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.getDomainBlockInfo", callContext);
+    ctx = this->eventHandler_->getContext("Aim.shutdownWithDeadline", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDomainBlockInfo");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.shutdownWithDeadline");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.getDomainBlockInfo");
+    this->eventHandler_->preRead(ctx, "Aim.shutdownWithDeadline");
   }
 
-  Aim_getDomainBlockInfo_args args;
+  Aim_shutdownWithDeadline_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.getDomainBlockInfo", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.shutdownWithDeadline", bytes);
   }
 
-  Aim_getDomainBlockInfo_result result;
+  Aim_shutdownWithDeadline_result result;
   try {
-    iface_->getDomainBlockInfo(result.success, args.domainName, args.diskPath);
+    iface_->shutdownWithDeadline(result.success, args.domainName, args.timeoutSec);
     result.__isset.success = true;
   } catch (LibvirtException &libvirtException) {
     result.libvirtException = libvirtException;
     result.__isset.libvirtException = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.getDomainBlockInfo");
+      this->eventHandler_->handlerError(ctx, "Aim.shutdownWithDeadline");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("getDomainBlockInfo", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("shutdownWithDeadline", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11662,52 +22717,58 @@ void AimProcessor::process_getDomainBlockInfo(int32_t seqid, ::apache::thrift::p
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.getDomainBlockInfo");
+    this->eventHandler_->preWrite(ctx, "Aim.shutdownWithDeadline");
   }
 
-  oprot->writeMessageBegin("getDomainBlockInfo", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("shutdownWithDeadline", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.getDomainBlockInfo", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.shutdownWithDeadline", bytes);
   }
 }
 
-void AimProcessor::process_getDatapoints(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_shutdownManyWithDeadline(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.getDatapoints", callContext);
+    ctx = this->eventHandler_->getContext("Aim.shutdownManyWithDeadline", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.getDatapoints");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.shutdownManyWithDeadline");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.getDatapoints");
+    this->eventHandler_->preRead(ctx, "Aim.shutdownManyWithDeadline");
   }
 
-  Aim_getDatapoints_args args;
+  Aim_shutdownManyWithDeadline_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.getDatapoints", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.shutdownManyWithDeadline", bytes);
   }
 
-  Aim_getDatapoints_result result;
+  Aim_shutdownManyWithDeadline_result result;
   try {
-    iface_->getDatapoints(result.success, args.domainName, args.timestamp);
+    iface_->shutdownManyWithDeadline(result.success, args.domainNames, args.timeoutSec, args.options);
     result.__isset.success = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.getDatapoints");
+      this->eventHandler_->handlerError(ctx, "Aim.shutdownManyWithDeadline");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("getDatapoints", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("shutdownManyWithDeadline", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11716,51 +22777,61 @@ void AimProcessor::process_getDatapoints(int32_t seqid, ::apache::thrift::protoc
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.getDatapoints");
+    this->eventHandler_->preWrite(ctx, "Aim.shutdownManyWithDeadline");
   }
 
-  oprot->writeMessageBegin("getDatapoints", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("shutdownManyWithDeadline", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.getDatapoints", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.shutdownManyWithDeadline", bytes);
   }
 }
 
-void AimProcessor::process_upload(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void AimProcessor::process_readChunk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("Aim.upload", callContext);
+    ctx = this->eventHandler_->getContext("Aim.readChunk", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.upload");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Aim.readChunk");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "Aim.upload");
+    this->eventHandler_->preRead(ctx, "Aim.readChunk");
   }
 
-  Aim_upload_args args;
+  Aim_readChunk_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "Aim.upload", bytes);
+    this->eventHandler_->postRead(ctx, "Aim.readChunk", bytes);
   }
 
-  Aim_upload_result result;
+  Aim_readChunk_result result;
   try {
-    iface_->upload(args.file, args.path);
+    iface_->readChunk(result.success, args.path, args.offset, args.length, args.compress);
+    result.__isset.success = true;
+  } catch (RimpException &re) {
+    result.re = re;
+    result.__isset.re = true;
+  } catch (TimeoutException &timeout) {
+    result.timeout = timeout;
+    result.__isset.timeout = true;
+  } catch (OverloadException &overload) {
+    result.overload = overload;
+    result.__isset.overload = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "Aim.upload");
+      this->eventHandler_->handlerError(ctx, "Aim.readChunk");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("upload", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("readChunk", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -11769,17 +22840,17 @@ void AimProcessor::process_upload(int32_t seqid, ::apache::thrift::protocol::TPr
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "Aim.upload");
+    this->eventHandler_->preWrite(ctx, "Aim.readChunk");
   }
 
-  oprot->writeMessageBegin("upload", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("readChunk", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "Aim.upload", bytes);
+    this->eventHandler_->postWrite(ctx, "Aim.readChunk", bytes);
   }
 }
 
@@ -71,7 +71,152 @@ class AimIf {
   virtual void resizeDisk(const std::string& domainName, const std::string& diskPath, const double diskSizeInKb) = 0;
   virtual void getDomainBlockInfo(DomainBlockInfo& _return, const std::string& domainName, const std::string& diskPath) = 0;
   virtual void getDatapoints(std::vector<Measure> & _return, const std::string& domainName, const int32_t timestamp) = 0;
+
+  /**
+   * Write a whole file in a single request. Large files should use the upload sessions (openUpload)
+   */
   virtual void upload(const BinaryFile& file, const std::string& path) = 0;
+
+  /**
+   * Same as getDomains, but without the XML description of the domains
+   * and without checking if they have a job in progress
+   */
+  virtual void getDomainsLite(std::vector<DomainInfo> & _return) = 0;
+
+  /**
+   * Same as getDomains, but only the requested fields are filled
+   * 
+   * @param fields STATE (name, uuid and state), RESOURCES (plus vcpus and memory)
+   * or FULL (plus the XML description, same as getDomains). Only FULL checks
+   * if the domains have a job in progress
+   */
+  virtual void getDomainsWithFields(std::vector<DomainInfo> & _return, const DomainFields::type fields) = 0;
+
+  /**
+   * Domains added, removed or changed since the given generation
+   * 
+   * @param generation the generation returned by the previous call (0 the first time)
+   * @param fields the domain fields to fill, see getDomainsWithFields
+   * @return the current generation and the changes since the given one. If they
+   * are no longer known, snapshot is set and domains holds all the domains
+   */
+  virtual void getDomainsChangedSince(DomainChanges& _return, const int64_t generation, const DomainFields::type fields) = 0;
+
+  /**
+   * Events of the domains after the given one. Blocks until some event arrives or the timeout expires
+   * 
+   * @param sinceId id of the last event received (lastId of the previous call), or -1 to wait for new events
+   * @param timeoutMs maximum time to wait for events, in milliseconds
+   * @return the events and the id to use in the next call. If some events after sinceId were
+   * discarded or lost, lost is set and all the events still known are returned
+   */
+  virtual void waitForEvents(DomainEvents& _return, const int64_t sinceId, const int32_t timeoutMs) = 0;
+
+  /**
+   * Asynchronous versions of copyFromRepositoryToDatastore, copyFromDatastoreToRepository
+   * and instanceDisk. The checks are done before returning, the copy is queued and run by
+   * the copy workers.
+   * 
+   * @return the id of the copy job
+   */
+  virtual void startCopyFromRepositoryToDatastore(std::string& _return, const std::string& virtualImageRepositoryPath, const std::string& datastorePath, const std::string& virtualMachineUUID) = 0;
+  virtual void startCopyFromDatastoreToRepository(std::string& _return, const std::string& virtualMachineUUID, const std::string& snapshot, const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath) = 0;
+  virtual void startCopy(std::string& _return, const std::string& source, const std::string& destination) = 0;
+
+  /**
+   * Progress of a copy job. Finished jobs are kept for a while (see jobRetentionSeconds)
+   * 
+   * @param jobId the id returned when the copy was started
+   */
+  virtual void getJobStatus(JobStatus& _return, const std::string& jobId) = 0;
+
+  /**
+   * Stop a queued or running copy job. The partially copied file is removed
+   * 
+   * @param jobId the id returned when the copy was started
+   */
+  virtual void cancelJob(const std::string& jobId) = 0;
+
+  /**
+   * Request counters and latencies of each method since the server was started,
+   * plus the requests currently running and waiting in each lane
+   */
+  virtual void getServerStats(ServerStats& _return) = 0;
+
+  /**
+   * Start writing a file in chunks. The file is written aside and moved to
+   * its path when committed, so it never appears partially written.
+   * 
+   * @param path absolute path of the file to write, in the repository or a datastore. Its directory must exist
+   * @param size size of the whole file, in bytes
+   * @return the id of the upload session
+   */
+  virtual void openUpload(std::string& _return, const std::string& path, const int64_t size) = 0;
+
+  /**
+   * Write a chunk of an open upload. Chunks can be sent in any order and in
+   * parallel, and a chunk can be sent again (at the same offset) if it failed.
+   * Chunks overlapping one already written at another offset are rejected,
+   * and so are chunks sent again while the first one is still being written.
+   * 
+   * @param uploadId the id returned by openUpload
+   * @param offset position of the chunk in the file
+   * @param data contents of the chunk (see maxChunkSize)
+   */
+  virtual void writeChunk(const std::string& uploadId, const int64_t offset, const std::string& data) = 0;
+
+  /**
+   * Finish an upload once all its chunks are written. Fails (and the upload
+   * is kept open) if some part of the file is missing or the checksum does not match.
+   * 
+   * @param uploadId the id returned by openUpload
+   * @param crc32 CRC-32 of the whole file (as computed by zlib or java.util.zip.CRC32)
+   */
+  virtual void commitUpload(const std::string& uploadId, const int64_t crc32) = 0;
+
+  /**
+   * Discard an upload and its partially written file
+   * 
+   * @param uploadId the id returned by openUpload
+   */
+  virtual void abortUpload(const std::string& uploadId) = 0;
+
+  /**
+   * Lifecycle operations on many domains. Each domain fails or succeeds on
+   * its own, and its result is returned in the same position of the list.
+   * 
+   * @param domainNames the domains to operate on
+   * @param options parallelism and stagger of the operations
+   */
+  virtual void powerOnMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options) = 0;
+  virtual void powerOffMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options) = 0;
+  virtual void shutdownMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options) = 0;
+  virtual void resetMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options) = 0;
+  virtual void pauseMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options) = 0;
+  virtual void resumeMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options) = 0;
+
+  /**
+   * Shut down a domain and wait until it is off. If the guest does not shut
+   * down before the timeout it is destroyed (forced). Returns the final state
+   * of the domain and how long it took.
+   * 
+   * @param domainName the domain to shut down
+   * @param timeoutSec seconds the guest has to shut down (0 destroys it right away)
+   */
+  virtual void shutdownWithDeadline(DomainResult& _return, const std::string& domainName, const int32_t timeoutSec) = 0;
+  virtual void shutdownManyWithDeadline(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const int32_t timeoutSec, const BatchOptions& options) = 0;
+
+  /**
+   * Read a chunk of a file in the repository or in a datastore. Files can be
+   * downloaded in parallel by reading several chunks at the same time.
+   * 
+   * @param path absolute path of the file
+   * @param offset position of the chunk in the file
+   * @param length bytes to read (at most maxChunkSize)
+   * @param compress whether to compress the data (zlib). It is sent uncompressed if it does not get smaller
+   * @return the data, with the number of bytes read (less than requested at the end of the file) and the file size
+   */
+  virtual void readChunk(FileChunk& _return, const std::string& path, const int64_t offset, const int32_t length, const bool compress) = 0;
 };
 
 class AimIfFactory {
@@ -215,6 +360,75 @@ class AimNull : virtual public AimIf {
   void upload(const BinaryFile& /* file */, const std::string& /* path */) {
     return;
   }
+  void getDomainsLite(std::vector<DomainInfo> & /* _return */) {
+    return;
+  }
+  void getDomainsWithFields(std::vector<DomainInfo> & /* _return */, const DomainFields::type /* fields */) {
+    return;
+  }
+  void getDomainsChangedSince(DomainChanges& /* _return */, const int64_t /* generation */, const DomainFields::type /* fields */) {
+    return;
+  }
+  void waitForEvents(DomainEvents& /* _return */, const int64_t /* sinceId */, const int32_t /* timeoutMs */) {
+    return;
+  }
+  void startCopyFromRepositoryToDatastore(std::string& /* _return */, const std::string& /* virtualImageRepositoryPath */, const std::string& /* datastorePath */, const std::string& /* virtualMachineUUID */) {
+    return;
+  }
+  void startCopyFromDatastoreToRepository(std::string& /* _return */, const std::string& /* virtualMachineUUID */, const std::string& /* snapshot */, const std::string& /* destinationRepositoryPath */, const std::string& /* sourceDatastorePath */) {
+    return;
+  }
+  void startCopy(std::string& /* _return */, const std::string& /* source */, const std::string& /* destination */) {
+    return;
+  }
+  void getJobStatus(JobStatus& /* _return */, const std::string& /* jobId */) {
+    return;
+  }
+  void cancelJob(const std::string& /* jobId */) {
+    return;
+  }
+  void getServerStats(ServerStats& /* _return */) {
+    return;
+  }
+  void openUpload(std::string& /* _return */, const std::string& /* path */, const int64_t /* size */) {
+    return;
+  }
+  void writeChunk(const std::string& /* uploadId */, const int64_t /* offset */, const std::string& /* data */) {
+    return;
+  }
+  void commitUpload(const std::string& /* uploadId */, const int64_t /* crc32 */) {
+    return;
+  }
+  void abortUpload(const std::string& /* uploadId */) {
+    return;
+  }
+  void powerOnMany(std::vector<DomainResult> & /* _return */, const std::vector<std::string> & /* domainNames */, const BatchOptions& /* options */) {
+    return;
+  }
+  void powerOffMany(std::vector<DomainResult> & /* _return */, const std::vector<std::string> & /* domainNames */, const BatchOptions& /* options */) {
+    return;
+  }
+  void shutdownMany(std::vector<DomainResult> & /* _return */, const std::vector<std::string> & /* domainNames */, const BatchOptions& /* options */) {
+    return;
+  }
+  void resetMany(std::vector<DomainResult> & /* _return */, const std::vector<std::string> & /* domainNames */, const BatchOptions& /* options */) {
+    return;
+  }
+  void pauseMany(std::vector<DomainResult> & /* _return */, const std::vector<std::string> & /* domainNames */, const BatchOptions& /* options */) {
+    return;
+  }
+  void resumeMany(std::vector<DomainResult> & /* _return */, const std::vector<std::string> & /* domainNames */, const BatchOptions& /* options */) {
+    return;
+  }
+  void shutdownWithDeadline(DomainResult& /* _return */, const std::string& /* domainName */, const int32_t /* timeoutSec */) {
+    return;
+  }
+  void shutdownManyWithDeadline(std::vector<DomainResult> & /* _return */, const std::vector<std::string> & /* domainNames */, const int32_t /* timeoutSec */, const BatchOptions& /* options */) {
+    return;
+  }
+  void readChunk(FileChunk& /* _return */, const std::string& /* path */, const int64_t /* offset */, const int32_t /* length */, const bool /* compress */) {
+    return;
+  }
 };
 
 
@@ -263,15 +477,17 @@ class Aim_checkRimpConfiguration_pargs {
 };
 
 typedef struct _Aim_checkRimpConfiguration_result__isset {
-  _Aim_checkRimpConfiguration_result__isset() : re(false) {}
+  _Aim_checkRimpConfiguration_result__isset() : re(false), timeout(false), overload(false) {}
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_checkRimpConfiguration_result__isset;
 
 class Aim_checkRimpConfiguration_result {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
   Aim_checkRimpConfiguration_result(const Aim_checkRimpConfiguration_result&);
   Aim_checkRimpConfiguration_result& operator=(const Aim_checkRimpConfiguration_result&);
@@ -280,15 +496,25 @@ class Aim_checkRimpConfiguration_result {
 
   virtual ~Aim_checkRimpConfiguration_result() throw();
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_checkRimpConfiguration_result__isset __isset;
 
   void __set_re(const RimpException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_checkRimpConfiguration_result & rhs) const
   {
     if (!(re == rhs.re))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_checkRimpConfiguration_result &rhs) const {
@@ -304,19 +530,23 @@ class Aim_checkRimpConfiguration_result {
 };
 
 typedef struct _Aim_checkRimpConfiguration_presult__isset {
-  _Aim_checkRimpConfiguration_presult__isset() : re(false) {}
+  _Aim_checkRimpConfiguration_presult__isset() : re(false), timeout(false), overload(false) {}
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_checkRimpConfiguration_presult__isset;
 
 class Aim_checkRimpConfiguration_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
 
   virtual ~Aim_checkRimpConfiguration_presult() throw();
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_checkRimpConfiguration_presult__isset __isset;
 
@@ -383,16 +613,18 @@ class Aim_getDiskFileSize_pargs {
 };
 
 typedef struct _Aim_getDiskFileSize_result__isset {
-  _Aim_getDiskFileSize_result__isset() : success(false), re(false) {}
+  _Aim_getDiskFileSize_result__isset() : success(false), re(false), timeout(false), overload(false) {}
   bool success :1;
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDiskFileSize_result__isset;
 
 class Aim_getDiskFileSize_result {
  public:
 
-  static const char* ascii_fingerprint; // = "508103C02ABBB83FE53EB7316CA5F1B7";
-  static const uint8_t binary_fingerprint[16]; // = {0x50,0x81,0x03,0xC0,0x2A,0xBB,0xB8,0x3F,0xE5,0x3E,0xB7,0x31,0x6C,0xA5,0xF1,0xB7};
+  static const char* ascii_fingerprint; // = "CFB93EFD3A712B0F3C7AC4DAFF11677F";
+  static const uint8_t binary_fingerprint[16]; // = {0xCF,0xB9,0x3E,0xFD,0x3A,0x71,0x2B,0x0F,0x3C,0x7A,0xC4,0xDA,0xFF,0x11,0x67,0x7F};
 
   Aim_getDiskFileSize_result(const Aim_getDiskFileSize_result&);
   Aim_getDiskFileSize_result& operator=(const Aim_getDiskFileSize_result&);
@@ -402,6 +634,8 @@ class Aim_getDiskFileSize_result {
   virtual ~Aim_getDiskFileSize_result() throw();
   int64_t success;
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDiskFileSize_result__isset __isset;
 
@@ -409,12 +643,20 @@ class Aim_getDiskFileSize_result {
 
   void __set_re(const RimpException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_getDiskFileSize_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(re == rhs.re))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_getDiskFileSize_result &rhs) const {
@@ -430,21 +672,25 @@ class Aim_getDiskFileSize_result {
 };
 
 typedef struct _Aim_getDiskFileSize_presult__isset {
-  _Aim_getDiskFileSize_presult__isset() : success(false), re(false) {}
+  _Aim_getDiskFileSize_presult__isset() : success(false), re(false), timeout(false), overload(false) {}
   bool success :1;
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDiskFileSize_presult__isset;
 
 class Aim_getDiskFileSize_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "508103C02ABBB83FE53EB7316CA5F1B7";
-  static const uint8_t binary_fingerprint[16]; // = {0x50,0x81,0x03,0xC0,0x2A,0xBB,0xB8,0x3F,0xE5,0x3E,0xB7,0x31,0x6C,0xA5,0xF1,0xB7};
+  static const char* ascii_fingerprint; // = "CFB93EFD3A712B0F3C7AC4DAFF11677F";
+  static const uint8_t binary_fingerprint[16]; // = {0xCF,0xB9,0x3E,0xFD,0x3A,0x71,0x2B,0x0F,0x3C,0x7A,0xC4,0xDA,0xFF,0x11,0x67,0x7F};
 
 
   virtual ~Aim_getDiskFileSize_presult() throw();
   int64_t* success;
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDiskFileSize_presult__isset __isset;
 
@@ -499,16 +745,18 @@ class Aim_getDatastores_pargs {
 };
 
 typedef struct _Aim_getDatastores_result__isset {
-  _Aim_getDatastores_result__isset() : success(false), re(false) {}
+  _Aim_getDatastores_result__isset() : success(false), re(false), timeout(false), overload(false) {}
   bool success :1;
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDatastores_result__isset;
 
 class Aim_getDatastores_result {
  public:
 
-  static const char* ascii_fingerprint; // = "47EF84C9D3C6CDEC0D1A5EE1EF46AF69";
-  static const uint8_t binary_fingerprint[16]; // = {0x47,0xEF,0x84,0xC9,0xD3,0xC6,0xCD,0xEC,0x0D,0x1A,0x5E,0xE1,0xEF,0x46,0xAF,0x69};
+  static const char* ascii_fingerprint; // = "A01B2925F38908FBF70CDB9B88E85D6C";
+  static const uint8_t binary_fingerprint[16]; // = {0xA0,0x1B,0x29,0x25,0xF3,0x89,0x08,0xFB,0xF7,0x0C,0xDB,0x9B,0x88,0xE8,0x5D,0x6C};
 
   Aim_getDatastores_result(const Aim_getDatastores_result&);
   Aim_getDatastores_result& operator=(const Aim_getDatastores_result&);
@@ -518,6 +766,8 @@ class Aim_getDatastores_result {
   virtual ~Aim_getDatastores_result() throw();
   std::vector<Datastore>  success;
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDatastores_result__isset __isset;
 
@@ -525,12 +775,20 @@ class Aim_getDatastores_result {
 
   void __set_re(const RimpException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_getDatastores_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(re == rhs.re))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_getDatastores_result &rhs) const {
@@ -546,21 +804,25 @@ class Aim_getDatastores_result {
 };
 
 typedef struct _Aim_getDatastores_presult__isset {
-  _Aim_getDatastores_presult__isset() : success(false), re(false) {}
+  _Aim_getDatastores_presult__isset() : success(false), re(false), timeout(false), overload(false) {}
   bool success :1;
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDatastores_presult__isset;
 
 class Aim_getDatastores_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "47EF84C9D3C6CDEC0D1A5EE1EF46AF69";
-  static const uint8_t binary_fingerprint[16]; // = {0x47,0xEF,0x84,0xC9,0xD3,0xC6,0xCD,0xEC,0x0D,0x1A,0x5E,0xE1,0xEF,0x46,0xAF,0x69};
+  static const char* ascii_fingerprint; // = "A01B2925F38908FBF70CDB9B88E85D6C";
+  static const uint8_t binary_fingerprint[16]; // = {0xA0,0x1B,0x29,0x25,0xF3,0x89,0x08,0xFB,0xF7,0x0C,0xDB,0x9B,0x88,0xE8,0x5D,0x6C};
 
 
   virtual ~Aim_getDatastores_presult() throw();
   std::vector<Datastore> * success;
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDatastores_presult__isset __isset;
 
@@ -615,16 +877,18 @@ class Aim_getNetInterfaces_pargs {
 };
 
 typedef struct _Aim_getNetInterfaces_result__isset {
-  _Aim_getNetInterfaces_result__isset() : success(false), re(false) {}
+  _Aim_getNetInterfaces_result__isset() : success(false), re(false), timeout(false), overload(false) {}
   bool success :1;
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getNetInterfaces_result__isset;
 
 class Aim_getNetInterfaces_result {
  public:
 
-  static const char* ascii_fingerprint; // = "C117F90003DA4545F112D73EBD613259";
-  static const uint8_t binary_fingerprint[16]; // = {0xC1,0x17,0xF9,0x00,0x03,0xDA,0x45,0x45,0xF1,0x12,0xD7,0x3E,0xBD,0x61,0x32,0x59};
+  static const char* ascii_fingerprint; // = "202784A57F74E006471927A3857EE431";
+  static const uint8_t binary_fingerprint[16]; // = {0x20,0x27,0x84,0xA5,0x7F,0x74,0xE0,0x06,0x47,0x19,0x27,0xA3,0x85,0x7E,0xE4,0x31};
 
   Aim_getNetInterfaces_result(const Aim_getNetInterfaces_result&);
   Aim_getNetInterfaces_result& operator=(const Aim_getNetInterfaces_result&);
@@ -634,6 +898,8 @@ class Aim_getNetInterfaces_result {
   virtual ~Aim_getNetInterfaces_result() throw();
   std::vector<NetInterface>  success;
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getNetInterfaces_result__isset __isset;
 
@@ -641,12 +907,20 @@ class Aim_getNetInterfaces_result {
 
   void __set_re(const RimpException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_getNetInterfaces_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(re == rhs.re))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_getNetInterfaces_result &rhs) const {
@@ -662,21 +936,25 @@ class Aim_getNetInterfaces_result {
 };
 
 typedef struct _Aim_getNetInterfaces_presult__isset {
-  _Aim_getNetInterfaces_presult__isset() : success(false), re(false) {}
+  _Aim_getNetInterfaces_presult__isset() : success(false), re(false), timeout(false), overload(false) {}
   bool success :1;
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getNetInterfaces_presult__isset;
 
 class Aim_getNetInterfaces_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "C117F90003DA4545F112D73EBD613259";
-  static const uint8_t binary_fingerprint[16]; // = {0xC1,0x17,0xF9,0x00,0x03,0xDA,0x45,0x45,0xF1,0x12,0xD7,0x3E,0xBD,0x61,0x32,0x59};
+  static const char* ascii_fingerprint; // = "202784A57F74E006471927A3857EE431";
+  static const uint8_t binary_fingerprint[16]; // = {0x20,0x27,0x84,0xA5,0x7F,0x74,0xE0,0x06,0x47,0x19,0x27,0xA3,0x85,0x7E,0xE4,0x31};
 
 
   virtual ~Aim_getNetInterfaces_presult() throw();
   std::vector<NetInterface> * success;
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getNetInterfaces_presult__isset __isset;
 
@@ -757,15 +1035,17 @@ class Aim_copyFromRepositoryToDatastore_pargs {
 };
 
 typedef struct _Aim_copyFromRepositoryToDatastore_result__isset {
-  _Aim_copyFromRepositoryToDatastore_result__isset() : re(false) {}
+  _Aim_copyFromRepositoryToDatastore_result__isset() : re(false), timeout(false), overload(false) {}
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_copyFromRepositoryToDatastore_result__isset;
 
 class Aim_copyFromRepositoryToDatastore_result {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
   Aim_copyFromRepositoryToDatastore_result(const Aim_copyFromRepositoryToDatastore_result&);
   Aim_copyFromRepositoryToDatastore_result& operator=(const Aim_copyFromRepositoryToDatastore_result&);
@@ -774,15 +1054,25 @@ class Aim_copyFromRepositoryToDatastore_result {
 
   virtual ~Aim_copyFromRepositoryToDatastore_result() throw();
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_copyFromRepositoryToDatastore_result__isset __isset;
 
   void __set_re(const RimpException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_copyFromRepositoryToDatastore_result & rhs) const
   {
     if (!(re == rhs.re))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_copyFromRepositoryToDatastore_result &rhs) const {
@@ -798,19 +1088,23 @@ class Aim_copyFromRepositoryToDatastore_result {
 };
 
 typedef struct _Aim_copyFromRepositoryToDatastore_presult__isset {
-  _Aim_copyFromRepositoryToDatastore_presult__isset() : re(false) {}
+  _Aim_copyFromRepositoryToDatastore_presult__isset() : re(false), timeout(false), overload(false) {}
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_copyFromRepositoryToDatastore_presult__isset;
 
 class Aim_copyFromRepositoryToDatastore_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
 
   virtual ~Aim_copyFromRepositoryToDatastore_presult() throw();
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_copyFromRepositoryToDatastore_presult__isset __isset;
 
@@ -884,15 +1178,17 @@ class Aim_deleteVirtualImageFromDatastore_pargs {
 };
 
 typedef struct _Aim_deleteVirtualImageFromDatastore_result__isset {
-  _Aim_deleteVirtualImageFromDatastore_result__isset() : re(false) {}
+  _Aim_deleteVirtualImageFromDatastore_result__isset() : re(false), timeout(false), overload(false) {}
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_deleteVirtualImageFromDatastore_result__isset;
 
 class Aim_deleteVirtualImageFromDatastore_result {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
   Aim_deleteVirtualImageFromDatastore_result(const Aim_deleteVirtualImageFromDatastore_result&);
   Aim_deleteVirtualImageFromDatastore_result& operator=(const Aim_deleteVirtualImageFromDatastore_result&);
@@ -901,15 +1197,25 @@ class Aim_deleteVirtualImageFromDatastore_result {
 
   virtual ~Aim_deleteVirtualImageFromDatastore_result() throw();
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_deleteVirtualImageFromDatastore_result__isset __isset;
 
   void __set_re(const RimpException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_deleteVirtualImageFromDatastore_result & rhs) const
   {
     if (!(re == rhs.re))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_deleteVirtualImageFromDatastore_result &rhs) const {
@@ -925,19 +1231,23 @@ class Aim_deleteVirtualImageFromDatastore_result {
 };
 
 typedef struct _Aim_deleteVirtualImageFromDatastore_presult__isset {
-  _Aim_deleteVirtualImageFromDatastore_presult__isset() : re(false) {}
+  _Aim_deleteVirtualImageFromDatastore_presult__isset() : re(false), timeout(false), overload(false) {}
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_deleteVirtualImageFromDatastore_presult__isset;
 
 class Aim_deleteVirtualImageFromDatastore_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
 
   virtual ~Aim_deleteVirtualImageFromDatastore_presult() throw();
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_deleteVirtualImageFromDatastore_presult__isset __isset;
 
@@ -1025,15 +1335,17 @@ class Aim_copyFromDatastoreToRepository_pargs {
 };
 
 typedef struct _Aim_copyFromDatastoreToRepository_result__isset {
-  _Aim_copyFromDatastoreToRepository_result__isset() : re(false) {}
+  _Aim_copyFromDatastoreToRepository_result__isset() : re(false), timeout(false), overload(false) {}
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_copyFromDatastoreToRepository_result__isset;
 
 class Aim_copyFromDatastoreToRepository_result {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
   Aim_copyFromDatastoreToRepository_result(const Aim_copyFromDatastoreToRepository_result&);
   Aim_copyFromDatastoreToRepository_result& operator=(const Aim_copyFromDatastoreToRepository_result&);
@@ -1042,15 +1354,25 @@ class Aim_copyFromDatastoreToRepository_result {
 
   virtual ~Aim_copyFromDatastoreToRepository_result() throw();
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_copyFromDatastoreToRepository_result__isset __isset;
 
   void __set_re(const RimpException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_copyFromDatastoreToRepository_result & rhs) const
   {
     if (!(re == rhs.re))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_copyFromDatastoreToRepository_result &rhs) const {
@@ -1066,19 +1388,23 @@ class Aim_copyFromDatastoreToRepository_result {
 };
 
 typedef struct _Aim_copyFromDatastoreToRepository_presult__isset {
-  _Aim_copyFromDatastoreToRepository_presult__isset() : re(false) {}
+  _Aim_copyFromDatastoreToRepository_presult__isset() : re(false), timeout(false), overload(false) {}
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_copyFromDatastoreToRepository_presult__isset;
 
 class Aim_copyFromDatastoreToRepository_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
 
   virtual ~Aim_copyFromDatastoreToRepository_presult() throw();
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_copyFromDatastoreToRepository_presult__isset __isset;
 
@@ -1152,15 +1478,17 @@ class Aim_instanceDisk_pargs {
 };
 
 typedef struct _Aim_instanceDisk_result__isset {
-  _Aim_instanceDisk_result__isset() : re(false) {}
+  _Aim_instanceDisk_result__isset() : re(false), timeout(false), overload(false) {}
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_instanceDisk_result__isset;
 
 class Aim_instanceDisk_result {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
   Aim_instanceDisk_result(const Aim_instanceDisk_result&);
   Aim_instanceDisk_result& operator=(const Aim_instanceDisk_result&);
@@ -1169,15 +1497,25 @@ class Aim_instanceDisk_result {
 
   virtual ~Aim_instanceDisk_result() throw();
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_instanceDisk_result__isset __isset;
 
   void __set_re(const RimpException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_instanceDisk_result & rhs) const
   {
     if (!(re == rhs.re))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_instanceDisk_result &rhs) const {
@@ -1193,19 +1531,23 @@ class Aim_instanceDisk_result {
 };
 
 typedef struct _Aim_instanceDisk_presult__isset {
-  _Aim_instanceDisk_presult__isset() : re(false) {}
+  _Aim_instanceDisk_presult__isset() : re(false), timeout(false), overload(false) {}
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_instanceDisk_presult__isset;
 
 class Aim_instanceDisk_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
 
   virtual ~Aim_instanceDisk_presult() throw();
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_instanceDisk_presult__isset __isset;
 
@@ -1279,15 +1621,17 @@ class Aim_renameDisk_pargs {
 };
 
 typedef struct _Aim_renameDisk_result__isset {
-  _Aim_renameDisk_result__isset() : re(false) {}
+  _Aim_renameDisk_result__isset() : re(false), timeout(false), overload(false) {}
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_renameDisk_result__isset;
 
 class Aim_renameDisk_result {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
   Aim_renameDisk_result(const Aim_renameDisk_result&);
   Aim_renameDisk_result& operator=(const Aim_renameDisk_result&);
@@ -1296,15 +1640,25 @@ class Aim_renameDisk_result {
 
   virtual ~Aim_renameDisk_result() throw();
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_renameDisk_result__isset __isset;
 
   void __set_re(const RimpException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_renameDisk_result & rhs) const
   {
     if (!(re == rhs.re))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_renameDisk_result &rhs) const {
@@ -1320,19 +1674,23 @@ class Aim_renameDisk_result {
 };
 
 typedef struct _Aim_renameDisk_presult__isset {
-  _Aim_renameDisk_presult__isset() : re(false) {}
+  _Aim_renameDisk_presult__isset() : re(false), timeout(false), overload(false) {}
   bool re :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_renameDisk_presult__isset;
 
 class Aim_renameDisk_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
 
   virtual ~Aim_renameDisk_presult() throw();
   RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_renameDisk_presult__isset __isset;
 
@@ -1413,15 +1771,17 @@ class Aim_createVLAN_pargs {
 };
 
 typedef struct _Aim_createVLAN_result__isset {
-  _Aim_createVLAN_result__isset() : ve(false) {}
+  _Aim_createVLAN_result__isset() : ve(false), timeout(false), overload(false) {}
   bool ve :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_createVLAN_result__isset;
 
 class Aim_createVLAN_result {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
   Aim_createVLAN_result(const Aim_createVLAN_result&);
   Aim_createVLAN_result& operator=(const Aim_createVLAN_result&);
@@ -1430,15 +1790,25 @@ class Aim_createVLAN_result {
 
   virtual ~Aim_createVLAN_result() throw();
   VLanException ve;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_createVLAN_result__isset __isset;
 
   void __set_ve(const VLanException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_createVLAN_result & rhs) const
   {
     if (!(ve == rhs.ve))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_createVLAN_result &rhs) const {
@@ -1454,19 +1824,23 @@ class Aim_createVLAN_result {
 };
 
 typedef struct _Aim_createVLAN_presult__isset {
-  _Aim_createVLAN_presult__isset() : ve(false) {}
+  _Aim_createVLAN_presult__isset() : ve(false), timeout(false), overload(false) {}
   bool ve :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_createVLAN_presult__isset;
 
 class Aim_createVLAN_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
 
   virtual ~Aim_createVLAN_presult() throw();
   VLanException ve;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_createVLAN_presult__isset __isset;
 
@@ -1547,15 +1921,17 @@ class Aim_deleteVLAN_pargs {
 };
 
 typedef struct _Aim_deleteVLAN_result__isset {
-  _Aim_deleteVLAN_result__isset() : ve(false) {}
+  _Aim_deleteVLAN_result__isset() : ve(false), timeout(false), overload(false) {}
   bool ve :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_deleteVLAN_result__isset;
 
 class Aim_deleteVLAN_result {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
   Aim_deleteVLAN_result(const Aim_deleteVLAN_result&);
   Aim_deleteVLAN_result& operator=(const Aim_deleteVLAN_result&);
@@ -1564,15 +1940,25 @@ class Aim_deleteVLAN_result {
 
   virtual ~Aim_deleteVLAN_result() throw();
   VLanException ve;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_deleteVLAN_result__isset __isset;
 
   void __set_ve(const VLanException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_deleteVLAN_result & rhs) const
   {
     if (!(ve == rhs.ve))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_deleteVLAN_result &rhs) const {
@@ -1588,19 +1974,23 @@ class Aim_deleteVLAN_result {
 };
 
 typedef struct _Aim_deleteVLAN_presult__isset {
-  _Aim_deleteVLAN_presult__isset() : ve(false) {}
+  _Aim_deleteVLAN_presult__isset() : ve(false), timeout(false), overload(false) {}
   bool ve :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_deleteVLAN_presult__isset;
 
 class Aim_deleteVLAN_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
 
   virtual ~Aim_deleteVLAN_presult() throw();
   VLanException ve;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_deleteVLAN_presult__isset __isset;
 
@@ -1655,15 +2045,17 @@ class Aim_checkVLANConfiguration_pargs {
 };
 
 typedef struct _Aim_checkVLANConfiguration_result__isset {
-  _Aim_checkVLANConfiguration_result__isset() : ve(false) {}
+  _Aim_checkVLANConfiguration_result__isset() : ve(false), timeout(false), overload(false) {}
   bool ve :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_checkVLANConfiguration_result__isset;
 
 class Aim_checkVLANConfiguration_result {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
   Aim_checkVLANConfiguration_result(const Aim_checkVLANConfiguration_result&);
   Aim_checkVLANConfiguration_result& operator=(const Aim_checkVLANConfiguration_result&);
@@ -1672,15 +2064,25 @@ class Aim_checkVLANConfiguration_result {
 
   virtual ~Aim_checkVLANConfiguration_result() throw();
   VLanException ve;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_checkVLANConfiguration_result__isset __isset;
 
   void __set_ve(const VLanException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_checkVLANConfiguration_result & rhs) const
   {
     if (!(ve == rhs.ve))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_checkVLANConfiguration_result &rhs) const {
@@ -1696,19 +2098,23 @@ class Aim_checkVLANConfiguration_result {
 };
 
 typedef struct _Aim_checkVLANConfiguration_presult__isset {
-  _Aim_checkVLANConfiguration_presult__isset() : ve(false) {}
+  _Aim_checkVLANConfiguration_presult__isset() : ve(false), timeout(false), overload(false) {}
   bool ve :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_checkVLANConfiguration_presult__isset;
 
 class Aim_checkVLANConfiguration_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
 
   virtual ~Aim_checkVLANConfiguration_presult() throw();
   VLanException ve;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_checkVLANConfiguration_presult__isset __isset;
 
@@ -1763,16 +2169,18 @@ class Aim_getInitiatorIQN_pargs {
 };
 
 typedef struct _Aim_getInitiatorIQN_result__isset {
-  _Aim_getInitiatorIQN_result__isset() : success(false), se(false) {}
+  _Aim_getInitiatorIQN_result__isset() : success(false), se(false), timeout(false), overload(false) {}
   bool success :1;
   bool se :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getInitiatorIQN_result__isset;
 
 class Aim_getInitiatorIQN_result {
  public:
 
-  static const char* ascii_fingerprint; // = "FB3D66E547AE5D7F8EB046D752ECF5C1";
-  static const uint8_t binary_fingerprint[16]; // = {0xFB,0x3D,0x66,0xE5,0x47,0xAE,0x5D,0x7F,0x8E,0xB0,0x46,0xD7,0x52,0xEC,0xF5,0xC1};
+  static const char* ascii_fingerprint; // = "77CCA41D9074A16D3E59690B12F943D0";
+  static const uint8_t binary_fingerprint[16]; // = {0x77,0xCC,0xA4,0x1D,0x90,0x74,0xA1,0x6D,0x3E,0x59,0x69,0x0B,0x12,0xF9,0x43,0xD0};
 
   Aim_getInitiatorIQN_result(const Aim_getInitiatorIQN_result&);
   Aim_getInitiatorIQN_result& operator=(const Aim_getInitiatorIQN_result&);
@@ -1782,6 +2190,8 @@ class Aim_getInitiatorIQN_result {
   virtual ~Aim_getInitiatorIQN_result() throw();
   std::string success;
   StorageException se;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getInitiatorIQN_result__isset __isset;
 
@@ -1789,12 +2199,20 @@ class Aim_getInitiatorIQN_result {
 
   void __set_se(const StorageException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_getInitiatorIQN_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(se == rhs.se))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_getInitiatorIQN_result &rhs) const {
@@ -1810,21 +2228,25 @@ class Aim_getInitiatorIQN_result {
 };
 
 typedef struct _Aim_getInitiatorIQN_presult__isset {
-  _Aim_getInitiatorIQN_presult__isset() : success(false), se(false) {}
+  _Aim_getInitiatorIQN_presult__isset() : success(false), se(false), timeout(false), overload(false) {}
   bool success :1;
   bool se :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getInitiatorIQN_presult__isset;
 
 class Aim_getInitiatorIQN_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "FB3D66E547AE5D7F8EB046D752ECF5C1";
-  static const uint8_t binary_fingerprint[16]; // = {0xFB,0x3D,0x66,0xE5,0x47,0xAE,0x5D,0x7F,0x8E,0xB0,0x46,0xD7,0x52,0xEC,0xF5,0xC1};
+  static const char* ascii_fingerprint; // = "77CCA41D9074A16D3E59690B12F943D0";
+  static const uint8_t binary_fingerprint[16]; // = {0x77,0xCC,0xA4,0x1D,0x90,0x74,0xA1,0x6D,0x3E,0x59,0x69,0x0B,0x12,0xF9,0x43,0xD0};
 
 
   virtual ~Aim_getInitiatorIQN_presult() throw();
   std::string* success;
   StorageException se;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getInitiatorIQN_presult__isset __isset;
 
@@ -1891,15 +2313,17 @@ class Aim_rescanISCSI_pargs {
 };
 
 typedef struct _Aim_rescanISCSI_result__isset {
-  _Aim_rescanISCSI_result__isset() : se(false) {}
+  _Aim_rescanISCSI_result__isset() : se(false), timeout(false), overload(false) {}
   bool se :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_rescanISCSI_result__isset;
 
 class Aim_rescanISCSI_result {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
   Aim_rescanISCSI_result(const Aim_rescanISCSI_result&);
   Aim_rescanISCSI_result& operator=(const Aim_rescanISCSI_result&);
@@ -1908,15 +2332,25 @@ class Aim_rescanISCSI_result {
 
   virtual ~Aim_rescanISCSI_result() throw();
   StorageException se;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_rescanISCSI_result__isset __isset;
 
   void __set_se(const StorageException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_rescanISCSI_result & rhs) const
   {
     if (!(se == rhs.se))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_rescanISCSI_result &rhs) const {
@@ -1932,19 +2366,23 @@ class Aim_rescanISCSI_result {
 };
 
 typedef struct _Aim_rescanISCSI_presult__isset {
-  _Aim_rescanISCSI_presult__isset() : se(false) {}
+  _Aim_rescanISCSI_presult__isset() : se(false), timeout(false), overload(false) {}
   bool se :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_rescanISCSI_presult__isset;
 
 class Aim_rescanISCSI_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "771E7EF40B572D2BFAB12C49547ADCBF";
-  static const uint8_t binary_fingerprint[16]; // = {0x77,0x1E,0x7E,0xF4,0x0B,0x57,0x2D,0x2B,0xFA,0xB1,0x2C,0x49,0x54,0x7A,0xDC,0xBF};
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
 
 
   virtual ~Aim_rescanISCSI_presult() throw();
   StorageException se;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_rescanISCSI_presult__isset __isset;
 
@@ -1999,16 +2437,18 @@ class Aim_getNodeInfo_pargs {
 };
 
 typedef struct _Aim_getNodeInfo_result__isset {
-  _Aim_getNodeInfo_result__isset() : success(false), libvirtException(false) {}
+  _Aim_getNodeInfo_result__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
   bool success :1;
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getNodeInfo_result__isset;
 
 class Aim_getNodeInfo_result {
  public:
 
-  static const char* ascii_fingerprint; // = "B674B36A2EA45332B31BE3B5BD5259C3";
-  static const uint8_t binary_fingerprint[16]; // = {0xB6,0x74,0xB3,0x6A,0x2E,0xA4,0x53,0x32,0xB3,0x1B,0xE3,0xB5,0xBD,0x52,0x59,0xC3};
+  static const char* ascii_fingerprint; // = "4219F2B943A17BA7B313EFF58B4A5004";
+  static const uint8_t binary_fingerprint[16]; // = {0x42,0x19,0xF2,0xB9,0x43,0xA1,0x7B,0xA7,0xB3,0x13,0xEF,0xF5,0x8B,0x4A,0x50,0x04};
 
   Aim_getNodeInfo_result(const Aim_getNodeInfo_result&);
   Aim_getNodeInfo_result& operator=(const Aim_getNodeInfo_result&);
@@ -2018,6 +2458,8 @@ class Aim_getNodeInfo_result {
   virtual ~Aim_getNodeInfo_result() throw();
   NodeInfo success;
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getNodeInfo_result__isset __isset;
 
@@ -2025,12 +2467,20 @@ class Aim_getNodeInfo_result {
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_getNodeInfo_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_getNodeInfo_result &rhs) const {
@@ -2046,21 +2496,25 @@ class Aim_getNodeInfo_result {
 };
 
 typedef struct _Aim_getNodeInfo_presult__isset {
-  _Aim_getNodeInfo_presult__isset() : success(false), libvirtException(false) {}
+  _Aim_getNodeInfo_presult__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
   bool success :1;
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getNodeInfo_presult__isset;
 
 class Aim_getNodeInfo_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "B674B36A2EA45332B31BE3B5BD5259C3";
-  static const uint8_t binary_fingerprint[16]; // = {0xB6,0x74,0xB3,0x6A,0x2E,0xA4,0x53,0x32,0xB3,0x1B,0xE3,0xB5,0xBD,0x52,0x59,0xC3};
+  static const char* ascii_fingerprint; // = "4219F2B943A17BA7B313EFF58B4A5004";
+  static const uint8_t binary_fingerprint[16]; // = {0x42,0x19,0xF2,0xB9,0x43,0xA1,0x7B,0xA7,0xB3,0x13,0xEF,0xF5,0x8B,0x4A,0x50,0x04};
 
 
   virtual ~Aim_getNodeInfo_presult() throw();
   NodeInfo* success;
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getNodeInfo_presult__isset __isset;
 
@@ -2127,15 +2581,17 @@ class Aim_defineDomain_pargs {
 };
 
 typedef struct _Aim_defineDomain_result__isset {
-  _Aim_defineDomain_result__isset() : libvirtException(false) {}
+  _Aim_defineDomain_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_defineDomain_result__isset;
 
 class Aim_defineDomain_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_defineDomain_result(const Aim_defineDomain_result&);
   Aim_defineDomain_result& operator=(const Aim_defineDomain_result&);
@@ -2144,15 +2600,25 @@ class Aim_defineDomain_result {
 
   virtual ~Aim_defineDomain_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_defineDomain_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_defineDomain_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_defineDomain_result &rhs) const {
@@ -2168,19 +2634,23 @@ class Aim_defineDomain_result {
 };
 
 typedef struct _Aim_defineDomain_presult__isset {
-  _Aim_defineDomain_presult__isset() : libvirtException(false) {}
+  _Aim_defineDomain_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_defineDomain_presult__isset;
 
 class Aim_defineDomain_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_defineDomain_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_defineDomain_presult__isset __isset;
 
@@ -2247,15 +2717,17 @@ class Aim_undefineDomain_pargs {
 };
 
 typedef struct _Aim_undefineDomain_result__isset {
-  _Aim_undefineDomain_result__isset() : libvirtException(false) {}
+  _Aim_undefineDomain_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_undefineDomain_result__isset;
 
 class Aim_undefineDomain_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_undefineDomain_result(const Aim_undefineDomain_result&);
   Aim_undefineDomain_result& operator=(const Aim_undefineDomain_result&);
@@ -2264,15 +2736,25 @@ class Aim_undefineDomain_result {
 
   virtual ~Aim_undefineDomain_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_undefineDomain_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_undefineDomain_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_undefineDomain_result &rhs) const {
@@ -2288,19 +2770,23 @@ class Aim_undefineDomain_result {
 };
 
 typedef struct _Aim_undefineDomain_presult__isset {
-  _Aim_undefineDomain_presult__isset() : libvirtException(false) {}
+  _Aim_undefineDomain_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_undefineDomain_presult__isset;
 
 class Aim_undefineDomain_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_undefineDomain_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_undefineDomain_presult__isset __isset;
 
@@ -2367,15 +2853,17 @@ class Aim_existDomain_pargs {
 };
 
 typedef struct _Aim_existDomain_result__isset {
-  _Aim_existDomain_result__isset() : success(false) {}
+  _Aim_existDomain_result__isset() : success(false), timeout(false), overload(false) {}
   bool success :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_existDomain_result__isset;
 
 class Aim_existDomain_result {
  public:
 
-  static const char* ascii_fingerprint; // = "D9D3B4421B1F23CB4063C80B484E7909";
-  static const uint8_t binary_fingerprint[16]; // = {0xD9,0xD3,0xB4,0x42,0x1B,0x1F,0x23,0xCB,0x40,0x63,0xC8,0x0B,0x48,0x4E,0x79,0x09};
+  static const char* ascii_fingerprint; // = "4E4D52AE9E2C985A4FFEF8CBF7946F6D";
+  static const uint8_t binary_fingerprint[16]; // = {0x4E,0x4D,0x52,0xAE,0x9E,0x2C,0x98,0x5A,0x4F,0xFE,0xF8,0xCB,0xF7,0x94,0x6F,0x6D};
 
   Aim_existDomain_result(const Aim_existDomain_result&);
   Aim_existDomain_result& operator=(const Aim_existDomain_result&);
@@ -2384,15 +2872,25 @@ class Aim_existDomain_result {
 
   virtual ~Aim_existDomain_result() throw();
   bool success;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_existDomain_result__isset __isset;
 
   void __set_success(const bool val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_existDomain_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_existDomain_result &rhs) const {
@@ -2408,19 +2906,23 @@ class Aim_existDomain_result {
 };
 
 typedef struct _Aim_existDomain_presult__isset {
-  _Aim_existDomain_presult__isset() : success(false) {}
+  _Aim_existDomain_presult__isset() : success(false), timeout(false), overload(false) {}
   bool success :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_existDomain_presult__isset;
 
 class Aim_existDomain_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "D9D3B4421B1F23CB4063C80B484E7909";
-  static const uint8_t binary_fingerprint[16]; // = {0xD9,0xD3,0xB4,0x42,0x1B,0x1F,0x23,0xCB,0x40,0x63,0xC8,0x0B,0x48,0x4E,0x79,0x09};
+  static const char* ascii_fingerprint; // = "4E4D52AE9E2C985A4FFEF8CBF7946F6D";
+  static const uint8_t binary_fingerprint[16]; // = {0x4E,0x4D,0x52,0xAE,0x9E,0x2C,0x98,0x5A,0x4F,0xFE,0xF8,0xCB,0xF7,0x94,0x6F,0x6D};
 
 
   virtual ~Aim_existDomain_presult() throw();
   bool* success;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_existDomain_presult__isset __isset;
 
@@ -2487,16 +2989,18 @@ class Aim_getDomainState_pargs {
 };
 
 typedef struct _Aim_getDomainState_result__isset {
-  _Aim_getDomainState_result__isset() : success(false), libvirtException(false) {}
+  _Aim_getDomainState_result__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
   bool success :1;
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDomainState_result__isset;
 
 class Aim_getDomainState_result {
  public:
 
-  static const char* ascii_fingerprint; // = "9A6B8977E69CEEB211584938C2E15A90";
-  static const uint8_t binary_fingerprint[16]; // = {0x9A,0x6B,0x89,0x77,0xE6,0x9C,0xEE,0xB2,0x11,0x58,0x49,0x38,0xC2,0xE1,0x5A,0x90};
+  static const char* ascii_fingerprint; // = "1AFCD283F34728E6CDBC15C22E797A26";
+  static const uint8_t binary_fingerprint[16]; // = {0x1A,0xFC,0xD2,0x83,0xF3,0x47,0x28,0xE6,0xCD,0xBC,0x15,0xC2,0x2E,0x79,0x7A,0x26};
 
   Aim_getDomainState_result(const Aim_getDomainState_result&);
   Aim_getDomainState_result& operator=(const Aim_getDomainState_result&);
@@ -2506,6 +3010,8 @@ class Aim_getDomainState_result {
   virtual ~Aim_getDomainState_result() throw();
   DomainState::type success;
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDomainState_result__isset __isset;
 
@@ -2513,12 +3019,20 @@ class Aim_getDomainState_result {
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_getDomainState_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_getDomainState_result &rhs) const {
@@ -2534,21 +3048,25 @@ class Aim_getDomainState_result {
 };
 
 typedef struct _Aim_getDomainState_presult__isset {
-  _Aim_getDomainState_presult__isset() : success(false), libvirtException(false) {}
+  _Aim_getDomainState_presult__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
   bool success :1;
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDomainState_presult__isset;
 
 class Aim_getDomainState_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "9A6B8977E69CEEB211584938C2E15A90";
-  static const uint8_t binary_fingerprint[16]; // = {0x9A,0x6B,0x89,0x77,0xE6,0x9C,0xEE,0xB2,0x11,0x58,0x49,0x38,0xC2,0xE1,0x5A,0x90};
+  static const char* ascii_fingerprint; // = "1AFCD283F34728E6CDBC15C22E797A26";
+  static const uint8_t binary_fingerprint[16]; // = {0x1A,0xFC,0xD2,0x83,0xF3,0x47,0x28,0xE6,0xCD,0xBC,0x15,0xC2,0x2E,0x79,0x7A,0x26};
 
 
   virtual ~Aim_getDomainState_presult() throw();
   DomainState::type* success;
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDomainState_presult__isset __isset;
 
@@ -2615,16 +3133,18 @@ class Aim_getDomainInfo_pargs {
 };
 
 typedef struct _Aim_getDomainInfo_result__isset {
-  _Aim_getDomainInfo_result__isset() : success(false), libvirtException(false) {}
+  _Aim_getDomainInfo_result__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
   bool success :1;
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDomainInfo_result__isset;
 
 class Aim_getDomainInfo_result {
  public:
 
-  static const char* ascii_fingerprint; // = "8EF274FF0709239A970D99D8D4EA7A39";
-  static const uint8_t binary_fingerprint[16]; // = {0x8E,0xF2,0x74,0xFF,0x07,0x09,0x23,0x9A,0x97,0x0D,0x99,0xD8,0xD4,0xEA,0x7A,0x39};
+  static const char* ascii_fingerprint; // = "783BF20ECB67876B314ED37EDAC79369";
+  static const uint8_t binary_fingerprint[16]; // = {0x78,0x3B,0xF2,0x0E,0xCB,0x67,0x87,0x6B,0x31,0x4E,0xD3,0x7E,0xDA,0xC7,0x93,0x69};
 
   Aim_getDomainInfo_result(const Aim_getDomainInfo_result&);
   Aim_getDomainInfo_result& operator=(const Aim_getDomainInfo_result&);
@@ -2634,6 +3154,8 @@ class Aim_getDomainInfo_result {
   virtual ~Aim_getDomainInfo_result() throw();
   DomainInfo success;
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDomainInfo_result__isset __isset;
 
@@ -2641,12 +3163,20 @@ class Aim_getDomainInfo_result {
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_getDomainInfo_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_getDomainInfo_result &rhs) const {
@@ -2662,21 +3192,25 @@ class Aim_getDomainInfo_result {
 };
 
 typedef struct _Aim_getDomainInfo_presult__isset {
-  _Aim_getDomainInfo_presult__isset() : success(false), libvirtException(false) {}
+  _Aim_getDomainInfo_presult__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
   bool success :1;
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDomainInfo_presult__isset;
 
 class Aim_getDomainInfo_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "8EF274FF0709239A970D99D8D4EA7A39";
-  static const uint8_t binary_fingerprint[16]; // = {0x8E,0xF2,0x74,0xFF,0x07,0x09,0x23,0x9A,0x97,0x0D,0x99,0xD8,0xD4,0xEA,0x7A,0x39};
+  static const char* ascii_fingerprint; // = "783BF20ECB67876B314ED37EDAC79369";
+  static const uint8_t binary_fingerprint[16]; // = {0x78,0x3B,0xF2,0x0E,0xCB,0x67,0x87,0x6B,0x31,0x4E,0xD3,0x7E,0xDA,0xC7,0x93,0x69};
 
 
   virtual ~Aim_getDomainInfo_presult() throw();
   DomainInfo* success;
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDomainInfo_presult__isset __isset;
 
@@ -2731,16 +3265,18 @@ class Aim_getDomains_pargs {
 };
 
 typedef struct _Aim_getDomains_result__isset {
-  _Aim_getDomains_result__isset() : success(false), libvirtException(false) {}
+  _Aim_getDomains_result__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
   bool success :1;
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDomains_result__isset;
 
 class Aim_getDomains_result {
  public:
 
-  static const char* ascii_fingerprint; // = "DD2CDF872EFCB14B61F0AC637C8EA516";
-  static const uint8_t binary_fingerprint[16]; // = {0xDD,0x2C,0xDF,0x87,0x2E,0xFC,0xB1,0x4B,0x61,0xF0,0xAC,0x63,0x7C,0x8E,0xA5,0x16};
+  static const char* ascii_fingerprint; // = "7821F954C11609AAA4803218ADDD050D";
+  static const uint8_t binary_fingerprint[16]; // = {0x78,0x21,0xF9,0x54,0xC1,0x16,0x09,0xAA,0xA4,0x80,0x32,0x18,0xAD,0xDD,0x05,0x0D};
 
   Aim_getDomains_result(const Aim_getDomains_result&);
   Aim_getDomains_result& operator=(const Aim_getDomains_result&);
@@ -2750,6 +3286,8 @@ class Aim_getDomains_result {
   virtual ~Aim_getDomains_result() throw();
   std::vector<DomainInfo>  success;
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDomains_result__isset __isset;
 
@@ -2757,12 +3295,20 @@ class Aim_getDomains_result {
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_getDomains_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_getDomains_result &rhs) const {
@@ -2778,21 +3324,25 @@ class Aim_getDomains_result {
 };
 
 typedef struct _Aim_getDomains_presult__isset {
-  _Aim_getDomains_presult__isset() : success(false), libvirtException(false) {}
+  _Aim_getDomains_presult__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
   bool success :1;
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDomains_presult__isset;
 
 class Aim_getDomains_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "DD2CDF872EFCB14B61F0AC637C8EA516";
-  static const uint8_t binary_fingerprint[16]; // = {0xDD,0x2C,0xDF,0x87,0x2E,0xFC,0xB1,0x4B,0x61,0xF0,0xAC,0x63,0x7C,0x8E,0xA5,0x16};
+  static const char* ascii_fingerprint; // = "7821F954C11609AAA4803218ADDD050D";
+  static const uint8_t binary_fingerprint[16]; // = {0x78,0x21,0xF9,0x54,0xC1,0x16,0x09,0xAA,0xA4,0x80,0x32,0x18,0xAD,0xDD,0x05,0x0D};
 
 
   virtual ~Aim_getDomains_presult() throw();
   std::vector<DomainInfo> * success;
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDomains_presult__isset __isset;
 
@@ -2859,15 +3409,17 @@ class Aim_powerOn_pargs {
 };
 
 typedef struct _Aim_powerOn_result__isset {
-  _Aim_powerOn_result__isset() : libvirtException(false) {}
+  _Aim_powerOn_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_powerOn_result__isset;
 
 class Aim_powerOn_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_powerOn_result(const Aim_powerOn_result&);
   Aim_powerOn_result& operator=(const Aim_powerOn_result&);
@@ -2876,15 +3428,25 @@ class Aim_powerOn_result {
 
   virtual ~Aim_powerOn_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_powerOn_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_powerOn_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_powerOn_result &rhs) const {
@@ -2900,19 +3462,23 @@ class Aim_powerOn_result {
 };
 
 typedef struct _Aim_powerOn_presult__isset {
-  _Aim_powerOn_presult__isset() : libvirtException(false) {}
+  _Aim_powerOn_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_powerOn_presult__isset;
 
 class Aim_powerOn_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_powerOn_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_powerOn_presult__isset __isset;
 
@@ -2979,15 +3545,17 @@ class Aim_powerOff_pargs {
 };
 
 typedef struct _Aim_powerOff_result__isset {
-  _Aim_powerOff_result__isset() : libvirtException(false) {}
+  _Aim_powerOff_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_powerOff_result__isset;
 
 class Aim_powerOff_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_powerOff_result(const Aim_powerOff_result&);
   Aim_powerOff_result& operator=(const Aim_powerOff_result&);
@@ -2996,15 +3564,25 @@ class Aim_powerOff_result {
 
   virtual ~Aim_powerOff_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_powerOff_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_powerOff_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_powerOff_result &rhs) const {
@@ -3020,19 +3598,23 @@ class Aim_powerOff_result {
 };
 
 typedef struct _Aim_powerOff_presult__isset {
-  _Aim_powerOff_presult__isset() : libvirtException(false) {}
+  _Aim_powerOff_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_powerOff_presult__isset;
 
 class Aim_powerOff_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_powerOff_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_powerOff_presult__isset __isset;
 
@@ -3099,15 +3681,17 @@ class Aim_shutdown_pargs {
 };
 
 typedef struct _Aim_shutdown_result__isset {
-  _Aim_shutdown_result__isset() : libvirtException(false) {}
+  _Aim_shutdown_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_shutdown_result__isset;
 
 class Aim_shutdown_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_shutdown_result(const Aim_shutdown_result&);
   Aim_shutdown_result& operator=(const Aim_shutdown_result&);
@@ -3116,15 +3700,25 @@ class Aim_shutdown_result {
 
   virtual ~Aim_shutdown_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_shutdown_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_shutdown_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_shutdown_result &rhs) const {
@@ -3140,19 +3734,23 @@ class Aim_shutdown_result {
 };
 
 typedef struct _Aim_shutdown_presult__isset {
-  _Aim_shutdown_presult__isset() : libvirtException(false) {}
+  _Aim_shutdown_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_shutdown_presult__isset;
 
 class Aim_shutdown_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_shutdown_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_shutdown_presult__isset __isset;
 
@@ -3219,15 +3817,17 @@ class Aim_reset_pargs {
 };
 
 typedef struct _Aim_reset_result__isset {
-  _Aim_reset_result__isset() : libvirtException(false) {}
+  _Aim_reset_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_reset_result__isset;
 
 class Aim_reset_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_reset_result(const Aim_reset_result&);
   Aim_reset_result& operator=(const Aim_reset_result&);
@@ -3236,15 +3836,25 @@ class Aim_reset_result {
 
   virtual ~Aim_reset_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_reset_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_reset_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_reset_result &rhs) const {
@@ -3260,19 +3870,23 @@ class Aim_reset_result {
 };
 
 typedef struct _Aim_reset_presult__isset {
-  _Aim_reset_presult__isset() : libvirtException(false) {}
+  _Aim_reset_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_reset_presult__isset;
 
 class Aim_reset_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_reset_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_reset_presult__isset __isset;
 
@@ -3339,15 +3953,17 @@ class Aim_pause_pargs {
 };
 
 typedef struct _Aim_pause_result__isset {
-  _Aim_pause_result__isset() : libvirtException(false) {}
+  _Aim_pause_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_pause_result__isset;
 
 class Aim_pause_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_pause_result(const Aim_pause_result&);
   Aim_pause_result& operator=(const Aim_pause_result&);
@@ -3356,15 +3972,25 @@ class Aim_pause_result {
 
   virtual ~Aim_pause_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_pause_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_pause_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_pause_result &rhs) const {
@@ -3380,19 +4006,23 @@ class Aim_pause_result {
 };
 
 typedef struct _Aim_pause_presult__isset {
-  _Aim_pause_presult__isset() : libvirtException(false) {}
+  _Aim_pause_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_pause_presult__isset;
 
 class Aim_pause_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_pause_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_pause_presult__isset __isset;
 
@@ -3459,15 +4089,17 @@ class Aim_resume_pargs {
 };
 
 typedef struct _Aim_resume_result__isset {
-  _Aim_resume_result__isset() : libvirtException(false) {}
+  _Aim_resume_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_resume_result__isset;
 
 class Aim_resume_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_resume_result(const Aim_resume_result&);
   Aim_resume_result& operator=(const Aim_resume_result&);
@@ -3476,15 +4108,25 @@ class Aim_resume_result {
 
   virtual ~Aim_resume_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_resume_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_resume_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_resume_result &rhs) const {
@@ -3500,19 +4142,23 @@ class Aim_resume_result {
 };
 
 typedef struct _Aim_resume_presult__isset {
-  _Aim_resume_presult__isset() : libvirtException(false) {}
+  _Aim_resume_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_resume_presult__isset;
 
 class Aim_resume_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_resume_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_resume_presult__isset __isset;
 
@@ -3600,15 +4246,17 @@ class Aim_createISCSIStoragePool_pargs {
 };
 
 typedef struct _Aim_createISCSIStoragePool_result__isset {
-  _Aim_createISCSIStoragePool_result__isset() : libvirtException(false) {}
+  _Aim_createISCSIStoragePool_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_createISCSIStoragePool_result__isset;
 
 class Aim_createISCSIStoragePool_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_createISCSIStoragePool_result(const Aim_createISCSIStoragePool_result&);
   Aim_createISCSIStoragePool_result& operator=(const Aim_createISCSIStoragePool_result&);
@@ -3617,15 +4265,25 @@ class Aim_createISCSIStoragePool_result {
 
   virtual ~Aim_createISCSIStoragePool_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_createISCSIStoragePool_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_createISCSIStoragePool_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_createISCSIStoragePool_result &rhs) const {
@@ -3641,19 +4299,23 @@ class Aim_createISCSIStoragePool_result {
 };
 
 typedef struct _Aim_createISCSIStoragePool_presult__isset {
-  _Aim_createISCSIStoragePool_presult__isset() : libvirtException(false) {}
+  _Aim_createISCSIStoragePool_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_createISCSIStoragePool_presult__isset;
 
 class Aim_createISCSIStoragePool_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_createISCSIStoragePool_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_createISCSIStoragePool_presult__isset __isset;
 
@@ -3741,15 +4403,17 @@ class Aim_createNFSStoragePool_pargs {
 };
 
 typedef struct _Aim_createNFSStoragePool_result__isset {
-  _Aim_createNFSStoragePool_result__isset() : libvirtException(false) {}
+  _Aim_createNFSStoragePool_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_createNFSStoragePool_result__isset;
 
 class Aim_createNFSStoragePool_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_createNFSStoragePool_result(const Aim_createNFSStoragePool_result&);
   Aim_createNFSStoragePool_result& operator=(const Aim_createNFSStoragePool_result&);
@@ -3758,15 +4422,25 @@ class Aim_createNFSStoragePool_result {
 
   virtual ~Aim_createNFSStoragePool_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_createNFSStoragePool_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_createNFSStoragePool_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_createNFSStoragePool_result &rhs) const {
@@ -3782,19 +4456,23 @@ class Aim_createNFSStoragePool_result {
 };
 
 typedef struct _Aim_createNFSStoragePool_presult__isset {
-  _Aim_createNFSStoragePool_presult__isset() : libvirtException(false) {}
+  _Aim_createNFSStoragePool_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_createNFSStoragePool_presult__isset;
 
 class Aim_createNFSStoragePool_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_createNFSStoragePool_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_createNFSStoragePool_presult__isset __isset;
 
@@ -3868,15 +4546,17 @@ class Aim_createDirStoragePool_pargs {
 };
 
 typedef struct _Aim_createDirStoragePool_result__isset {
-  _Aim_createDirStoragePool_result__isset() : libvirtException(false) {}
+  _Aim_createDirStoragePool_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_createDirStoragePool_result__isset;
 
 class Aim_createDirStoragePool_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_createDirStoragePool_result(const Aim_createDirStoragePool_result&);
   Aim_createDirStoragePool_result& operator=(const Aim_createDirStoragePool_result&);
@@ -3885,15 +4565,25 @@ class Aim_createDirStoragePool_result {
 
   virtual ~Aim_createDirStoragePool_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_createDirStoragePool_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_createDirStoragePool_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_createDirStoragePool_result &rhs) const {
@@ -3909,19 +4599,23 @@ class Aim_createDirStoragePool_result {
 };
 
 typedef struct _Aim_createDirStoragePool_presult__isset {
-  _Aim_createDirStoragePool_presult__isset() : libvirtException(false) {}
+  _Aim_createDirStoragePool_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_createDirStoragePool_presult__isset;
 
 class Aim_createDirStoragePool_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_createDirStoragePool_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_createDirStoragePool_presult__isset __isset;
 
@@ -4016,15 +4710,17 @@ class Aim_createDisk_pargs {
 };
 
 typedef struct _Aim_createDisk_result__isset {
-  _Aim_createDisk_result__isset() : libvirtException(false) {}
+  _Aim_createDisk_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_createDisk_result__isset;
 
 class Aim_createDisk_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_createDisk_result(const Aim_createDisk_result&);
   Aim_createDisk_result& operator=(const Aim_createDisk_result&);
@@ -4033,15 +4729,25 @@ class Aim_createDisk_result {
 
   virtual ~Aim_createDisk_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_createDisk_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_createDisk_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_createDisk_result &rhs) const {
@@ -4057,19 +4763,23 @@ class Aim_createDisk_result {
 };
 
 typedef struct _Aim_createDisk_presult__isset {
-  _Aim_createDisk_presult__isset() : libvirtException(false) {}
+  _Aim_createDisk_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_createDisk_presult__isset;
 
 class Aim_createDisk_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_createDisk_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_createDisk_presult__isset __isset;
 
@@ -4143,15 +4853,17 @@ class Aim_deleteDisk_pargs {
 };
 
 typedef struct _Aim_deleteDisk_result__isset {
-  _Aim_deleteDisk_result__isset() : libvirtException(false) {}
+  _Aim_deleteDisk_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_deleteDisk_result__isset;
 
 class Aim_deleteDisk_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_deleteDisk_result(const Aim_deleteDisk_result&);
   Aim_deleteDisk_result& operator=(const Aim_deleteDisk_result&);
@@ -4160,15 +4872,25 @@ class Aim_deleteDisk_result {
 
   virtual ~Aim_deleteDisk_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_deleteDisk_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_deleteDisk_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_deleteDisk_result &rhs) const {
@@ -4184,19 +4906,23 @@ class Aim_deleteDisk_result {
 };
 
 typedef struct _Aim_deleteDisk_presult__isset {
-  _Aim_deleteDisk_presult__isset() : libvirtException(false) {}
+  _Aim_deleteDisk_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_deleteDisk_presult__isset;
 
 class Aim_deleteDisk_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_deleteDisk_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_deleteDisk_presult__isset __isset;
 
@@ -4277,15 +5003,17 @@ class Aim_resizeVol_pargs {
 };
 
 typedef struct _Aim_resizeVol_result__isset {
-  _Aim_resizeVol_result__isset() : libvirtException(false) {}
+  _Aim_resizeVol_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_resizeVol_result__isset;
 
 class Aim_resizeVol_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_resizeVol_result(const Aim_resizeVol_result&);
   Aim_resizeVol_result& operator=(const Aim_resizeVol_result&);
@@ -4294,15 +5022,25 @@ class Aim_resizeVol_result {
 
   virtual ~Aim_resizeVol_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_resizeVol_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_resizeVol_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_resizeVol_result &rhs) const {
@@ -4318,19 +5056,23 @@ class Aim_resizeVol_result {
 };
 
 typedef struct _Aim_resizeVol_presult__isset {
-  _Aim_resizeVol_presult__isset() : libvirtException(false) {}
+  _Aim_resizeVol_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_resizeVol_presult__isset;
 
 class Aim_resizeVol_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_resizeVol_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_resizeVol_presult__isset __isset;
 
@@ -4411,15 +5153,17 @@ class Aim_resizeDisk_pargs {
 };
 
 typedef struct _Aim_resizeDisk_result__isset {
-  _Aim_resizeDisk_result__isset() : libvirtException(false) {}
+  _Aim_resizeDisk_result__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_resizeDisk_result__isset;
 
 class Aim_resizeDisk_result {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
   Aim_resizeDisk_result(const Aim_resizeDisk_result&);
   Aim_resizeDisk_result& operator=(const Aim_resizeDisk_result&);
@@ -4428,15 +5172,25 @@ class Aim_resizeDisk_result {
 
   virtual ~Aim_resizeDisk_result() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_resizeDisk_result__isset __isset;
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_resizeDisk_result & rhs) const
   {
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_resizeDisk_result &rhs) const {
@@ -4452,19 +5206,23 @@ class Aim_resizeDisk_result {
 };
 
 typedef struct _Aim_resizeDisk_presult__isset {
-  _Aim_resizeDisk_presult__isset() : libvirtException(false) {}
+  _Aim_resizeDisk_presult__isset() : libvirtException(false), timeout(false), overload(false) {}
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_resizeDisk_presult__isset;
 
 class Aim_resizeDisk_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "EAF4C873F89672ABB97ED74219F64E64";
-  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xF4,0xC8,0x73,0xF8,0x96,0x72,0xAB,0xB9,0x7E,0xD7,0x42,0x19,0xF6,0x4E,0x64};
+  static const char* ascii_fingerprint; // = "E3B890DCECED148E0736604875F4FEF6";
+  static const uint8_t binary_fingerprint[16]; // = {0xE3,0xB8,0x90,0xDC,0xEC,0xED,0x14,0x8E,0x07,0x36,0x60,0x48,0x75,0xF4,0xFE,0xF6};
 
 
   virtual ~Aim_resizeDisk_presult() throw();
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_resizeDisk_presult__isset __isset;
 
@@ -4538,16 +5296,18 @@ class Aim_getDomainBlockInfo_pargs {
 };
 
 typedef struct _Aim_getDomainBlockInfo_result__isset {
-  _Aim_getDomainBlockInfo_result__isset() : success(false), libvirtException(false) {}
+  _Aim_getDomainBlockInfo_result__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
   bool success :1;
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDomainBlockInfo_result__isset;
 
 class Aim_getDomainBlockInfo_result {
  public:
 
-  static const char* ascii_fingerprint; // = "157676735ACB58A8048DF5346496F74C";
-  static const uint8_t binary_fingerprint[16]; // = {0x15,0x76,0x76,0x73,0x5A,0xCB,0x58,0xA8,0x04,0x8D,0xF5,0x34,0x64,0x96,0xF7,0x4C};
+  static const char* ascii_fingerprint; // = "D9C24DC84490AD58746DE51C0561A99C";
+  static const uint8_t binary_fingerprint[16]; // = {0xD9,0xC2,0x4D,0xC8,0x44,0x90,0xAD,0x58,0x74,0x6D,0xE5,0x1C,0x05,0x61,0xA9,0x9C};
 
   Aim_getDomainBlockInfo_result(const Aim_getDomainBlockInfo_result&);
   Aim_getDomainBlockInfo_result& operator=(const Aim_getDomainBlockInfo_result&);
@@ -4557,6 +5317,8 @@ class Aim_getDomainBlockInfo_result {
   virtual ~Aim_getDomainBlockInfo_result() throw();
   DomainBlockInfo success;
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDomainBlockInfo_result__isset __isset;
 
@@ -4564,12 +5326,20 @@ class Aim_getDomainBlockInfo_result {
 
   void __set_libvirtException(const LibvirtException& val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_getDomainBlockInfo_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(libvirtException == rhs.libvirtException))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_getDomainBlockInfo_result &rhs) const {
@@ -4585,21 +5355,25 @@ class Aim_getDomainBlockInfo_result {
 };
 
 typedef struct _Aim_getDomainBlockInfo_presult__isset {
-  _Aim_getDomainBlockInfo_presult__isset() : success(false), libvirtException(false) {}
+  _Aim_getDomainBlockInfo_presult__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
   bool success :1;
   bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDomainBlockInfo_presult__isset;
 
 class Aim_getDomainBlockInfo_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "157676735ACB58A8048DF5346496F74C";
-  static const uint8_t binary_fingerprint[16]; // = {0x15,0x76,0x76,0x73,0x5A,0xCB,0x58,0xA8,0x04,0x8D,0xF5,0x34,0x64,0x96,0xF7,0x4C};
+  static const char* ascii_fingerprint; // = "D9C24DC84490AD58746DE51C0561A99C";
+  static const uint8_t binary_fingerprint[16]; // = {0xD9,0xC2,0x4D,0xC8,0x44,0x90,0xAD,0x58,0x74,0x6D,0xE5,0x1C,0x05,0x61,0xA9,0x9C};
 
 
   virtual ~Aim_getDomainBlockInfo_presult() throw();
   DomainBlockInfo* success;
   LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDomainBlockInfo_presult__isset __isset;
 
@@ -4673,15 +5447,17 @@ class Aim_getDatapoints_pargs {
 };
 
 typedef struct _Aim_getDatapoints_result__isset {
-  _Aim_getDatapoints_result__isset() : success(false) {}
+  _Aim_getDatapoints_result__isset() : success(false), timeout(false), overload(false) {}
   bool success :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDatapoints_result__isset;
 
 class Aim_getDatapoints_result {
  public:
 
-  static const char* ascii_fingerprint; // = "D1E436EC019DB1D4F6EF23DE9D2CB9F9";
-  static const uint8_t binary_fingerprint[16]; // = {0xD1,0xE4,0x36,0xEC,0x01,0x9D,0xB1,0xD4,0xF6,0xEF,0x23,0xDE,0x9D,0x2C,0xB9,0xF9};
+  static const char* ascii_fingerprint; // = "59F1AB031E41809900023F7409E7A69B";
+  static const uint8_t binary_fingerprint[16]; // = {0x59,0xF1,0xAB,0x03,0x1E,0x41,0x80,0x99,0x00,0x02,0x3F,0x74,0x09,0xE7,0xA6,0x9B};
 
   Aim_getDatapoints_result(const Aim_getDatapoints_result&);
   Aim_getDatapoints_result& operator=(const Aim_getDatapoints_result&);
@@ -4690,15 +5466,25 @@ class Aim_getDatapoints_result {
 
   virtual ~Aim_getDatapoints_result() throw();
   std::vector<Measure>  success;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDatapoints_result__isset __isset;
 
   void __set_success(const std::vector<Measure> & val);
 
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
   bool operator == (const Aim_getDatapoints_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
     return true;
   }
   bool operator != (const Aim_getDatapoints_result &rhs) const {
@@ -4714,19 +5500,23 @@ class Aim_getDatapoints_result {
 };
 
 typedef struct _Aim_getDatapoints_presult__isset {
-  _Aim_getDatapoints_presult__isset() : success(false) {}
+  _Aim_getDatapoints_presult__isset() : success(false), timeout(false), overload(false) {}
   bool success :1;
+  bool timeout :1;
+  bool overload :1;
 } _Aim_getDatapoints_presult__isset;
 
 class Aim_getDatapoints_presult {
  public:
 
-  static const char* ascii_fingerprint; // = "D1E436EC019DB1D4F6EF23DE9D2CB9F9";
-  static const uint8_t binary_fingerprint[16]; // = {0xD1,0xE4,0x36,0xEC,0x01,0x9D,0xB1,0xD4,0xF6,0xEF,0x23,0xDE,0x9D,0x2C,0xB9,0xF9};
+  static const char* ascii_fingerprint; // = "59F1AB031E41809900023F7409E7A69B";
+  static const uint8_t binary_fingerprint[16]; // = {0x59,0xF1,0xAB,0x03,0x1E,0x41,0x80,0x99,0x00,0x02,0x3F,0x74,0x09,0xE7,0xA6,0x9B};
 
 
   virtual ~Aim_getDatapoints_presult() throw();
   std::vector<Measure> * success;
+  TimeoutException timeout;
+  OverloadException overload;
 
   _Aim_getDatapoints_presult__isset __isset;
 
@@ -4799,12 +5589,17 @@ class Aim_upload_pargs {
   friend std::ostream& operator<<(std::ostream& out, const Aim_upload_pargs& obj);
 };
 
+typedef struct _Aim_upload_result__isset {
+  _Aim_upload_result__isset() : timeout(false), overload(false) {}
+  bool timeout :1;
+  bool overload :1;
+} _Aim_upload_result__isset;
 
 class Aim_upload_result {
  public:
 
-  static const char* ascii_fingerprint; // = "99914B932BD37A50B983C5E7C90AE93B";
-  static const uint8_t binary_fingerprint[16]; // = {0x99,0x91,0x4B,0x93,0x2B,0xD3,0x7A,0x50,0xB9,0x83,0xC5,0xE7,0xC9,0x0A,0xE9,0x3B};
+  static const char* ascii_fingerprint; // = "D8BF65D3381F63BFC9BBE66D9FE15A61";
+  static const uint8_t binary_fingerprint[16]; // = {0xD8,0xBF,0x65,0xD3,0x38,0x1F,0x63,0xBF,0xC9,0xBB,0xE6,0x6D,0x9F,0xE1,0x5A,0x61};
 
   Aim_upload_result(const Aim_upload_result&);
   Aim_upload_result& operator=(const Aim_upload_result&);
@@ -4812,36 +5607,3401 @@ class Aim_upload_result {
   }
 
   virtual ~Aim_upload_result() throw();
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_upload_result__isset __isset;
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
 
-  bool operator == (const Aim_upload_result & /* rhs */) const
+  bool operator == (const Aim_upload_result & rhs) const
   {
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_upload_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_upload_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_upload_result& obj);
+};
+
+typedef struct _Aim_upload_presult__isset {
+  _Aim_upload_presult__isset() : timeout(false), overload(false) {}
+  bool timeout :1;
+  bool overload :1;
+} _Aim_upload_presult__isset;
+
+class Aim_upload_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "D8BF65D3381F63BFC9BBE66D9FE15A61";
+  static const uint8_t binary_fingerprint[16]; // = {0xD8,0xBF,0x65,0xD3,0x38,0x1F,0x63,0xBF,0xC9,0xBB,0xE6,0x6D,0x9F,0xE1,0x5A,0x61};
+
+
+  virtual ~Aim_upload_presult() throw();
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_upload_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_upload_presult& obj);
+};
+
+
+class Aim_getDomainsLite_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "99914B932BD37A50B983C5E7C90AE93B";
+  static const uint8_t binary_fingerprint[16]; // = {0x99,0x91,0x4B,0x93,0x2B,0xD3,0x7A,0x50,0xB9,0x83,0xC5,0xE7,0xC9,0x0A,0xE9,0x3B};
+
+  Aim_getDomainsLite_args(const Aim_getDomainsLite_args&);
+  Aim_getDomainsLite_args& operator=(const Aim_getDomainsLite_args&);
+  Aim_getDomainsLite_args() {
+  }
+
+  virtual ~Aim_getDomainsLite_args() throw();
+
+  bool operator == (const Aim_getDomainsLite_args & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Aim_getDomainsLite_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_getDomainsLite_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getDomainsLite_args& obj);
+};
+
+
+class Aim_getDomainsLite_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "99914B932BD37A50B983C5E7C90AE93B";
+  static const uint8_t binary_fingerprint[16]; // = {0x99,0x91,0x4B,0x93,0x2B,0xD3,0x7A,0x50,0xB9,0x83,0xC5,0xE7,0xC9,0x0A,0xE9,0x3B};
+
+
+  virtual ~Aim_getDomainsLite_pargs() throw();
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getDomainsLite_pargs& obj);
+};
+
+typedef struct _Aim_getDomainsLite_result__isset {
+  _Aim_getDomainsLite_result__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_getDomainsLite_result__isset;
+
+class Aim_getDomainsLite_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "7821F954C11609AAA4803218ADDD050D";
+  static const uint8_t binary_fingerprint[16]; // = {0x78,0x21,0xF9,0x54,0xC1,0x16,0x09,0xAA,0xA4,0x80,0x32,0x18,0xAD,0xDD,0x05,0x0D};
+
+  Aim_getDomainsLite_result(const Aim_getDomainsLite_result&);
+  Aim_getDomainsLite_result& operator=(const Aim_getDomainsLite_result&);
+  Aim_getDomainsLite_result() {
+  }
+
+  virtual ~Aim_getDomainsLite_result() throw();
+  std::vector<DomainInfo>  success;
+  LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_getDomainsLite_result__isset __isset;
+
+  void __set_success(const std::vector<DomainInfo> & val);
+
+  void __set_libvirtException(const LibvirtException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_getDomainsLite_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(libvirtException == rhs.libvirtException))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_getDomainsLite_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_getDomainsLite_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getDomainsLite_result& obj);
+};
+
+typedef struct _Aim_getDomainsLite_presult__isset {
+  _Aim_getDomainsLite_presult__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_getDomainsLite_presult__isset;
+
+class Aim_getDomainsLite_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "7821F954C11609AAA4803218ADDD050D";
+  static const uint8_t binary_fingerprint[16]; // = {0x78,0x21,0xF9,0x54,0xC1,0x16,0x09,0xAA,0xA4,0x80,0x32,0x18,0xAD,0xDD,0x05,0x0D};
+
+
+  virtual ~Aim_getDomainsLite_presult() throw();
+  std::vector<DomainInfo> * success;
+  LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_getDomainsLite_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getDomainsLite_presult& obj);
+};
+
+typedef struct _Aim_getDomainsWithFields_args__isset {
+  _Aim_getDomainsWithFields_args__isset() : fields(false) {}
+  bool fields :1;
+} _Aim_getDomainsWithFields_args__isset;
+
+class Aim_getDomainsWithFields_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "8BBB3D0C3B370CB38F2D1340BB79F0AA";
+  static const uint8_t binary_fingerprint[16]; // = {0x8B,0xBB,0x3D,0x0C,0x3B,0x37,0x0C,0xB3,0x8F,0x2D,0x13,0x40,0xBB,0x79,0xF0,0xAA};
+
+  Aim_getDomainsWithFields_args(const Aim_getDomainsWithFields_args&);
+  Aim_getDomainsWithFields_args& operator=(const Aim_getDomainsWithFields_args&);
+  Aim_getDomainsWithFields_args() : fields((DomainFields::type)0) {
+  }
+
+  virtual ~Aim_getDomainsWithFields_args() throw();
+  DomainFields::type fields;
+
+  _Aim_getDomainsWithFields_args__isset __isset;
+
+  void __set_fields(const DomainFields::type val);
+
+  bool operator == (const Aim_getDomainsWithFields_args & rhs) const
+  {
+    if (!(fields == rhs.fields))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_getDomainsWithFields_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_getDomainsWithFields_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getDomainsWithFields_args& obj);
+};
+
+
+class Aim_getDomainsWithFields_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "8BBB3D0C3B370CB38F2D1340BB79F0AA";
+  static const uint8_t binary_fingerprint[16]; // = {0x8B,0xBB,0x3D,0x0C,0x3B,0x37,0x0C,0xB3,0x8F,0x2D,0x13,0x40,0xBB,0x79,0xF0,0xAA};
+
+
+  virtual ~Aim_getDomainsWithFields_pargs() throw();
+  const DomainFields::type* fields;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getDomainsWithFields_pargs& obj);
+};
+
+typedef struct _Aim_getDomainsWithFields_result__isset {
+  _Aim_getDomainsWithFields_result__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_getDomainsWithFields_result__isset;
+
+class Aim_getDomainsWithFields_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "7821F954C11609AAA4803218ADDD050D";
+  static const uint8_t binary_fingerprint[16]; // = {0x78,0x21,0xF9,0x54,0xC1,0x16,0x09,0xAA,0xA4,0x80,0x32,0x18,0xAD,0xDD,0x05,0x0D};
+
+  Aim_getDomainsWithFields_result(const Aim_getDomainsWithFields_result&);
+  Aim_getDomainsWithFields_result& operator=(const Aim_getDomainsWithFields_result&);
+  Aim_getDomainsWithFields_result() {
+  }
+
+  virtual ~Aim_getDomainsWithFields_result() throw();
+  std::vector<DomainInfo>  success;
+  LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_getDomainsWithFields_result__isset __isset;
+
+  void __set_success(const std::vector<DomainInfo> & val);
+
+  void __set_libvirtException(const LibvirtException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_getDomainsWithFields_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(libvirtException == rhs.libvirtException))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_getDomainsWithFields_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_getDomainsWithFields_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getDomainsWithFields_result& obj);
+};
+
+typedef struct _Aim_getDomainsWithFields_presult__isset {
+  _Aim_getDomainsWithFields_presult__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_getDomainsWithFields_presult__isset;
+
+class Aim_getDomainsWithFields_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "7821F954C11609AAA4803218ADDD050D";
+  static const uint8_t binary_fingerprint[16]; // = {0x78,0x21,0xF9,0x54,0xC1,0x16,0x09,0xAA,0xA4,0x80,0x32,0x18,0xAD,0xDD,0x05,0x0D};
+
+
+  virtual ~Aim_getDomainsWithFields_presult() throw();
+  std::vector<DomainInfo> * success;
+  LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_getDomainsWithFields_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getDomainsWithFields_presult& obj);
+};
+
+typedef struct _Aim_getDomainsChangedSince_args__isset {
+  _Aim_getDomainsChangedSince_args__isset() : generation(false), fields(false) {}
+  bool generation :1;
+  bool fields :1;
+} _Aim_getDomainsChangedSince_args__isset;
+
+class Aim_getDomainsChangedSince_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "DFA40D9D2884599F3D1E7A57578F1384";
+  static const uint8_t binary_fingerprint[16]; // = {0xDF,0xA4,0x0D,0x9D,0x28,0x84,0x59,0x9F,0x3D,0x1E,0x7A,0x57,0x57,0x8F,0x13,0x84};
+
+  Aim_getDomainsChangedSince_args(const Aim_getDomainsChangedSince_args&);
+  Aim_getDomainsChangedSince_args& operator=(const Aim_getDomainsChangedSince_args&);
+  Aim_getDomainsChangedSince_args() : generation(0), fields((DomainFields::type)0) {
+  }
+
+  virtual ~Aim_getDomainsChangedSince_args() throw();
+  int64_t generation;
+  DomainFields::type fields;
+
+  _Aim_getDomainsChangedSince_args__isset __isset;
+
+  void __set_generation(const int64_t val);
+
+  void __set_fields(const DomainFields::type val);
+
+  bool operator == (const Aim_getDomainsChangedSince_args & rhs) const
+  {
+    if (!(generation == rhs.generation))
+      return false;
+    if (!(fields == rhs.fields))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_getDomainsChangedSince_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_getDomainsChangedSince_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getDomainsChangedSince_args& obj);
+};
+
+
+class Aim_getDomainsChangedSince_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "DFA40D9D2884599F3D1E7A57578F1384";
+  static const uint8_t binary_fingerprint[16]; // = {0xDF,0xA4,0x0D,0x9D,0x28,0x84,0x59,0x9F,0x3D,0x1E,0x7A,0x57,0x57,0x8F,0x13,0x84};
+
+
+  virtual ~Aim_getDomainsChangedSince_pargs() throw();
+  const int64_t* generation;
+  const DomainFields::type* fields;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getDomainsChangedSince_pargs& obj);
+};
+
+typedef struct _Aim_getDomainsChangedSince_result__isset {
+  _Aim_getDomainsChangedSince_result__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_getDomainsChangedSince_result__isset;
+
+class Aim_getDomainsChangedSince_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "A8C995F61BD3841374A363121DA70EED";
+  static const uint8_t binary_fingerprint[16]; // = {0xA8,0xC9,0x95,0xF6,0x1B,0xD3,0x84,0x13,0x74,0xA3,0x63,0x12,0x1D,0xA7,0x0E,0xED};
+
+  Aim_getDomainsChangedSince_result(const Aim_getDomainsChangedSince_result&);
+  Aim_getDomainsChangedSince_result& operator=(const Aim_getDomainsChangedSince_result&);
+  Aim_getDomainsChangedSince_result() {
+  }
+
+  virtual ~Aim_getDomainsChangedSince_result() throw();
+  DomainChanges success;
+  LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_getDomainsChangedSince_result__isset __isset;
+
+  void __set_success(const DomainChanges& val);
+
+  void __set_libvirtException(const LibvirtException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_getDomainsChangedSince_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(libvirtException == rhs.libvirtException))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_getDomainsChangedSince_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_getDomainsChangedSince_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getDomainsChangedSince_result& obj);
+};
+
+typedef struct _Aim_getDomainsChangedSince_presult__isset {
+  _Aim_getDomainsChangedSince_presult__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_getDomainsChangedSince_presult__isset;
+
+class Aim_getDomainsChangedSince_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "A8C995F61BD3841374A363121DA70EED";
+  static const uint8_t binary_fingerprint[16]; // = {0xA8,0xC9,0x95,0xF6,0x1B,0xD3,0x84,0x13,0x74,0xA3,0x63,0x12,0x1D,0xA7,0x0E,0xED};
+
+
+  virtual ~Aim_getDomainsChangedSince_presult() throw();
+  DomainChanges* success;
+  LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_getDomainsChangedSince_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getDomainsChangedSince_presult& obj);
+};
+
+typedef struct _Aim_waitForEvents_args__isset {
+  _Aim_waitForEvents_args__isset() : sinceId(false), timeoutMs(false) {}
+  bool sinceId :1;
+  bool timeoutMs :1;
+} _Aim_waitForEvents_args__isset;
+
+class Aim_waitForEvents_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "AFAFBCDB9822F9D1AA4E44188E720B47";
+  static const uint8_t binary_fingerprint[16]; // = {0xAF,0xAF,0xBC,0xDB,0x98,0x22,0xF9,0xD1,0xAA,0x4E,0x44,0x18,0x8E,0x72,0x0B,0x47};
+
+  Aim_waitForEvents_args(const Aim_waitForEvents_args&);
+  Aim_waitForEvents_args& operator=(const Aim_waitForEvents_args&);
+  Aim_waitForEvents_args() : sinceId(0), timeoutMs(0) {
+  }
+
+  virtual ~Aim_waitForEvents_args() throw();
+  int64_t sinceId;
+  int32_t timeoutMs;
+
+  _Aim_waitForEvents_args__isset __isset;
+
+  void __set_sinceId(const int64_t val);
+
+  void __set_timeoutMs(const int32_t val);
+
+  bool operator == (const Aim_waitForEvents_args & rhs) const
+  {
+    if (!(sinceId == rhs.sinceId))
+      return false;
+    if (!(timeoutMs == rhs.timeoutMs))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_waitForEvents_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_waitForEvents_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_waitForEvents_args& obj);
+};
+
+
+class Aim_waitForEvents_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "AFAFBCDB9822F9D1AA4E44188E720B47";
+  static const uint8_t binary_fingerprint[16]; // = {0xAF,0xAF,0xBC,0xDB,0x98,0x22,0xF9,0xD1,0xAA,0x4E,0x44,0x18,0x8E,0x72,0x0B,0x47};
+
+
+  virtual ~Aim_waitForEvents_pargs() throw();
+  const int64_t* sinceId;
+  const int32_t* timeoutMs;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_waitForEvents_pargs& obj);
+};
+
+typedef struct _Aim_waitForEvents_result__isset {
+  _Aim_waitForEvents_result__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_waitForEvents_result__isset;
+
+class Aim_waitForEvents_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "97819CACB6B0EBF91D582399E25B45AF";
+  static const uint8_t binary_fingerprint[16]; // = {0x97,0x81,0x9C,0xAC,0xB6,0xB0,0xEB,0xF9,0x1D,0x58,0x23,0x99,0xE2,0x5B,0x45,0xAF};
+
+  Aim_waitForEvents_result(const Aim_waitForEvents_result&);
+  Aim_waitForEvents_result& operator=(const Aim_waitForEvents_result&);
+  Aim_waitForEvents_result() {
+  }
+
+  virtual ~Aim_waitForEvents_result() throw();
+  DomainEvents success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_waitForEvents_result__isset __isset;
+
+  void __set_success(const DomainEvents& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_waitForEvents_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_waitForEvents_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_waitForEvents_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_waitForEvents_result& obj);
+};
+
+typedef struct _Aim_waitForEvents_presult__isset {
+  _Aim_waitForEvents_presult__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_waitForEvents_presult__isset;
+
+class Aim_waitForEvents_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "97819CACB6B0EBF91D582399E25B45AF";
+  static const uint8_t binary_fingerprint[16]; // = {0x97,0x81,0x9C,0xAC,0xB6,0xB0,0xEB,0xF9,0x1D,0x58,0x23,0x99,0xE2,0x5B,0x45,0xAF};
+
+
+  virtual ~Aim_waitForEvents_presult() throw();
+  DomainEvents* success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_waitForEvents_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_waitForEvents_presult& obj);
+};
+
+typedef struct _Aim_startCopyFromRepositoryToDatastore_args__isset {
+  _Aim_startCopyFromRepositoryToDatastore_args__isset() : virtualImageRepositoryPath(false), datastorePath(false), virtualMachineUUID(false) {}
+  bool virtualImageRepositoryPath :1;
+  bool datastorePath :1;
+  bool virtualMachineUUID :1;
+} _Aim_startCopyFromRepositoryToDatastore_args__isset;
+
+class Aim_startCopyFromRepositoryToDatastore_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "AB879940BD15B6B25691265F7384B271";
+  static const uint8_t binary_fingerprint[16]; // = {0xAB,0x87,0x99,0x40,0xBD,0x15,0xB6,0xB2,0x56,0x91,0x26,0x5F,0x73,0x84,0xB2,0x71};
+
+  Aim_startCopyFromRepositoryToDatastore_args(const Aim_startCopyFromRepositoryToDatastore_args&);
+  Aim_startCopyFromRepositoryToDatastore_args& operator=(const Aim_startCopyFromRepositoryToDatastore_args&);
+  Aim_startCopyFromRepositoryToDatastore_args() : virtualImageRepositoryPath(), datastorePath(), virtualMachineUUID() {
+  }
+
+  virtual ~Aim_startCopyFromRepositoryToDatastore_args() throw();
+  std::string virtualImageRepositoryPath;
+  std::string datastorePath;
+  std::string virtualMachineUUID;
+
+  _Aim_startCopyFromRepositoryToDatastore_args__isset __isset;
+
+  void __set_virtualImageRepositoryPath(const std::string& val);
+
+  void __set_datastorePath(const std::string& val);
+
+  void __set_virtualMachineUUID(const std::string& val);
+
+  bool operator == (const Aim_startCopyFromRepositoryToDatastore_args & rhs) const
+  {
+    if (!(virtualImageRepositoryPath == rhs.virtualImageRepositoryPath))
+      return false;
+    if (!(datastorePath == rhs.datastorePath))
+      return false;
+    if (!(virtualMachineUUID == rhs.virtualMachineUUID))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_startCopyFromRepositoryToDatastore_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_startCopyFromRepositoryToDatastore_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_startCopyFromRepositoryToDatastore_args& obj);
+};
+
+
+class Aim_startCopyFromRepositoryToDatastore_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "AB879940BD15B6B25691265F7384B271";
+  static const uint8_t binary_fingerprint[16]; // = {0xAB,0x87,0x99,0x40,0xBD,0x15,0xB6,0xB2,0x56,0x91,0x26,0x5F,0x73,0x84,0xB2,0x71};
+
+
+  virtual ~Aim_startCopyFromRepositoryToDatastore_pargs() throw();
+  const std::string* virtualImageRepositoryPath;
+  const std::string* datastorePath;
+  const std::string* virtualMachineUUID;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_startCopyFromRepositoryToDatastore_pargs& obj);
+};
+
+typedef struct _Aim_startCopyFromRepositoryToDatastore_result__isset {
+  _Aim_startCopyFromRepositoryToDatastore_result__isset() : success(false), re(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_startCopyFromRepositoryToDatastore_result__isset;
+
+class Aim_startCopyFromRepositoryToDatastore_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "77CCA41D9074A16D3E59690B12F943D0";
+  static const uint8_t binary_fingerprint[16]; // = {0x77,0xCC,0xA4,0x1D,0x90,0x74,0xA1,0x6D,0x3E,0x59,0x69,0x0B,0x12,0xF9,0x43,0xD0};
+
+  Aim_startCopyFromRepositoryToDatastore_result(const Aim_startCopyFromRepositoryToDatastore_result&);
+  Aim_startCopyFromRepositoryToDatastore_result& operator=(const Aim_startCopyFromRepositoryToDatastore_result&);
+  Aim_startCopyFromRepositoryToDatastore_result() : success() {
+  }
+
+  virtual ~Aim_startCopyFromRepositoryToDatastore_result() throw();
+  std::string success;
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_startCopyFromRepositoryToDatastore_result__isset __isset;
+
+  void __set_success(const std::string& val);
+
+  void __set_re(const RimpException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_startCopyFromRepositoryToDatastore_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(re == rhs.re))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_startCopyFromRepositoryToDatastore_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_startCopyFromRepositoryToDatastore_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_startCopyFromRepositoryToDatastore_result& obj);
+};
+
+typedef struct _Aim_startCopyFromRepositoryToDatastore_presult__isset {
+  _Aim_startCopyFromRepositoryToDatastore_presult__isset() : success(false), re(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_startCopyFromRepositoryToDatastore_presult__isset;
+
+class Aim_startCopyFromRepositoryToDatastore_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "77CCA41D9074A16D3E59690B12F943D0";
+  static const uint8_t binary_fingerprint[16]; // = {0x77,0xCC,0xA4,0x1D,0x90,0x74,0xA1,0x6D,0x3E,0x59,0x69,0x0B,0x12,0xF9,0x43,0xD0};
+
+
+  virtual ~Aim_startCopyFromRepositoryToDatastore_presult() throw();
+  std::string* success;
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_startCopyFromRepositoryToDatastore_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_startCopyFromRepositoryToDatastore_presult& obj);
+};
+
+typedef struct _Aim_startCopyFromDatastoreToRepository_args__isset {
+  _Aim_startCopyFromDatastoreToRepository_args__isset() : virtualMachineUUID(false), snapshot(false), destinationRepositoryPath(false), sourceDatastorePath(false) {}
+  bool virtualMachineUUID :1;
+  bool snapshot :1;
+  bool destinationRepositoryPath :1;
+  bool sourceDatastorePath :1;
+} _Aim_startCopyFromDatastoreToRepository_args__isset;
+
+class Aim_startCopyFromDatastoreToRepository_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "C93D890311F28844166CF6E571EB3AC2";
+  static const uint8_t binary_fingerprint[16]; // = {0xC9,0x3D,0x89,0x03,0x11,0xF2,0x88,0x44,0x16,0x6C,0xF6,0xE5,0x71,0xEB,0x3A,0xC2};
+
+  Aim_startCopyFromDatastoreToRepository_args(const Aim_startCopyFromDatastoreToRepository_args&);
+  Aim_startCopyFromDatastoreToRepository_args& operator=(const Aim_startCopyFromDatastoreToRepository_args&);
+  Aim_startCopyFromDatastoreToRepository_args() : virtualMachineUUID(), snapshot(), destinationRepositoryPath(), sourceDatastorePath() {
+  }
+
+  virtual ~Aim_startCopyFromDatastoreToRepository_args() throw();
+  std::string virtualMachineUUID;
+  std::string snapshot;
+  std::string destinationRepositoryPath;
+  std::string sourceDatastorePath;
+
+  _Aim_startCopyFromDatastoreToRepository_args__isset __isset;
+
+  void __set_virtualMachineUUID(const std::string& val);
+
+  void __set_snapshot(const std::string& val);
+
+  void __set_destinationRepositoryPath(const std::string& val);
+
+  void __set_sourceDatastorePath(const std::string& val);
+
+  bool operator == (const Aim_startCopyFromDatastoreToRepository_args & rhs) const
+  {
+    if (!(virtualMachineUUID == rhs.virtualMachineUUID))
+      return false;
+    if (!(snapshot == rhs.snapshot))
+      return false;
+    if (!(destinationRepositoryPath == rhs.destinationRepositoryPath))
+      return false;
+    if (!(sourceDatastorePath == rhs.sourceDatastorePath))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_startCopyFromDatastoreToRepository_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_startCopyFromDatastoreToRepository_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_startCopyFromDatastoreToRepository_args& obj);
+};
+
+
+class Aim_startCopyFromDatastoreToRepository_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "C93D890311F28844166CF6E571EB3AC2";
+  static const uint8_t binary_fingerprint[16]; // = {0xC9,0x3D,0x89,0x03,0x11,0xF2,0x88,0x44,0x16,0x6C,0xF6,0xE5,0x71,0xEB,0x3A,0xC2};
+
+
+  virtual ~Aim_startCopyFromDatastoreToRepository_pargs() throw();
+  const std::string* virtualMachineUUID;
+  const std::string* snapshot;
+  const std::string* destinationRepositoryPath;
+  const std::string* sourceDatastorePath;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_startCopyFromDatastoreToRepository_pargs& obj);
+};
+
+typedef struct _Aim_startCopyFromDatastoreToRepository_result__isset {
+  _Aim_startCopyFromDatastoreToRepository_result__isset() : success(false), re(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_startCopyFromDatastoreToRepository_result__isset;
+
+class Aim_startCopyFromDatastoreToRepository_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "77CCA41D9074A16D3E59690B12F943D0";
+  static const uint8_t binary_fingerprint[16]; // = {0x77,0xCC,0xA4,0x1D,0x90,0x74,0xA1,0x6D,0x3E,0x59,0x69,0x0B,0x12,0xF9,0x43,0xD0};
+
+  Aim_startCopyFromDatastoreToRepository_result(const Aim_startCopyFromDatastoreToRepository_result&);
+  Aim_startCopyFromDatastoreToRepository_result& operator=(const Aim_startCopyFromDatastoreToRepository_result&);
+  Aim_startCopyFromDatastoreToRepository_result() : success() {
+  }
+
+  virtual ~Aim_startCopyFromDatastoreToRepository_result() throw();
+  std::string success;
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_startCopyFromDatastoreToRepository_result__isset __isset;
+
+  void __set_success(const std::string& val);
+
+  void __set_re(const RimpException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_startCopyFromDatastoreToRepository_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(re == rhs.re))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_startCopyFromDatastoreToRepository_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_startCopyFromDatastoreToRepository_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_startCopyFromDatastoreToRepository_result& obj);
+};
+
+typedef struct _Aim_startCopyFromDatastoreToRepository_presult__isset {
+  _Aim_startCopyFromDatastoreToRepository_presult__isset() : success(false), re(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_startCopyFromDatastoreToRepository_presult__isset;
+
+class Aim_startCopyFromDatastoreToRepository_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "77CCA41D9074A16D3E59690B12F943D0";
+  static const uint8_t binary_fingerprint[16]; // = {0x77,0xCC,0xA4,0x1D,0x90,0x74,0xA1,0x6D,0x3E,0x59,0x69,0x0B,0x12,0xF9,0x43,0xD0};
+
+
+  virtual ~Aim_startCopyFromDatastoreToRepository_presult() throw();
+  std::string* success;
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_startCopyFromDatastoreToRepository_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_startCopyFromDatastoreToRepository_presult& obj);
+};
+
+typedef struct _Aim_startCopy_args__isset {
+  _Aim_startCopy_args__isset() : source(false), destination(false) {}
+  bool source :1;
+  bool destination :1;
+} _Aim_startCopy_args__isset;
+
+class Aim_startCopy_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "07A9615F837F7D0A952B595DD3020972";
+  static const uint8_t binary_fingerprint[16]; // = {0x07,0xA9,0x61,0x5F,0x83,0x7F,0x7D,0x0A,0x95,0x2B,0x59,0x5D,0xD3,0x02,0x09,0x72};
+
+  Aim_startCopy_args(const Aim_startCopy_args&);
+  Aim_startCopy_args& operator=(const Aim_startCopy_args&);
+  Aim_startCopy_args() : source(), destination() {
+  }
+
+  virtual ~Aim_startCopy_args() throw();
+  std::string source;
+  std::string destination;
+
+  _Aim_startCopy_args__isset __isset;
+
+  void __set_source(const std::string& val);
+
+  void __set_destination(const std::string& val);
+
+  bool operator == (const Aim_startCopy_args & rhs) const
+  {
+    if (!(source == rhs.source))
+      return false;
+    if (!(destination == rhs.destination))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_startCopy_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_startCopy_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_startCopy_args& obj);
+};
+
+
+class Aim_startCopy_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "07A9615F837F7D0A952B595DD3020972";
+  static const uint8_t binary_fingerprint[16]; // = {0x07,0xA9,0x61,0x5F,0x83,0x7F,0x7D,0x0A,0x95,0x2B,0x59,0x5D,0xD3,0x02,0x09,0x72};
+
+
+  virtual ~Aim_startCopy_pargs() throw();
+  const std::string* source;
+  const std::string* destination;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_startCopy_pargs& obj);
+};
+
+typedef struct _Aim_startCopy_result__isset {
+  _Aim_startCopy_result__isset() : success(false), re(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_startCopy_result__isset;
+
+class Aim_startCopy_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "77CCA41D9074A16D3E59690B12F943D0";
+  static const uint8_t binary_fingerprint[16]; // = {0x77,0xCC,0xA4,0x1D,0x90,0x74,0xA1,0x6D,0x3E,0x59,0x69,0x0B,0x12,0xF9,0x43,0xD0};
+
+  Aim_startCopy_result(const Aim_startCopy_result&);
+  Aim_startCopy_result& operator=(const Aim_startCopy_result&);
+  Aim_startCopy_result() : success() {
+  }
+
+  virtual ~Aim_startCopy_result() throw();
+  std::string success;
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_startCopy_result__isset __isset;
+
+  void __set_success(const std::string& val);
+
+  void __set_re(const RimpException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_startCopy_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(re == rhs.re))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_startCopy_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_startCopy_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_startCopy_result& obj);
+};
+
+typedef struct _Aim_startCopy_presult__isset {
+  _Aim_startCopy_presult__isset() : success(false), re(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_startCopy_presult__isset;
+
+class Aim_startCopy_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "77CCA41D9074A16D3E59690B12F943D0";
+  static const uint8_t binary_fingerprint[16]; // = {0x77,0xCC,0xA4,0x1D,0x90,0x74,0xA1,0x6D,0x3E,0x59,0x69,0x0B,0x12,0xF9,0x43,0xD0};
+
+
+  virtual ~Aim_startCopy_presult() throw();
+  std::string* success;
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_startCopy_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_startCopy_presult& obj);
+};
+
+typedef struct _Aim_getJobStatus_args__isset {
+  _Aim_getJobStatus_args__isset() : jobId(false) {}
+  bool jobId :1;
+} _Aim_getJobStatus_args__isset;
+
+class Aim_getJobStatus_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "EFB929595D312AC8F305D5A794CFEDA1";
+  static const uint8_t binary_fingerprint[16]; // = {0xEF,0xB9,0x29,0x59,0x5D,0x31,0x2A,0xC8,0xF3,0x05,0xD5,0xA7,0x94,0xCF,0xED,0xA1};
+
+  Aim_getJobStatus_args(const Aim_getJobStatus_args&);
+  Aim_getJobStatus_args& operator=(const Aim_getJobStatus_args&);
+  Aim_getJobStatus_args() : jobId() {
+  }
+
+  virtual ~Aim_getJobStatus_args() throw();
+  std::string jobId;
+
+  _Aim_getJobStatus_args__isset __isset;
+
+  void __set_jobId(const std::string& val);
+
+  bool operator == (const Aim_getJobStatus_args & rhs) const
+  {
+    if (!(jobId == rhs.jobId))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_getJobStatus_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_getJobStatus_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getJobStatus_args& obj);
+};
+
+
+class Aim_getJobStatus_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "EFB929595D312AC8F305D5A794CFEDA1";
+  static const uint8_t binary_fingerprint[16]; // = {0xEF,0xB9,0x29,0x59,0x5D,0x31,0x2A,0xC8,0xF3,0x05,0xD5,0xA7,0x94,0xCF,0xED,0xA1};
+
+
+  virtual ~Aim_getJobStatus_pargs() throw();
+  const std::string* jobId;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getJobStatus_pargs& obj);
+};
+
+typedef struct _Aim_getJobStatus_result__isset {
+  _Aim_getJobStatus_result__isset() : success(false), re(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_getJobStatus_result__isset;
+
+class Aim_getJobStatus_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "44D1A31B0936BD8F2474DAA3C0EF209E";
+  static const uint8_t binary_fingerprint[16]; // = {0x44,0xD1,0xA3,0x1B,0x09,0x36,0xBD,0x8F,0x24,0x74,0xDA,0xA3,0xC0,0xEF,0x20,0x9E};
+
+  Aim_getJobStatus_result(const Aim_getJobStatus_result&);
+  Aim_getJobStatus_result& operator=(const Aim_getJobStatus_result&);
+  Aim_getJobStatus_result() {
+  }
+
+  virtual ~Aim_getJobStatus_result() throw();
+  JobStatus success;
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_getJobStatus_result__isset __isset;
+
+  void __set_success(const JobStatus& val);
+
+  void __set_re(const RimpException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_getJobStatus_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(re == rhs.re))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_getJobStatus_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_getJobStatus_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getJobStatus_result& obj);
+};
+
+typedef struct _Aim_getJobStatus_presult__isset {
+  _Aim_getJobStatus_presult__isset() : success(false), re(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_getJobStatus_presult__isset;
+
+class Aim_getJobStatus_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "44D1A31B0936BD8F2474DAA3C0EF209E";
+  static const uint8_t binary_fingerprint[16]; // = {0x44,0xD1,0xA3,0x1B,0x09,0x36,0xBD,0x8F,0x24,0x74,0xDA,0xA3,0xC0,0xEF,0x20,0x9E};
+
+
+  virtual ~Aim_getJobStatus_presult() throw();
+  JobStatus* success;
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_getJobStatus_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getJobStatus_presult& obj);
+};
+
+typedef struct _Aim_cancelJob_args__isset {
+  _Aim_cancelJob_args__isset() : jobId(false) {}
+  bool jobId :1;
+} _Aim_cancelJob_args__isset;
+
+class Aim_cancelJob_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "EFB929595D312AC8F305D5A794CFEDA1";
+  static const uint8_t binary_fingerprint[16]; // = {0xEF,0xB9,0x29,0x59,0x5D,0x31,0x2A,0xC8,0xF3,0x05,0xD5,0xA7,0x94,0xCF,0xED,0xA1};
+
+  Aim_cancelJob_args(const Aim_cancelJob_args&);
+  Aim_cancelJob_args& operator=(const Aim_cancelJob_args&);
+  Aim_cancelJob_args() : jobId() {
+  }
+
+  virtual ~Aim_cancelJob_args() throw();
+  std::string jobId;
+
+  _Aim_cancelJob_args__isset __isset;
+
+  void __set_jobId(const std::string& val);
+
+  bool operator == (const Aim_cancelJob_args & rhs) const
+  {
+    if (!(jobId == rhs.jobId))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_cancelJob_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_cancelJob_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_cancelJob_args& obj);
+};
+
+
+class Aim_cancelJob_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "EFB929595D312AC8F305D5A794CFEDA1";
+  static const uint8_t binary_fingerprint[16]; // = {0xEF,0xB9,0x29,0x59,0x5D,0x31,0x2A,0xC8,0xF3,0x05,0xD5,0xA7,0x94,0xCF,0xED,0xA1};
+
+
+  virtual ~Aim_cancelJob_pargs() throw();
+  const std::string* jobId;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_cancelJob_pargs& obj);
+};
+
+typedef struct _Aim_cancelJob_result__isset {
+  _Aim_cancelJob_result__isset() : re(false), timeout(false), overload(false) {}
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_cancelJob_result__isset;
+
+class Aim_cancelJob_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
+
+  Aim_cancelJob_result(const Aim_cancelJob_result&);
+  Aim_cancelJob_result& operator=(const Aim_cancelJob_result&);
+  Aim_cancelJob_result() {
+  }
+
+  virtual ~Aim_cancelJob_result() throw();
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_cancelJob_result__isset __isset;
+
+  void __set_re(const RimpException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_cancelJob_result & rhs) const
+  {
+    if (!(re == rhs.re))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_cancelJob_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_cancelJob_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_cancelJob_result& obj);
+};
+
+typedef struct _Aim_cancelJob_presult__isset {
+  _Aim_cancelJob_presult__isset() : re(false), timeout(false), overload(false) {}
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_cancelJob_presult__isset;
+
+class Aim_cancelJob_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
+
+
+  virtual ~Aim_cancelJob_presult() throw();
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_cancelJob_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_cancelJob_presult& obj);
+};
+
+
+class Aim_getServerStats_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "99914B932BD37A50B983C5E7C90AE93B";
+  static const uint8_t binary_fingerprint[16]; // = {0x99,0x91,0x4B,0x93,0x2B,0xD3,0x7A,0x50,0xB9,0x83,0xC5,0xE7,0xC9,0x0A,0xE9,0x3B};
+
+  Aim_getServerStats_args(const Aim_getServerStats_args&);
+  Aim_getServerStats_args& operator=(const Aim_getServerStats_args&);
+  Aim_getServerStats_args() {
+  }
+
+  virtual ~Aim_getServerStats_args() throw();
+
+  bool operator == (const Aim_getServerStats_args & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Aim_getServerStats_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_getServerStats_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getServerStats_args& obj);
+};
+
+
+class Aim_getServerStats_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "99914B932BD37A50B983C5E7C90AE93B";
+  static const uint8_t binary_fingerprint[16]; // = {0x99,0x91,0x4B,0x93,0x2B,0xD3,0x7A,0x50,0xB9,0x83,0xC5,0xE7,0xC9,0x0A,0xE9,0x3B};
+
+
+  virtual ~Aim_getServerStats_pargs() throw();
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getServerStats_pargs& obj);
+};
+
+typedef struct _Aim_getServerStats_result__isset {
+  _Aim_getServerStats_result__isset() : success(false), timeout(false) {}
+  bool success :1;
+  bool timeout :1;
+} _Aim_getServerStats_result__isset;
+
+class Aim_getServerStats_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "A4F2732335D9C7B207F3EC653F8AE5A8";
+  static const uint8_t binary_fingerprint[16]; // = {0xA4,0xF2,0x73,0x23,0x35,0xD9,0xC7,0xB2,0x07,0xF3,0xEC,0x65,0x3F,0x8A,0xE5,0xA8};
+
+  Aim_getServerStats_result(const Aim_getServerStats_result&);
+  Aim_getServerStats_result& operator=(const Aim_getServerStats_result&);
+  Aim_getServerStats_result() {
+  }
+
+  virtual ~Aim_getServerStats_result() throw();
+  ServerStats success;
+  TimeoutException timeout;
+
+  _Aim_getServerStats_result__isset __isset;
+
+  void __set_success(const ServerStats& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  bool operator == (const Aim_getServerStats_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_getServerStats_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_getServerStats_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getServerStats_result& obj);
+};
+
+typedef struct _Aim_getServerStats_presult__isset {
+  _Aim_getServerStats_presult__isset() : success(false), timeout(false) {}
+  bool success :1;
+  bool timeout :1;
+} _Aim_getServerStats_presult__isset;
+
+class Aim_getServerStats_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "A4F2732335D9C7B207F3EC653F8AE5A8";
+  static const uint8_t binary_fingerprint[16]; // = {0xA4,0xF2,0x73,0x23,0x35,0xD9,0xC7,0xB2,0x07,0xF3,0xEC,0x65,0x3F,0x8A,0xE5,0xA8};
+
+
+  virtual ~Aim_getServerStats_presult() throw();
+  ServerStats* success;
+  TimeoutException timeout;
+
+  _Aim_getServerStats_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_getServerStats_presult& obj);
+};
+
+typedef struct _Aim_openUpload_args__isset {
+  _Aim_openUpload_args__isset() : path(false), size(false) {}
+  bool path :1;
+  bool size :1;
+} _Aim_openUpload_args__isset;
+
+class Aim_openUpload_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "1CCCF6FC31CFD1D61BBBB1BAF3590620";
+  static const uint8_t binary_fingerprint[16]; // = {0x1C,0xCC,0xF6,0xFC,0x31,0xCF,0xD1,0xD6,0x1B,0xBB,0xB1,0xBA,0xF3,0x59,0x06,0x20};
+
+  Aim_openUpload_args(const Aim_openUpload_args&);
+  Aim_openUpload_args& operator=(const Aim_openUpload_args&);
+  Aim_openUpload_args() : path(), size(0) {
+  }
+
+  virtual ~Aim_openUpload_args() throw();
+  std::string path;
+  int64_t size;
+
+  _Aim_openUpload_args__isset __isset;
+
+  void __set_path(const std::string& val);
+
+  void __set_size(const int64_t val);
+
+  bool operator == (const Aim_openUpload_args & rhs) const
+  {
+    if (!(path == rhs.path))
+      return false;
+    if (!(size == rhs.size))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_openUpload_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_openUpload_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_openUpload_args& obj);
+};
+
+
+class Aim_openUpload_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "1CCCF6FC31CFD1D61BBBB1BAF3590620";
+  static const uint8_t binary_fingerprint[16]; // = {0x1C,0xCC,0xF6,0xFC,0x31,0xCF,0xD1,0xD6,0x1B,0xBB,0xB1,0xBA,0xF3,0x59,0x06,0x20};
+
+
+  virtual ~Aim_openUpload_pargs() throw();
+  const std::string* path;
+  const int64_t* size;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_openUpload_pargs& obj);
+};
+
+typedef struct _Aim_openUpload_result__isset {
+  _Aim_openUpload_result__isset() : success(false), re(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_openUpload_result__isset;
+
+class Aim_openUpload_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "77CCA41D9074A16D3E59690B12F943D0";
+  static const uint8_t binary_fingerprint[16]; // = {0x77,0xCC,0xA4,0x1D,0x90,0x74,0xA1,0x6D,0x3E,0x59,0x69,0x0B,0x12,0xF9,0x43,0xD0};
+
+  Aim_openUpload_result(const Aim_openUpload_result&);
+  Aim_openUpload_result& operator=(const Aim_openUpload_result&);
+  Aim_openUpload_result() : success() {
+  }
+
+  virtual ~Aim_openUpload_result() throw();
+  std::string success;
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_openUpload_result__isset __isset;
+
+  void __set_success(const std::string& val);
+
+  void __set_re(const RimpException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_openUpload_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(re == rhs.re))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_openUpload_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_openUpload_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_openUpload_result& obj);
+};
+
+typedef struct _Aim_openUpload_presult__isset {
+  _Aim_openUpload_presult__isset() : success(false), re(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_openUpload_presult__isset;
+
+class Aim_openUpload_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "77CCA41D9074A16D3E59690B12F943D0";
+  static const uint8_t binary_fingerprint[16]; // = {0x77,0xCC,0xA4,0x1D,0x90,0x74,0xA1,0x6D,0x3E,0x59,0x69,0x0B,0x12,0xF9,0x43,0xD0};
+
+
+  virtual ~Aim_openUpload_presult() throw();
+  std::string* success;
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_openUpload_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_openUpload_presult& obj);
+};
+
+typedef struct _Aim_writeChunk_args__isset {
+  _Aim_writeChunk_args__isset() : uploadId(false), offset(false), data(false) {}
+  bool uploadId :1;
+  bool offset :1;
+  bool data :1;
+} _Aim_writeChunk_args__isset;
+
+class Aim_writeChunk_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "FA35BEC6F4D26D79A7E0AD1366489BCC";
+  static const uint8_t binary_fingerprint[16]; // = {0xFA,0x35,0xBE,0xC6,0xF4,0xD2,0x6D,0x79,0xA7,0xE0,0xAD,0x13,0x66,0x48,0x9B,0xCC};
+
+  Aim_writeChunk_args(const Aim_writeChunk_args&);
+  Aim_writeChunk_args& operator=(const Aim_writeChunk_args&);
+  Aim_writeChunk_args() : uploadId(), offset(0), data() {
+  }
+
+  virtual ~Aim_writeChunk_args() throw();
+  std::string uploadId;
+  int64_t offset;
+  std::string data;
+
+  _Aim_writeChunk_args__isset __isset;
+
+  void __set_uploadId(const std::string& val);
+
+  void __set_offset(const int64_t val);
+
+  void __set_data(const std::string& val);
+
+  bool operator == (const Aim_writeChunk_args & rhs) const
+  {
+    if (!(uploadId == rhs.uploadId))
+      return false;
+    if (!(offset == rhs.offset))
+      return false;
+    if (!(data == rhs.data))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_writeChunk_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_writeChunk_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_writeChunk_args& obj);
+};
+
+
+class Aim_writeChunk_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "FA35BEC6F4D26D79A7E0AD1366489BCC";
+  static const uint8_t binary_fingerprint[16]; // = {0xFA,0x35,0xBE,0xC6,0xF4,0xD2,0x6D,0x79,0xA7,0xE0,0xAD,0x13,0x66,0x48,0x9B,0xCC};
+
+
+  virtual ~Aim_writeChunk_pargs() throw();
+  const std::string* uploadId;
+  const int64_t* offset;
+  const std::string* data;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_writeChunk_pargs& obj);
+};
+
+typedef struct _Aim_writeChunk_result__isset {
+  _Aim_writeChunk_result__isset() : re(false), timeout(false), overload(false) {}
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_writeChunk_result__isset;
+
+class Aim_writeChunk_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
+
+  Aim_writeChunk_result(const Aim_writeChunk_result&);
+  Aim_writeChunk_result& operator=(const Aim_writeChunk_result&);
+  Aim_writeChunk_result() {
+  }
+
+  virtual ~Aim_writeChunk_result() throw();
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_writeChunk_result__isset __isset;
+
+  void __set_re(const RimpException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_writeChunk_result & rhs) const
+  {
+    if (!(re == rhs.re))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_writeChunk_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_writeChunk_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_writeChunk_result& obj);
+};
+
+typedef struct _Aim_writeChunk_presult__isset {
+  _Aim_writeChunk_presult__isset() : re(false), timeout(false), overload(false) {}
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_writeChunk_presult__isset;
+
+class Aim_writeChunk_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
+
+
+  virtual ~Aim_writeChunk_presult() throw();
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_writeChunk_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_writeChunk_presult& obj);
+};
+
+typedef struct _Aim_commitUpload_args__isset {
+  _Aim_commitUpload_args__isset() : uploadId(false), crc32(false) {}
+  bool uploadId :1;
+  bool crc32 :1;
+} _Aim_commitUpload_args__isset;
+
+class Aim_commitUpload_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "1CCCF6FC31CFD1D61BBBB1BAF3590620";
+  static const uint8_t binary_fingerprint[16]; // = {0x1C,0xCC,0xF6,0xFC,0x31,0xCF,0xD1,0xD6,0x1B,0xBB,0xB1,0xBA,0xF3,0x59,0x06,0x20};
+
+  Aim_commitUpload_args(const Aim_commitUpload_args&);
+  Aim_commitUpload_args& operator=(const Aim_commitUpload_args&);
+  Aim_commitUpload_args() : uploadId(), crc32(0) {
+  }
+
+  virtual ~Aim_commitUpload_args() throw();
+  std::string uploadId;
+  int64_t crc32;
+
+  _Aim_commitUpload_args__isset __isset;
+
+  void __set_uploadId(const std::string& val);
+
+  void __set_crc32(const int64_t val);
+
+  bool operator == (const Aim_commitUpload_args & rhs) const
+  {
+    if (!(uploadId == rhs.uploadId))
+      return false;
+    if (!(crc32 == rhs.crc32))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_commitUpload_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_commitUpload_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_commitUpload_args& obj);
+};
+
+
+class Aim_commitUpload_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "1CCCF6FC31CFD1D61BBBB1BAF3590620";
+  static const uint8_t binary_fingerprint[16]; // = {0x1C,0xCC,0xF6,0xFC,0x31,0xCF,0xD1,0xD6,0x1B,0xBB,0xB1,0xBA,0xF3,0x59,0x06,0x20};
+
+
+  virtual ~Aim_commitUpload_pargs() throw();
+  const std::string* uploadId;
+  const int64_t* crc32;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_commitUpload_pargs& obj);
+};
+
+typedef struct _Aim_commitUpload_result__isset {
+  _Aim_commitUpload_result__isset() : re(false), timeout(false), overload(false) {}
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_commitUpload_result__isset;
+
+class Aim_commitUpload_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
+
+  Aim_commitUpload_result(const Aim_commitUpload_result&);
+  Aim_commitUpload_result& operator=(const Aim_commitUpload_result&);
+  Aim_commitUpload_result() {
+  }
+
+  virtual ~Aim_commitUpload_result() throw();
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_commitUpload_result__isset __isset;
+
+  void __set_re(const RimpException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_commitUpload_result & rhs) const
+  {
+    if (!(re == rhs.re))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_commitUpload_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_commitUpload_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_commitUpload_result& obj);
+};
+
+typedef struct _Aim_commitUpload_presult__isset {
+  _Aim_commitUpload_presult__isset() : re(false), timeout(false), overload(false) {}
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_commitUpload_presult__isset;
+
+class Aim_commitUpload_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
+
+
+  virtual ~Aim_commitUpload_presult() throw();
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_commitUpload_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_commitUpload_presult& obj);
+};
+
+typedef struct _Aim_abortUpload_args__isset {
+  _Aim_abortUpload_args__isset() : uploadId(false) {}
+  bool uploadId :1;
+} _Aim_abortUpload_args__isset;
+
+class Aim_abortUpload_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "EFB929595D312AC8F305D5A794CFEDA1";
+  static const uint8_t binary_fingerprint[16]; // = {0xEF,0xB9,0x29,0x59,0x5D,0x31,0x2A,0xC8,0xF3,0x05,0xD5,0xA7,0x94,0xCF,0xED,0xA1};
+
+  Aim_abortUpload_args(const Aim_abortUpload_args&);
+  Aim_abortUpload_args& operator=(const Aim_abortUpload_args&);
+  Aim_abortUpload_args() : uploadId() {
+  }
+
+  virtual ~Aim_abortUpload_args() throw();
+  std::string uploadId;
+
+  _Aim_abortUpload_args__isset __isset;
+
+  void __set_uploadId(const std::string& val);
+
+  bool operator == (const Aim_abortUpload_args & rhs) const
+  {
+    if (!(uploadId == rhs.uploadId))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_abortUpload_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_abortUpload_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_abortUpload_args& obj);
+};
+
+
+class Aim_abortUpload_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "EFB929595D312AC8F305D5A794CFEDA1";
+  static const uint8_t binary_fingerprint[16]; // = {0xEF,0xB9,0x29,0x59,0x5D,0x31,0x2A,0xC8,0xF3,0x05,0xD5,0xA7,0x94,0xCF,0xED,0xA1};
+
+
+  virtual ~Aim_abortUpload_pargs() throw();
+  const std::string* uploadId;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_abortUpload_pargs& obj);
+};
+
+typedef struct _Aim_abortUpload_result__isset {
+  _Aim_abortUpload_result__isset() : re(false), timeout(false), overload(false) {}
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_abortUpload_result__isset;
+
+class Aim_abortUpload_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
+
+  Aim_abortUpload_result(const Aim_abortUpload_result&);
+  Aim_abortUpload_result& operator=(const Aim_abortUpload_result&);
+  Aim_abortUpload_result() {
+  }
+
+  virtual ~Aim_abortUpload_result() throw();
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_abortUpload_result__isset __isset;
+
+  void __set_re(const RimpException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_abortUpload_result & rhs) const
+  {
+    if (!(re == rhs.re))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_abortUpload_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_abortUpload_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_abortUpload_result& obj);
+};
+
+typedef struct _Aim_abortUpload_presult__isset {
+  _Aim_abortUpload_presult__isset() : re(false), timeout(false), overload(false) {}
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_abortUpload_presult__isset;
+
+class Aim_abortUpload_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "AEEDE46DB362E2A61DCD2E74DD16BE52";
+  static const uint8_t binary_fingerprint[16]; // = {0xAE,0xED,0xE4,0x6D,0xB3,0x62,0xE2,0xA6,0x1D,0xCD,0x2E,0x74,0xDD,0x16,0xBE,0x52};
+
+
+  virtual ~Aim_abortUpload_presult() throw();
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_abortUpload_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_abortUpload_presult& obj);
+};
+
+typedef struct _Aim_powerOnMany_args__isset {
+  _Aim_powerOnMany_args__isset() : domainNames(false), options(false) {}
+  bool domainNames :1;
+  bool options :1;
+} _Aim_powerOnMany_args__isset;
+
+class Aim_powerOnMany_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "FBDE733BBDB625D50F4CBF2EA318377D";
+  static const uint8_t binary_fingerprint[16]; // = {0xFB,0xDE,0x73,0x3B,0xBD,0xB6,0x25,0xD5,0x0F,0x4C,0xBF,0x2E,0xA3,0x18,0x37,0x7D};
+
+  Aim_powerOnMany_args(const Aim_powerOnMany_args&);
+  Aim_powerOnMany_args& operator=(const Aim_powerOnMany_args&);
+  Aim_powerOnMany_args() {
+  }
+
+  virtual ~Aim_powerOnMany_args() throw();
+  std::vector<std::string>  domainNames;
+  BatchOptions options;
+
+  _Aim_powerOnMany_args__isset __isset;
+
+  void __set_domainNames(const std::vector<std::string> & val);
+
+  void __set_options(const BatchOptions& val);
+
+  bool operator == (const Aim_powerOnMany_args & rhs) const
+  {
+    if (!(domainNames == rhs.domainNames))
+      return false;
+    if (!(options == rhs.options))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_powerOnMany_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_powerOnMany_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_powerOnMany_args& obj);
+};
+
+
+class Aim_powerOnMany_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "FBDE733BBDB625D50F4CBF2EA318377D";
+  static const uint8_t binary_fingerprint[16]; // = {0xFB,0xDE,0x73,0x3B,0xBD,0xB6,0x25,0xD5,0x0F,0x4C,0xBF,0x2E,0xA3,0x18,0x37,0x7D};
+
+
+  virtual ~Aim_powerOnMany_pargs() throw();
+  const std::vector<std::string> * domainNames;
+  const BatchOptions* options;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_powerOnMany_pargs& obj);
+};
+
+typedef struct _Aim_powerOnMany_result__isset {
+  _Aim_powerOnMany_result__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_powerOnMany_result__isset;
+
+class Aim_powerOnMany_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+  Aim_powerOnMany_result(const Aim_powerOnMany_result&);
+  Aim_powerOnMany_result& operator=(const Aim_powerOnMany_result&);
+  Aim_powerOnMany_result() {
+  }
+
+  virtual ~Aim_powerOnMany_result() throw();
+  std::vector<DomainResult>  success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_powerOnMany_result__isset __isset;
+
+  void __set_success(const std::vector<DomainResult> & val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_powerOnMany_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_powerOnMany_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_powerOnMany_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_powerOnMany_result& obj);
+};
+
+typedef struct _Aim_powerOnMany_presult__isset {
+  _Aim_powerOnMany_presult__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_powerOnMany_presult__isset;
+
+class Aim_powerOnMany_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+
+  virtual ~Aim_powerOnMany_presult() throw();
+  std::vector<DomainResult> * success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_powerOnMany_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_powerOnMany_presult& obj);
+};
+
+typedef struct _Aim_powerOffMany_args__isset {
+  _Aim_powerOffMany_args__isset() : domainNames(false), options(false) {}
+  bool domainNames :1;
+  bool options :1;
+} _Aim_powerOffMany_args__isset;
+
+class Aim_powerOffMany_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "FBDE733BBDB625D50F4CBF2EA318377D";
+  static const uint8_t binary_fingerprint[16]; // = {0xFB,0xDE,0x73,0x3B,0xBD,0xB6,0x25,0xD5,0x0F,0x4C,0xBF,0x2E,0xA3,0x18,0x37,0x7D};
+
+  Aim_powerOffMany_args(const Aim_powerOffMany_args&);
+  Aim_powerOffMany_args& operator=(const Aim_powerOffMany_args&);
+  Aim_powerOffMany_args() {
+  }
+
+  virtual ~Aim_powerOffMany_args() throw();
+  std::vector<std::string>  domainNames;
+  BatchOptions options;
+
+  _Aim_powerOffMany_args__isset __isset;
+
+  void __set_domainNames(const std::vector<std::string> & val);
+
+  void __set_options(const BatchOptions& val);
+
+  bool operator == (const Aim_powerOffMany_args & rhs) const
+  {
+    if (!(domainNames == rhs.domainNames))
+      return false;
+    if (!(options == rhs.options))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_powerOffMany_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_powerOffMany_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_powerOffMany_args& obj);
+};
+
+
+class Aim_powerOffMany_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "FBDE733BBDB625D50F4CBF2EA318377D";
+  static const uint8_t binary_fingerprint[16]; // = {0xFB,0xDE,0x73,0x3B,0xBD,0xB6,0x25,0xD5,0x0F,0x4C,0xBF,0x2E,0xA3,0x18,0x37,0x7D};
+
+
+  virtual ~Aim_powerOffMany_pargs() throw();
+  const std::vector<std::string> * domainNames;
+  const BatchOptions* options;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_powerOffMany_pargs& obj);
+};
+
+typedef struct _Aim_powerOffMany_result__isset {
+  _Aim_powerOffMany_result__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_powerOffMany_result__isset;
+
+class Aim_powerOffMany_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+  Aim_powerOffMany_result(const Aim_powerOffMany_result&);
+  Aim_powerOffMany_result& operator=(const Aim_powerOffMany_result&);
+  Aim_powerOffMany_result() {
+  }
+
+  virtual ~Aim_powerOffMany_result() throw();
+  std::vector<DomainResult>  success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_powerOffMany_result__isset __isset;
+
+  void __set_success(const std::vector<DomainResult> & val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_powerOffMany_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_powerOffMany_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_powerOffMany_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_powerOffMany_result& obj);
+};
+
+typedef struct _Aim_powerOffMany_presult__isset {
+  _Aim_powerOffMany_presult__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_powerOffMany_presult__isset;
+
+class Aim_powerOffMany_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+
+  virtual ~Aim_powerOffMany_presult() throw();
+  std::vector<DomainResult> * success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_powerOffMany_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_powerOffMany_presult& obj);
+};
+
+typedef struct _Aim_shutdownMany_args__isset {
+  _Aim_shutdownMany_args__isset() : domainNames(false), options(false) {}
+  bool domainNames :1;
+  bool options :1;
+} _Aim_shutdownMany_args__isset;
+
+class Aim_shutdownMany_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "FBDE733BBDB625D50F4CBF2EA318377D";
+  static const uint8_t binary_fingerprint[16]; // = {0xFB,0xDE,0x73,0x3B,0xBD,0xB6,0x25,0xD5,0x0F,0x4C,0xBF,0x2E,0xA3,0x18,0x37,0x7D};
+
+  Aim_shutdownMany_args(const Aim_shutdownMany_args&);
+  Aim_shutdownMany_args& operator=(const Aim_shutdownMany_args&);
+  Aim_shutdownMany_args() {
+  }
+
+  virtual ~Aim_shutdownMany_args() throw();
+  std::vector<std::string>  domainNames;
+  BatchOptions options;
+
+  _Aim_shutdownMany_args__isset __isset;
+
+  void __set_domainNames(const std::vector<std::string> & val);
+
+  void __set_options(const BatchOptions& val);
+
+  bool operator == (const Aim_shutdownMany_args & rhs) const
+  {
+    if (!(domainNames == rhs.domainNames))
+      return false;
+    if (!(options == rhs.options))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_shutdownMany_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_shutdownMany_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_shutdownMany_args& obj);
+};
+
+
+class Aim_shutdownMany_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "FBDE733BBDB625D50F4CBF2EA318377D";
+  static const uint8_t binary_fingerprint[16]; // = {0xFB,0xDE,0x73,0x3B,0xBD,0xB6,0x25,0xD5,0x0F,0x4C,0xBF,0x2E,0xA3,0x18,0x37,0x7D};
+
+
+  virtual ~Aim_shutdownMany_pargs() throw();
+  const std::vector<std::string> * domainNames;
+  const BatchOptions* options;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_shutdownMany_pargs& obj);
+};
+
+typedef struct _Aim_shutdownMany_result__isset {
+  _Aim_shutdownMany_result__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_shutdownMany_result__isset;
+
+class Aim_shutdownMany_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+  Aim_shutdownMany_result(const Aim_shutdownMany_result&);
+  Aim_shutdownMany_result& operator=(const Aim_shutdownMany_result&);
+  Aim_shutdownMany_result() {
+  }
+
+  virtual ~Aim_shutdownMany_result() throw();
+  std::vector<DomainResult>  success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_shutdownMany_result__isset __isset;
+
+  void __set_success(const std::vector<DomainResult> & val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_shutdownMany_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_shutdownMany_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_shutdownMany_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_shutdownMany_result& obj);
+};
+
+typedef struct _Aim_shutdownMany_presult__isset {
+  _Aim_shutdownMany_presult__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_shutdownMany_presult__isset;
+
+class Aim_shutdownMany_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+
+  virtual ~Aim_shutdownMany_presult() throw();
+  std::vector<DomainResult> * success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_shutdownMany_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_shutdownMany_presult& obj);
+};
+
+typedef struct _Aim_resetMany_args__isset {
+  _Aim_resetMany_args__isset() : domainNames(false), options(false) {}
+  bool domainNames :1;
+  bool options :1;
+} _Aim_resetMany_args__isset;
+
+class Aim_resetMany_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "FBDE733BBDB625D50F4CBF2EA318377D";
+  static const uint8_t binary_fingerprint[16]; // = {0xFB,0xDE,0x73,0x3B,0xBD,0xB6,0x25,0xD5,0x0F,0x4C,0xBF,0x2E,0xA3,0x18,0x37,0x7D};
+
+  Aim_resetMany_args(const Aim_resetMany_args&);
+  Aim_resetMany_args& operator=(const Aim_resetMany_args&);
+  Aim_resetMany_args() {
+  }
+
+  virtual ~Aim_resetMany_args() throw();
+  std::vector<std::string>  domainNames;
+  BatchOptions options;
+
+  _Aim_resetMany_args__isset __isset;
+
+  void __set_domainNames(const std::vector<std::string> & val);
+
+  void __set_options(const BatchOptions& val);
+
+  bool operator == (const Aim_resetMany_args & rhs) const
+  {
+    if (!(domainNames == rhs.domainNames))
+      return false;
+    if (!(options == rhs.options))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_resetMany_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_resetMany_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_resetMany_args& obj);
+};
+
+
+class Aim_resetMany_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "FBDE733BBDB625D50F4CBF2EA318377D";
+  static const uint8_t binary_fingerprint[16]; // = {0xFB,0xDE,0x73,0x3B,0xBD,0xB6,0x25,0xD5,0x0F,0x4C,0xBF,0x2E,0xA3,0x18,0x37,0x7D};
+
+
+  virtual ~Aim_resetMany_pargs() throw();
+  const std::vector<std::string> * domainNames;
+  const BatchOptions* options;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_resetMany_pargs& obj);
+};
+
+typedef struct _Aim_resetMany_result__isset {
+  _Aim_resetMany_result__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_resetMany_result__isset;
+
+class Aim_resetMany_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+  Aim_resetMany_result(const Aim_resetMany_result&);
+  Aim_resetMany_result& operator=(const Aim_resetMany_result&);
+  Aim_resetMany_result() {
+  }
+
+  virtual ~Aim_resetMany_result() throw();
+  std::vector<DomainResult>  success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_resetMany_result__isset __isset;
+
+  void __set_success(const std::vector<DomainResult> & val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_resetMany_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_resetMany_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_resetMany_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_resetMany_result& obj);
+};
+
+typedef struct _Aim_resetMany_presult__isset {
+  _Aim_resetMany_presult__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_resetMany_presult__isset;
+
+class Aim_resetMany_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+
+  virtual ~Aim_resetMany_presult() throw();
+  std::vector<DomainResult> * success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_resetMany_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_resetMany_presult& obj);
+};
+
+typedef struct _Aim_pauseMany_args__isset {
+  _Aim_pauseMany_args__isset() : domainNames(false), options(false) {}
+  bool domainNames :1;
+  bool options :1;
+} _Aim_pauseMany_args__isset;
+
+class Aim_pauseMany_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "FBDE733BBDB625D50F4CBF2EA318377D";
+  static const uint8_t binary_fingerprint[16]; // = {0xFB,0xDE,0x73,0x3B,0xBD,0xB6,0x25,0xD5,0x0F,0x4C,0xBF,0x2E,0xA3,0x18,0x37,0x7D};
+
+  Aim_pauseMany_args(const Aim_pauseMany_args&);
+  Aim_pauseMany_args& operator=(const Aim_pauseMany_args&);
+  Aim_pauseMany_args() {
+  }
+
+  virtual ~Aim_pauseMany_args() throw();
+  std::vector<std::string>  domainNames;
+  BatchOptions options;
+
+  _Aim_pauseMany_args__isset __isset;
+
+  void __set_domainNames(const std::vector<std::string> & val);
+
+  void __set_options(const BatchOptions& val);
+
+  bool operator == (const Aim_pauseMany_args & rhs) const
+  {
+    if (!(domainNames == rhs.domainNames))
+      return false;
+    if (!(options == rhs.options))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_pauseMany_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_pauseMany_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_pauseMany_args& obj);
+};
+
+
+class Aim_pauseMany_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "FBDE733BBDB625D50F4CBF2EA318377D";
+  static const uint8_t binary_fingerprint[16]; // = {0xFB,0xDE,0x73,0x3B,0xBD,0xB6,0x25,0xD5,0x0F,0x4C,0xBF,0x2E,0xA3,0x18,0x37,0x7D};
+
+
+  virtual ~Aim_pauseMany_pargs() throw();
+  const std::vector<std::string> * domainNames;
+  const BatchOptions* options;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_pauseMany_pargs& obj);
+};
+
+typedef struct _Aim_pauseMany_result__isset {
+  _Aim_pauseMany_result__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_pauseMany_result__isset;
+
+class Aim_pauseMany_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+  Aim_pauseMany_result(const Aim_pauseMany_result&);
+  Aim_pauseMany_result& operator=(const Aim_pauseMany_result&);
+  Aim_pauseMany_result() {
+  }
+
+  virtual ~Aim_pauseMany_result() throw();
+  std::vector<DomainResult>  success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_pauseMany_result__isset __isset;
+
+  void __set_success(const std::vector<DomainResult> & val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_pauseMany_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_pauseMany_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_pauseMany_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_pauseMany_result& obj);
+};
+
+typedef struct _Aim_pauseMany_presult__isset {
+  _Aim_pauseMany_presult__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_pauseMany_presult__isset;
+
+class Aim_pauseMany_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+
+  virtual ~Aim_pauseMany_presult() throw();
+  std::vector<DomainResult> * success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_pauseMany_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_pauseMany_presult& obj);
+};
+
+typedef struct _Aim_resumeMany_args__isset {
+  _Aim_resumeMany_args__isset() : domainNames(false), options(false) {}
+  bool domainNames :1;
+  bool options :1;
+} _Aim_resumeMany_args__isset;
+
+class Aim_resumeMany_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "FBDE733BBDB625D50F4CBF2EA318377D";
+  static const uint8_t binary_fingerprint[16]; // = {0xFB,0xDE,0x73,0x3B,0xBD,0xB6,0x25,0xD5,0x0F,0x4C,0xBF,0x2E,0xA3,0x18,0x37,0x7D};
+
+  Aim_resumeMany_args(const Aim_resumeMany_args&);
+  Aim_resumeMany_args& operator=(const Aim_resumeMany_args&);
+  Aim_resumeMany_args() {
+  }
+
+  virtual ~Aim_resumeMany_args() throw();
+  std::vector<std::string>  domainNames;
+  BatchOptions options;
+
+  _Aim_resumeMany_args__isset __isset;
+
+  void __set_domainNames(const std::vector<std::string> & val);
+
+  void __set_options(const BatchOptions& val);
+
+  bool operator == (const Aim_resumeMany_args & rhs) const
+  {
+    if (!(domainNames == rhs.domainNames))
+      return false;
+    if (!(options == rhs.options))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_resumeMany_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_resumeMany_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_resumeMany_args& obj);
+};
+
+
+class Aim_resumeMany_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "FBDE733BBDB625D50F4CBF2EA318377D";
+  static const uint8_t binary_fingerprint[16]; // = {0xFB,0xDE,0x73,0x3B,0xBD,0xB6,0x25,0xD5,0x0F,0x4C,0xBF,0x2E,0xA3,0x18,0x37,0x7D};
+
+
+  virtual ~Aim_resumeMany_pargs() throw();
+  const std::vector<std::string> * domainNames;
+  const BatchOptions* options;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_resumeMany_pargs& obj);
+};
+
+typedef struct _Aim_resumeMany_result__isset {
+  _Aim_resumeMany_result__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_resumeMany_result__isset;
+
+class Aim_resumeMany_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+  Aim_resumeMany_result(const Aim_resumeMany_result&);
+  Aim_resumeMany_result& operator=(const Aim_resumeMany_result&);
+  Aim_resumeMany_result() {
+  }
+
+  virtual ~Aim_resumeMany_result() throw();
+  std::vector<DomainResult>  success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_resumeMany_result__isset __isset;
+
+  void __set_success(const std::vector<DomainResult> & val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_resumeMany_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_resumeMany_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_resumeMany_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_resumeMany_result& obj);
+};
+
+typedef struct _Aim_resumeMany_presult__isset {
+  _Aim_resumeMany_presult__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_resumeMany_presult__isset;
+
+class Aim_resumeMany_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+
+  virtual ~Aim_resumeMany_presult() throw();
+  std::vector<DomainResult> * success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_resumeMany_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_resumeMany_presult& obj);
+};
+
+typedef struct _Aim_shutdownWithDeadline_args__isset {
+  _Aim_shutdownWithDeadline_args__isset() : domainName(false), timeoutSec(false) {}
+  bool domainName :1;
+  bool timeoutSec :1;
+} _Aim_shutdownWithDeadline_args__isset;
+
+class Aim_shutdownWithDeadline_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "EEBC915CE44901401D881E6091423036";
+  static const uint8_t binary_fingerprint[16]; // = {0xEE,0xBC,0x91,0x5C,0xE4,0x49,0x01,0x40,0x1D,0x88,0x1E,0x60,0x91,0x42,0x30,0x36};
+
+  Aim_shutdownWithDeadline_args(const Aim_shutdownWithDeadline_args&);
+  Aim_shutdownWithDeadline_args& operator=(const Aim_shutdownWithDeadline_args&);
+  Aim_shutdownWithDeadline_args() : domainName(), timeoutSec(0) {
+  }
+
+  virtual ~Aim_shutdownWithDeadline_args() throw();
+  std::string domainName;
+  int32_t timeoutSec;
+
+  _Aim_shutdownWithDeadline_args__isset __isset;
+
+  void __set_domainName(const std::string& val);
+
+  void __set_timeoutSec(const int32_t val);
+
+  bool operator == (const Aim_shutdownWithDeadline_args & rhs) const
+  {
+    if (!(domainName == rhs.domainName))
+      return false;
+    if (!(timeoutSec == rhs.timeoutSec))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_shutdownWithDeadline_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_shutdownWithDeadline_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_shutdownWithDeadline_args& obj);
+};
+
+
+class Aim_shutdownWithDeadline_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "EEBC915CE44901401D881E6091423036";
+  static const uint8_t binary_fingerprint[16]; // = {0xEE,0xBC,0x91,0x5C,0xE4,0x49,0x01,0x40,0x1D,0x88,0x1E,0x60,0x91,0x42,0x30,0x36};
+
+
+  virtual ~Aim_shutdownWithDeadline_pargs() throw();
+  const std::string* domainName;
+  const int32_t* timeoutSec;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_shutdownWithDeadline_pargs& obj);
+};
+
+typedef struct _Aim_shutdownWithDeadline_result__isset {
+  _Aim_shutdownWithDeadline_result__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_shutdownWithDeadline_result__isset;
+
+class Aim_shutdownWithDeadline_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "9ED6FD40762409CAB1013E6AF897DD15";
+  static const uint8_t binary_fingerprint[16]; // = {0x9E,0xD6,0xFD,0x40,0x76,0x24,0x09,0xCA,0xB1,0x01,0x3E,0x6A,0xF8,0x97,0xDD,0x15};
+
+  Aim_shutdownWithDeadline_result(const Aim_shutdownWithDeadline_result&);
+  Aim_shutdownWithDeadline_result& operator=(const Aim_shutdownWithDeadline_result&);
+  Aim_shutdownWithDeadline_result() {
+  }
+
+  virtual ~Aim_shutdownWithDeadline_result() throw();
+  DomainResult success;
+  LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_shutdownWithDeadline_result__isset __isset;
+
+  void __set_success(const DomainResult& val);
+
+  void __set_libvirtException(const LibvirtException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_shutdownWithDeadline_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(libvirtException == rhs.libvirtException))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_shutdownWithDeadline_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_shutdownWithDeadline_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_shutdownWithDeadline_result& obj);
+};
+
+typedef struct _Aim_shutdownWithDeadline_presult__isset {
+  _Aim_shutdownWithDeadline_presult__isset() : success(false), libvirtException(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool libvirtException :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_shutdownWithDeadline_presult__isset;
+
+class Aim_shutdownWithDeadline_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "9ED6FD40762409CAB1013E6AF897DD15";
+  static const uint8_t binary_fingerprint[16]; // = {0x9E,0xD6,0xFD,0x40,0x76,0x24,0x09,0xCA,0xB1,0x01,0x3E,0x6A,0xF8,0x97,0xDD,0x15};
+
+
+  virtual ~Aim_shutdownWithDeadline_presult() throw();
+  DomainResult* success;
+  LibvirtException libvirtException;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_shutdownWithDeadline_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_shutdownWithDeadline_presult& obj);
+};
+
+typedef struct _Aim_shutdownManyWithDeadline_args__isset {
+  _Aim_shutdownManyWithDeadline_args__isset() : domainNames(false), timeoutSec(false), options(false) {}
+  bool domainNames :1;
+  bool timeoutSec :1;
+  bool options :1;
+} _Aim_shutdownManyWithDeadline_args__isset;
+
+class Aim_shutdownManyWithDeadline_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "2282BB3682ABA82796A58A7F0449DF2E";
+  static const uint8_t binary_fingerprint[16]; // = {0x22,0x82,0xBB,0x36,0x82,0xAB,0xA8,0x27,0x96,0xA5,0x8A,0x7F,0x04,0x49,0xDF,0x2E};
+
+  Aim_shutdownManyWithDeadline_args(const Aim_shutdownManyWithDeadline_args&);
+  Aim_shutdownManyWithDeadline_args& operator=(const Aim_shutdownManyWithDeadline_args&);
+  Aim_shutdownManyWithDeadline_args() : timeoutSec(0) {
+  }
+
+  virtual ~Aim_shutdownManyWithDeadline_args() throw();
+  std::vector<std::string>  domainNames;
+  int32_t timeoutSec;
+  BatchOptions options;
+
+  _Aim_shutdownManyWithDeadline_args__isset __isset;
+
+  void __set_domainNames(const std::vector<std::string> & val);
+
+  void __set_timeoutSec(const int32_t val);
+
+  void __set_options(const BatchOptions& val);
+
+  bool operator == (const Aim_shutdownManyWithDeadline_args & rhs) const
+  {
+    if (!(domainNames == rhs.domainNames))
+      return false;
+    if (!(timeoutSec == rhs.timeoutSec))
+      return false;
+    if (!(options == rhs.options))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_shutdownManyWithDeadline_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_shutdownManyWithDeadline_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_shutdownManyWithDeadline_args& obj);
+};
+
+
+class Aim_shutdownManyWithDeadline_pargs {
+ public:
+
+  static const char* ascii_fingerprint; // = "2282BB3682ABA82796A58A7F0449DF2E";
+  static const uint8_t binary_fingerprint[16]; // = {0x22,0x82,0xBB,0x36,0x82,0xAB,0xA8,0x27,0x96,0xA5,0x8A,0x7F,0x04,0x49,0xDF,0x2E};
+
+
+  virtual ~Aim_shutdownManyWithDeadline_pargs() throw();
+  const std::vector<std::string> * domainNames;
+  const int32_t* timeoutSec;
+  const BatchOptions* options;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_shutdownManyWithDeadline_pargs& obj);
+};
+
+typedef struct _Aim_shutdownManyWithDeadline_result__isset {
+  _Aim_shutdownManyWithDeadline_result__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_shutdownManyWithDeadline_result__isset;
+
+class Aim_shutdownManyWithDeadline_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+  Aim_shutdownManyWithDeadline_result(const Aim_shutdownManyWithDeadline_result&);
+  Aim_shutdownManyWithDeadline_result& operator=(const Aim_shutdownManyWithDeadline_result&);
+  Aim_shutdownManyWithDeadline_result() {
+  }
+
+  virtual ~Aim_shutdownManyWithDeadline_result() throw();
+  std::vector<DomainResult>  success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_shutdownManyWithDeadline_result__isset __isset;
+
+  void __set_success(const std::vector<DomainResult> & val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_shutdownManyWithDeadline_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_shutdownManyWithDeadline_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_shutdownManyWithDeadline_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_shutdownManyWithDeadline_result& obj);
+};
+
+typedef struct _Aim_shutdownManyWithDeadline_presult__isset {
+  _Aim_shutdownManyWithDeadline_presult__isset() : success(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_shutdownManyWithDeadline_presult__isset;
+
+class Aim_shutdownManyWithDeadline_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "7D3CC78A93923CAE336C72F258C3FEC3";
+  static const uint8_t binary_fingerprint[16]; // = {0x7D,0x3C,0xC7,0x8A,0x93,0x92,0x3C,0xAE,0x33,0x6C,0x72,0xF2,0x58,0xC3,0xFE,0xC3};
+
+
+  virtual ~Aim_shutdownManyWithDeadline_presult() throw();
+  std::vector<DomainResult> * success;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_shutdownManyWithDeadline_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_shutdownManyWithDeadline_presult& obj);
+};
+
+typedef struct _Aim_readChunk_args__isset {
+  _Aim_readChunk_args__isset() : path(false), offset(false), length(false), compress(false) {}
+  bool path :1;
+  bool offset :1;
+  bool length :1;
+  bool compress :1;
+} _Aim_readChunk_args__isset;
+
+class Aim_readChunk_args {
+ public:
+
+  static const char* ascii_fingerprint; // = "519916A9E61C6D79D434D7DFE31C2F86";
+  static const uint8_t binary_fingerprint[16]; // = {0x51,0x99,0x16,0xA9,0xE6,0x1C,0x6D,0x79,0xD4,0x34,0xD7,0xDF,0xE3,0x1C,0x2F,0x86};
+
+  Aim_readChunk_args(const Aim_readChunk_args&);
+  Aim_readChunk_args& operator=(const Aim_readChunk_args&);
+  Aim_readChunk_args() : path(), offset(0), length(0), compress(0) {
+  }
+
+  virtual ~Aim_readChunk_args() throw();
+  std::string path;
+  int64_t offset;
+  int32_t length;
+  bool compress;
+
+  _Aim_readChunk_args__isset __isset;
+
+  void __set_path(const std::string& val);
+
+  void __set_offset(const int64_t val);
+
+  void __set_length(const int32_t val);
+
+  void __set_compress(const bool val);
+
+  bool operator == (const Aim_readChunk_args & rhs) const
+  {
+    if (!(path == rhs.path))
+      return false;
+    if (!(offset == rhs.offset))
+      return false;
+    if (!(length == rhs.length))
+      return false;
+    if (!(compress == rhs.compress))
+      return false;
     return true;
   }
-  bool operator != (const Aim_upload_result &rhs) const {
+  bool operator != (const Aim_readChunk_args &rhs) const {
     return !(*this == rhs);
   }
 
-  bool operator < (const Aim_upload_result & ) const;
+  bool operator < (const Aim_readChunk_args & ) const;
 
   uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
   uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
 
-  friend std::ostream& operator<<(std::ostream& out, const Aim_upload_result& obj);
+  friend std::ostream& operator<<(std::ostream& out, const Aim_readChunk_args& obj);
 };
 
 
-class Aim_upload_presult {
+class Aim_readChunk_pargs {
  public:
 
-  static const char* ascii_fingerprint; // = "99914B932BD37A50B983C5E7C90AE93B";
-  static const uint8_t binary_fingerprint[16]; // = {0x99,0x91,0x4B,0x93,0x2B,0xD3,0x7A,0x50,0xB9,0x83,0xC5,0xE7,0xC9,0x0A,0xE9,0x3B};
+  static const char* ascii_fingerprint; // = "519916A9E61C6D79D434D7DFE31C2F86";
+  static const uint8_t binary_fingerprint[16]; // = {0x51,0x99,0x16,0xA9,0xE6,0x1C,0x6D,0x79,0xD4,0x34,0xD7,0xDF,0xE3,0x1C,0x2F,0x86};
 
 
-  virtual ~Aim_upload_presult() throw();
+  virtual ~Aim_readChunk_pargs() throw();
+  const std::string* path;
+  const int64_t* offset;
+  const int32_t* length;
+  const bool* compress;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_readChunk_pargs& obj);
+};
+
+typedef struct _Aim_readChunk_result__isset {
+  _Aim_readChunk_result__isset() : success(false), re(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_readChunk_result__isset;
+
+class Aim_readChunk_result {
+ public:
+
+  static const char* ascii_fingerprint; // = "EADCFD90493CD21208B01F9943878657";
+  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xDC,0xFD,0x90,0x49,0x3C,0xD2,0x12,0x08,0xB0,0x1F,0x99,0x43,0x87,0x86,0x57};
+
+  Aim_readChunk_result(const Aim_readChunk_result&);
+  Aim_readChunk_result& operator=(const Aim_readChunk_result&);
+  Aim_readChunk_result() {
+  }
+
+  virtual ~Aim_readChunk_result() throw();
+  FileChunk success;
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_readChunk_result__isset __isset;
+
+  void __set_success(const FileChunk& val);
+
+  void __set_re(const RimpException& val);
+
+  void __set_timeout(const TimeoutException& val);
+
+  void __set_overload(const OverloadException& val);
+
+  bool operator == (const Aim_readChunk_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(re == rhs.re))
+      return false;
+    if (!(timeout == rhs.timeout))
+      return false;
+    if (!(overload == rhs.overload))
+      return false;
+    return true;
+  }
+  bool operator != (const Aim_readChunk_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Aim_readChunk_result & ) const;
 
   uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
 
-  friend std::ostream& operator<<(std::ostream& out, const Aim_upload_presult& obj);
+  friend std::ostream& operator<<(std::ostream& out, const Aim_readChunk_result& obj);
+};
+
+typedef struct _Aim_readChunk_presult__isset {
+  _Aim_readChunk_presult__isset() : success(false), re(false), timeout(false), overload(false) {}
+  bool success :1;
+  bool re :1;
+  bool timeout :1;
+  bool overload :1;
+} _Aim_readChunk_presult__isset;
+
+class Aim_readChunk_presult {
+ public:
+
+  static const char* ascii_fingerprint; // = "EADCFD90493CD21208B01F9943878657";
+  static const uint8_t binary_fingerprint[16]; // = {0xEA,0xDC,0xFD,0x90,0x49,0x3C,0xD2,0x12,0x08,0xB0,0x1F,0x99,0x43,0x87,0x86,0x57};
+
+
+  virtual ~Aim_readChunk_presult() throw();
+  FileChunk* success;
+  RimpException re;
+  TimeoutException timeout;
+  OverloadException overload;
+
+  _Aim_readChunk_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+  friend std::ostream& operator<<(std::ostream& out, const Aim_readChunk_presult& obj);
 };
 
 class AimClient : virtual public AimIf {
@@ -4980,6 +9140,75 @@ class AimClient : virtual public AimIf {
   void upload(const BinaryFile& file, const std::string& path);
   void send_upload(const BinaryFile& file, const std::string& path);
   void recv_upload();
+  void getDomainsLite(std::vector<DomainInfo> & _return);
+  void send_getDomainsLite();
+  void recv_getDomainsLite(std::vector<DomainInfo> & _return);
+  void getDomainsWithFields(std::vector<DomainInfo> & _return, const DomainFields::type fields);
+  void send_getDomainsWithFields(const DomainFields::type fields);
+  void recv_getDomainsWithFields(std::vector<DomainInfo> & _return);
+  void getDomainsChangedSince(DomainChanges& _return, const int64_t generation, const DomainFields::type fields);
+  void send_getDomainsChangedSince(const int64_t generation, const DomainFields::type fields);
+  void recv_getDomainsChangedSince(DomainChanges& _return);
+  void waitForEvents(DomainEvents& _return, const int64_t sinceId, const int32_t timeoutMs);
+  void send_waitForEvents(const int64_t sinceId, const int32_t timeoutMs);
+  void recv_waitForEvents(DomainEvents& _return);
+  void startCopyFromRepositoryToDatastore(std::string& _return, const std::string& virtualImageRepositoryPath, const std::string& datastorePath, const std::string& virtualMachineUUID);
+  void send_startCopyFromRepositoryToDatastore(const std::string& virtualImageRepositoryPath, const std::string& datastorePath, const std::string& virtualMachineUUID);
+  void recv_startCopyFromRepositoryToDatastore(std::string& _return);
+  void startCopyFromDatastoreToRepository(std::string& _return, const std::string& virtualMachineUUID, const std::string& snapshot, const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath);
+  void send_startCopyFromDatastoreToRepository(const std::string& virtualMachineUUID, const std::string& snapshot, const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath);
+  void recv_startCopyFromDatastoreToRepository(std::string& _return);
+  void startCopy(std::string& _return, const std::string& source, const std::string& destination);
+  void send_startCopy(const std::string& source, const std::string& destination);
+  void recv_startCopy(std::string& _return);
+  void getJobStatus(JobStatus& _return, const std::string& jobId);
+  void send_getJobStatus(const std::string& jobId);
+  void recv_getJobStatus(JobStatus& _return);
+  void cancelJob(const std::string& jobId);
+  void send_cancelJob(const std::string& jobId);
+  void recv_cancelJob();
+  void getServerStats(ServerStats& _return);
+  void send_getServerStats();
+  void recv_getServerStats(ServerStats& _return);
+  void openUpload(std::string& _return, const std::string& path, const int64_t size);
+  void send_openUpload(const std::string& path, const int64_t size);
+  void recv_openUpload(std::string& _return);
+  void writeChunk(const std::string& uploadId, const int64_t offset, const std::string& data);
+  void send_writeChunk(const std::string& uploadId, const int64_t offset, const std::string& data);
+  void recv_writeChunk();
+  void commitUpload(const std::string& uploadId, const int64_t crc32);
+  void send_commitUpload(const std::string& uploadId, const int64_t crc32);
+  void recv_commitUpload();
+  void abortUpload(const std::string& uploadId);
+  void send_abortUpload(const std::string& uploadId);
+  void recv_abortUpload();
+  void powerOnMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options);
+  void send_powerOnMany(const std::vector<std::string> & domainNames, const BatchOptions& options);
+  void recv_powerOnMany(std::vector<DomainResult> & _return);
+  void powerOffMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options);
+  void send_powerOffMany(const std::vector<std::string> & domainNames, const BatchOptions& options);
+  void recv_powerOffMany(std::vector<DomainResult> & _return);
+  void shutdownMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options);
+  void send_shutdownMany(const std::vector<std::string> & domainNames, const BatchOptions& options);
+  void recv_shutdownMany(std::vector<DomainResult> & _return);
+  void resetMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options);
+  void send_resetMany(const std::vector<std::string> & domainNames, const BatchOptions& options);
+  void recv_resetMany(std::vector<DomainResult> & _return);
+  void pauseMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options);
+  void send_pauseMany(const std::vector<std::string> & domainNames, const BatchOptions& options);
+  void recv_pauseMany(std::vector<DomainResult> & _return);
+  void resumeMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options);
+  void send_resumeMany(const std::vector<std::string> & domainNames, const BatchOptions& options);
+  void recv_resumeMany(std::vector<DomainResult> & _return);
+  void shutdownWithDeadline(DomainResult& _return, const std::string& domainName, const int32_t timeoutSec);
+  void send_shutdownWithDeadline(const std::string& domainName, const int32_t timeoutSec);
+  void recv_shutdownWithDeadline(DomainResult& _return);
+  void shutdownManyWithDeadline(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const int32_t timeoutSec, const BatchOptions& options);
+  void send_shutdownManyWithDeadline(const std::vector<std::string> & domainNames, const int32_t timeoutSec, const BatchOptions& options);
+  void recv_shutdownManyWithDeadline(std::vector<DomainResult> & _return);
+  void readChunk(FileChunk& _return, const std::string& path, const int64_t offset, const int32_t length, const bool compress);
+  void send_readChunk(const std::string& path, const int64_t offset, const int32_t length, const bool compress);
+  void recv_readChunk(FileChunk& _return);
  protected:
   boost::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   boost::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -5032,6 +9261,29 @@ class AimProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_getDomainBlockInfo(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_getDatapoints(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_upload(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_getDomainsLite(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_getDomainsWithFields(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_getDomainsChangedSince(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_waitForEvents(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_startCopyFromRepositoryToDatastore(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_startCopyFromDatastoreToRepository(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_startCopy(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_getJobStatus(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_cancelJob(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_getServerStats(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_openUpload(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_writeChunk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_commitUpload(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_abortUpload(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_powerOnMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_powerOffMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_shutdownMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_resetMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_pauseMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_resumeMany(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_shutdownWithDeadline(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_shutdownManyWithDeadline(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_readChunk(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   AimProcessor(boost::shared_ptr<AimIf> iface) :
     iface_(iface) {
@@ -5072,6 +9324,29 @@ class AimProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["getDomainBlockInfo"] = &AimProcessor::process_getDomainBlockInfo;
     processMap_["getDatapoints"] = &AimProcessor::process_getDatapoints;
     processMap_["upload"] = &AimProcessor::process_upload;
+    processMap_["getDomainsLite"] = &AimProcessor::process_getDomainsLite;
+    processMap_["getDomainsWithFields"] = &AimProcessor::process_getDomainsWithFields;
+    processMap_["getDomainsChangedSince"] = &AimProcessor::process_getDomainsChangedSince;
+    processMap_["waitForEvents"] = &AimProcessor::process_waitForEvents;
+    processMap_["startCopyFromRepositoryToDatastore"] = &AimProcessor::process_startCopyFromRepositoryToDatastore;
+    processMap_["startCopyFromDatastoreToRepository"] = &AimProcessor::process_startCopyFromDatastoreToRepository;
+    processMap_["startCopy"] = &AimProcessor::process_startCopy;
+    processMap_["getJobStatus"] = &AimProcessor::process_getJobStatus;
+    processMap_["cancelJob"] = &AimProcessor::process_cancelJob;
+    processMap_["getServerStats"] = &AimProcessor::process_getServerStats;
+    processMap_["openUpload"] = &AimProcessor::process_openUpload;
+    processMap_["writeChunk"] = &AimProcessor::process_writeChunk;
+    processMap_["commitUpload"] = &AimProcessor::process_commitUpload;
+    processMap_["abortUpload"] = &AimProcessor::process_abortUpload;
+    processMap_["powerOnMany"] = &AimProcessor::process_powerOnMany;
+    processMap_["powerOffMany"] = &AimProcessor::process_powerOffMany;
+    processMap_["shutdownMany"] = &AimProcessor::process_shutdownMany;
+    processMap_["resetMany"] = &AimProcessor::process_resetMany;
+    processMap_["pauseMany"] = &AimProcessor::process_pauseMany;
+    processMap_["resumeMany"] = &AimProcessor::process_resumeMany;
+    processMap_["shutdownWithDeadline"] = &AimProcessor::process_shutdownWithDeadline;
+    processMap_["shutdownManyWithDeadline"] = &AimProcessor::process_shutdownManyWithDeadline;
+    processMap_["readChunk"] = &AimProcessor::process_readChunk;
   }
 
   virtual ~AimProcessor() {}
@@ -5441,6 +9716,232 @@ class AimMultiface : virtual public AimIf {
     ifaces_[i]->upload(file, path);
   }
 
+  void getDomainsLite(std::vector<DomainInfo> & _return) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->getDomainsLite(_return);
+    }
+    ifaces_[i]->getDomainsLite(_return);
+    return;
+  }
+
+  void getDomainsWithFields(std::vector<DomainInfo> & _return, const DomainFields::type fields) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->getDomainsWithFields(_return, fields);
+    }
+    ifaces_[i]->getDomainsWithFields(_return, fields);
+    return;
+  }
+
+  void getDomainsChangedSince(DomainChanges& _return, const int64_t generation, const DomainFields::type fields) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->getDomainsChangedSince(_return, generation, fields);
+    }
+    ifaces_[i]->getDomainsChangedSince(_return, generation, fields);
+    return;
+  }
+
+  void waitForEvents(DomainEvents& _return, const int64_t sinceId, const int32_t timeoutMs) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->waitForEvents(_return, sinceId, timeoutMs);
+    }
+    ifaces_[i]->waitForEvents(_return, sinceId, timeoutMs);
+    return;
+  }
+
+  void startCopyFromRepositoryToDatastore(std::string& _return, const std::string& virtualImageRepositoryPath, const std::string& datastorePath, const std::string& virtualMachineUUID) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->startCopyFromRepositoryToDatastore(_return, virtualImageRepositoryPath, datastorePath, virtualMachineUUID);
+    }
+    ifaces_[i]->startCopyFromRepositoryToDatastore(_return, virtualImageRepositoryPath, datastorePath, virtualMachineUUID);
+    return;
+  }
+
+  void startCopyFromDatastoreToRepository(std::string& _return, const std::string& virtualMachineUUID, const std::string& snapshot, const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->startCopyFromDatastoreToRepository(_return, virtualMachineUUID, snapshot, destinationRepositoryPath, sourceDatastorePath);
+    }
+    ifaces_[i]->startCopyFromDatastoreToRepository(_return, virtualMachineUUID, snapshot, destinationRepositoryPath, sourceDatastorePath);
+    return;
+  }
+
+  void startCopy(std::string& _return, const std::string& source, const std::string& destination) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->startCopy(_return, source, destination);
+    }
+    ifaces_[i]->startCopy(_return, source, destination);
+    return;
+  }
+
+  void getJobStatus(JobStatus& _return, const std::string& jobId) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->getJobStatus(_return, jobId);
+    }
+    ifaces_[i]->getJobStatus(_return, jobId);
+    return;
+  }
+
+  void cancelJob(const std::string& jobId) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->cancelJob(jobId);
+    }
+    ifaces_[i]->cancelJob(jobId);
+  }
+
+  void getServerStats(ServerStats& _return) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->getServerStats(_return);
+    }
+    ifaces_[i]->getServerStats(_return);
+    return;
+  }
+
+  void openUpload(std::string& _return, const std::string& path, const int64_t size) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->openUpload(_return, path, size);
+    }
+    ifaces_[i]->openUpload(_return, path, size);
+    return;
+  }
+
+  void writeChunk(const std::string& uploadId, const int64_t offset, const std::string& data) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->writeChunk(uploadId, offset, data);
+    }
+    ifaces_[i]->writeChunk(uploadId, offset, data);
+  }
+
+  void commitUpload(const std::string& uploadId, const int64_t crc32) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->commitUpload(uploadId, crc32);
+    }
+    ifaces_[i]->commitUpload(uploadId, crc32);
+  }
+
+  void abortUpload(const std::string& uploadId) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->abortUpload(uploadId);
+    }
+    ifaces_[i]->abortUpload(uploadId);
+  }
+
+  void powerOnMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->powerOnMany(_return, domainNames, options);
+    }
+    ifaces_[i]->powerOnMany(_return, domainNames, options);
+    return;
+  }
+
+  void powerOffMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->powerOffMany(_return, domainNames, options);
+    }
+    ifaces_[i]->powerOffMany(_return, domainNames, options);
+    return;
+  }
+
+  void shutdownMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->shutdownMany(_return, domainNames, options);
+    }
+    ifaces_[i]->shutdownMany(_return, domainNames, options);
+    return;
+  }
+
+  void resetMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->resetMany(_return, domainNames, options);
+    }
+    ifaces_[i]->resetMany(_return, domainNames, options);
+    return;
+  }
+
+  void pauseMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->pauseMany(_return, domainNames, options);
+    }
+    ifaces_[i]->pauseMany(_return, domainNames, options);
+    return;
+  }
+
+  void resumeMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const BatchOptions& options) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->resumeMany(_return, domainNames, options);
+    }
+    ifaces_[i]->resumeMany(_return, domainNames, options);
+    return;
+  }
+
+  void shutdownWithDeadline(DomainResult& _return, const std::string& domainName, const int32_t timeoutSec) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->shutdownWithDeadline(_return, domainName, timeoutSec);
+    }
+    ifaces_[i]->shutdownWithDeadline(_return, domainName, timeoutSec);
+    return;
+  }
+
+  void shutdownManyWithDeadline(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames, const int32_t timeoutSec, const BatchOptions& options) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->shutdownManyWithDeadline(_return, domainNames, timeoutSec, options);
+    }
+    ifaces_[i]->shutdownManyWithDeadline(_return, domainNames, timeoutSec, options);
+    return;
+  }
+
+  void readChunk(FileChunk& _return, const std::string& path, const int64_t offset, const int32_t length, const bool compress) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->readChunk(_return, path, offset, length, compress);
+    }
+    ifaces_[i]->readChunk(_return, path, offset, length, compress);
+    return;
+  }
+
 };
 
 
@@ -28,8 +28,16 @@
 #include <StorageService.h>
 #include <LibvirtService.h>
 #include <MetricService.h>
+#include <RequestStats.h>
+#include <LaneProcessor.h>
+#include <SingleFlight.h>
+#include <DomainBatch.h>
+#include <INIReader.h>
 
 #include <vector>
+#include <sstream>
+
+#include <boost/bind.hpp>
 
 #include <aim_types.h>
 
@@ -41,7 +49,65 @@ class AimHandler: virtual public AimIf
         Rimp* rimp;
         VLan* vlan;
         StorageService* storage;
+        LibvirtService* libvirt;
         MetricService* metrics;
+        boost::shared_ptr<RequestStats> requestStats;
+
+        /** Identical concurrent queries share a single call (see the cache section of the configuration) */
+        SingleFlight<std::vector<DomainInfo>, LibvirtException> domainFlights;
+        SingleFlight<NodeInfo, LibvirtException> nodeFlights;
+        SingleFlight<std::vector<Datastore>, RimpException> datastoreFlights;
+
+        /** Maximum operations of a batch running at the same time */
+        int batchParallelism;
+
+        // Run a single domain operation on each domain of a batch
+        void runMany(std::vector<DomainResult> & _return, boost::function<void (const std::string&, DomainResult&)> operation,
+                const std::vector<std::string> & domainNames, const BatchOptions& options)
+        {
+            int parallelism = options.parallelism > 0 && options.parallelism < batchParallelism ?
+                options.parallelism : batchParallelism;
+
+            DomainBatch batch(operation, domainNames, _return);
+            batch.run(parallelism, options.staggerMs);
+        }
+
+        void loadDatastores(std::vector<Datastore> & _return)
+        {
+            _return = rimp->getDatastores();
+        }
+
+        void loadNodeInfo(NodeInfo& _return)
+        {
+            virConnectPtr conn = libvirt->connectReadOnly();
+
+            try
+            {
+                libvirt->getNodeInfo(_return, conn);
+                libvirt->disconnectReadOnly(conn);
+            }
+            catch (...)
+            {
+                libvirt->disconnectReadOnly(conn);
+                throw;
+            }
+        }
+
+        void loadDomains(std::vector<DomainInfo> & _return, const DomainFields::type fields)
+        {
+            virConnectPtr conn = libvirt->connectReadOnly();
+
+            try
+            {
+                libvirt->getDomains(_return, fields, conn);
+                libvirt->disconnectReadOnly(conn);
+            }
+            catch (...)
+            {
+                libvirt->disconnectReadOnly(conn);
+                throw;
+            }
+        }
 
     public:
         AimHandler()
@@ -49,7 +115,34 @@ class AimHandler: virtual public AimIf
             rimp = new Rimp();
             vlan = new VLan();
             storage = new StorageService();
+            libvirt = new LibvirtService();
             metrics = new MetricService();
+            batchParallelism = DEFAULT_BATCH_PARALLELISM;
+        }
+
+        void configure(INIReader& configuration)
+        {
+            const char* methods[] = { "getDomains", "getDomainsLite", "getDomainsWithFields", NULL };
+
+            for (int i = 0; methods[i] != NULL; i++)
+            {
+                domainFlights.setTtl(methods[i], configuration.GetInteger("cache", methods[i], 0));
+            }
+
+            nodeFlights.setTtl("getNodeInfo", configuration.GetInteger("cache", "getNodeInfo", 0));
+            datastoreFlights.setTtl("getDatastores", configuration.GetInteger("cache", "getDatastores", 0));
+
+            batchParallelism = configuration.GetInteger("libvirt", "batchParallelism", DEFAULT_BATCH_PARALLELISM);
+            batchParallelism = (batchParallelism > 0 ? batchParallelism : DEFAULT_BATCH_PARALLELISM);
+
+            // Domain operations wait for their lock while holding a lane slot
+            libvirt->getDomainLocks().setMaxWait(configuration.GetInteger("server", "mutationMaxWait",
+                    DEFAULT_MUTATION_MAX_WAIT));
+        }
+
+        void setRequestStats(boost::shared_ptr<RequestStats> stats)
+        {
+            requestStats = stats;
         }
 
         vector<Service*> getServices()
@@ -59,6 +152,7 @@ class AimHandler: virtual public AimIf
             services.push_back(rimp);
             services.push_back(vlan);
             services.push_back(storage);
+            services.push_back(libvirt);
             services.push_back(metrics);
 
             return services;
@@ -76,7 +170,7 @@ class AimHandler: virtual public AimIf
 
         void getDatastores(std::vector<Datastore> & _return)
         {
-            _return = rimp->getDatastores();
+            datastoreFlights.run("getDatastores", "", _return, boost::bind(&AimHandler::loadDatastores, this, _1));
         }
 
         void getNetInterfaces(std::vector<NetInterface> & _return)
@@ -131,342 +225,362 @@ class AimHandler: virtual public AimIf
 
         void getNodeInfo(NodeInfo& _return)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
-
-            try
-            {
-                libvirt.getNodeInfo(_return, conn);
-                libvirt.disconnect(conn);
-            }
-            catch (...)
-            {
-                libvirt.disconnect(conn);
-                throw;
-            }
+            nodeFlights.run("getNodeInfo", "", _return, boost::bind(&AimHandler::loadNodeInfo, this, _1));
         }
 
         void getDomains(std::vector<DomainInfo> & _return)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
-
-            try
-            {
-                libvirt.getDomains(_return, conn);
-                libvirt.disconnect(conn);
-            }
-            catch (...)
-            {
-                libvirt.disconnect(conn);
-                throw;
-            }
+            domainFlights.run("getDomains", "", _return,
+                    boost::bind(&AimHandler::loadDomains, this, _1, DomainFields::FULL));
         }
 
         void defineDomain(const std::string& xmlDesc)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            // Taken before the connection, so the operations waiting for a domain do not hold the pool
+            // (see the ordering in DomainLocks.h)
+            DomainLock lock(libvirt->getDomainLocks(), libvirt->getDomainUUID(xmlDesc));
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.defineDomain(conn, xmlDesc);
-                libvirt.disconnect(conn);
+                libvirt->defineDomain(conn, xmlDesc);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         void undefineDomain(const std::string& domainName)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            DomainLock lock(libvirt->getDomainLocks(), domainName);
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.undefineDomain(conn, domainName);
-                libvirt.disconnect(conn);
+                libvirt->undefineDomain(conn, domainName);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         bool existDomain(const std::string& domainName)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            virConnectPtr conn = libvirt->connectReadOnly();
 
             try
             {
-                bool exist = libvirt.existDomain(conn, domainName);
-                libvirt.disconnect(conn);
+                bool exist = libvirt->existDomain(conn, domainName);
+                libvirt->disconnectReadOnly(conn);
                 return exist;
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnectReadOnly(conn);
                 return false;
             }
         }
 
         DomainState::type getDomainState(const std::string& domainName)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            virConnectPtr conn = libvirt->connectReadOnly();
 
             try
             {
-                DomainState::type state = libvirt.getDomainState(conn, domainName);
-                libvirt.disconnect(conn);
+                DomainState::type state = libvirt->getDomainState(conn, domainName);
+                libvirt->disconnectReadOnly(conn);
                 return state;
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnectReadOnly(conn);
                 throw;
             }
         }
 
         void getDomainInfo(DomainInfo& _return, const std::string& domainName)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            virConnectPtr conn = libvirt->connectReadOnly();
 
             try
             {
-                libvirt.getDomainInfo(_return, conn, domainName);
-                libvirt.disconnect(conn);
+                libvirt->getDomainInfo(_return, conn, domainName);
+                libvirt->disconnectReadOnly(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnectReadOnly(conn);
                 throw;
             }
         }
 
         void powerOn(const std::string& domainName)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            DomainLock lock(libvirt->getDomainLocks(), domainName);
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.powerOn(conn, domainName);
-                libvirt.disconnect(conn);
+                libvirt->powerOn(conn, domainName);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         void powerOff(const std::string& domainName)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            DomainLock lock(libvirt->getDomainLocks(), domainName);
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.powerOff(conn, domainName);
-                libvirt.disconnect(conn);
+                libvirt->powerOff(conn, domainName);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         void shutdown(const std::string& domainName)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            DomainLock lock(libvirt->getDomainLocks(), domainName);
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.shutdown(conn, domainName);
-                libvirt.disconnect(conn);
+                libvirt->shutdown(conn, domainName);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         void reset(const std::string& domainName)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            DomainLock lock(libvirt->getDomainLocks(), domainName);
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.reset(conn, domainName);
-                libvirt.disconnect(conn);
+                libvirt->reset(conn, domainName);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         void pause(const std::string& domainName)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            DomainLock lock(libvirt->getDomainLocks(), domainName);
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.pause(conn, domainName);
-                libvirt.disconnect(conn);
+                libvirt->pause(conn, domainName);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         void resume(const std::string& domainName)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            DomainLock lock(libvirt->getDomainLocks(), domainName);
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.resume(conn, domainName);
-                libvirt.disconnect(conn);
+                libvirt->resume(conn, domainName);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
+        void powerOnMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames,
+                const BatchOptions& options)
+        {
+            runMany(_return, boost::bind(&AimHandler::powerOn, this, _1), domainNames, options);
+        }
+
+        void powerOffMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames,
+                const BatchOptions& options)
+        {
+            runMany(_return, boost::bind(&AimHandler::powerOff, this, _1), domainNames, options);
+        }
+
+        void shutdownMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames,
+                const BatchOptions& options)
+        {
+            runMany(_return, boost::bind(&AimHandler::shutdown, this, _1), domainNames, options);
+        }
+
+        void resetMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames,
+                const BatchOptions& options)
+        {
+            runMany(_return, boost::bind(&AimHandler::reset, this, _1), domainNames, options);
+        }
+
+        void pauseMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames,
+                const BatchOptions& options)
+        {
+            runMany(_return, boost::bind(&AimHandler::pause, this, _1), domainNames, options);
+        }
+
+        void resumeMany(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames,
+                const BatchOptions& options)
+        {
+            runMany(_return, boost::bind(&AimHandler::resume, this, _1), domainNames, options);
+        }
+
+        void shutdownWithDeadline(DomainResult& _return, const std::string& domainName, const int32_t timeoutSec)
+        {
+            // Held for the whole wait, but connections are only borrowed for each call to libvirt
+            DomainLock lock(libvirt->getDomainLocks(), domainName);
+            libvirt->shutdownWithDeadline(domainName, timeoutSec, _return);
+        }
+
+        void shutdownManyWithDeadline(std::vector<DomainResult> & _return, const std::vector<std::string> & domainNames,
+                const int32_t timeoutSec, const BatchOptions& options)
+        {
+            runMany(_return, boost::bind(&AimHandler::shutdownWithDeadline, this, _2, _1, timeoutSec), domainNames,
+                options);
+        }
+
         void createISCSIStoragePool(const std::string& name, const std::string& host, const std::string& iqn, const std::string& targetPath)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.createISCSIStoragePool(conn, name, host, iqn, targetPath);
-                libvirt.disconnect(conn);
+                libvirt->createISCSIStoragePool(conn, name, host, iqn, targetPath);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         void createNFSStoragePool(const std::string& name, const std::string& host, const std::string& dir, const std::string& targetPath)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.createNFSStoragePool(conn, name, host, dir, targetPath);
-                libvirt.disconnect(conn);
+                libvirt->createNFSStoragePool(conn, name, host, dir, targetPath);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         void createDirStoragePool(const std::string& name, const std::string& targetPath)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.createDirStoragePool(conn, name, targetPath);
-                libvirt.disconnect(conn);
+                libvirt->createDirStoragePool(conn, name, targetPath);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         void createDisk(const std::string& poolName, const std::string& name, double capacityInKb, double allocationInKb, const std::string& format)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.createDisk(conn, poolName, name, capacityInKb, allocationInKb, format);
-                libvirt.disconnect(conn);
+                libvirt->createDisk(conn, poolName, name, capacityInKb, allocationInKb, format);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         void deleteDisk(const std::string& poolName, const std::string& name)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.deleteDisk(conn, poolName, name);
-                libvirt.disconnect(conn);
+                libvirt->deleteDisk(conn, poolName, name);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         void resizeVol(const std::string& poolName, const std::string& name, const double capacityInKb)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.resizeVol(conn, poolName, name, capacityInKb);
-                libvirt.disconnect(conn);
+                libvirt->resizeVol(conn, poolName, name, capacityInKb);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
 
         void resizeDisk(const std::string& domainName, const std::string& diskPath, const double diskSizeInKb)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            DomainLock lock(libvirt->getDomainLocks(), domainName);
+            virConnectPtr conn = libvirt->connect();
 
             try
             {
-                libvirt.resizeDisk(conn, domainName, diskPath, diskSizeInKb);
-                libvirt.disconnect(conn);
+                libvirt->resizeDisk(conn, domainName, diskPath, diskSizeInKb);
+                libvirt->disconnect(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnect(conn);
                 throw;
             }
         }
@@ -488,17 +602,16 @@ class AimHandler: virtual public AimIf
 
         void getDomainBlockInfo(DomainBlockInfo& _return, const std::string& domainName, const std::string& diskPath)
         {
-            LibvirtService libvirt;
-            virConnectPtr conn = libvirt.connect();
+            virConnectPtr conn = libvirt->connectReadOnly();
 
             try
             {
-                libvirt.getDomainBlockInfo(conn, domainName, diskPath, _return);
-                libvirt.disconnect(conn);
+                libvirt->getDomainBlockInfo(conn, domainName, diskPath, _return);
+                libvirt->disconnectReadOnly(conn);
             }
             catch (...)
             {
-                libvirt.disconnect(conn);
+                libvirt->disconnectReadOnly(conn);
                 throw;
             }
         }
@@ -507,6 +620,108 @@ class AimHandler: virtual public AimIf
         {
             rimp->dumpToFile(file.data, path);
         }
+
+        void getDomainsLite(std::vector<DomainInfo> & _return)
+        {
+            domainFlights.run("getDomainsLite", "", _return,
+                    boost::bind(&AimHandler::loadDomains, this, _1, DomainFields::RESOURCES));
+        }
+
+        void getDomainsWithFields(std::vector<DomainInfo> & _return, const DomainFields::type fields)
+        {
+            ostringstream arguments;
+            arguments << fields;
+
+            domainFlights.run("getDomainsWithFields", arguments.str(), _return,
+                    boost::bind(&AimHandler::loadDomains, this, _1, fields));
+        }
+
+        void getDomainsChangedSince(DomainChanges& _return, const int64_t generation, const DomainFields::type fields)
+        {
+            virConnectPtr conn = libvirt->connectReadOnly();
+
+            try
+            {
+                libvirt->getDomainsChangedSince(_return, generation, fields, conn);
+                libvirt->disconnectReadOnly(conn);
+            }
+            catch (...)
+            {
+                libvirt->disconnectReadOnly(conn);
+                throw;
+            }
+        }
+
+        void waitForEvents(DomainEvents& _return, const int64_t sinceId, const int32_t timeoutMs)
+        {
+            libvirt->waitForEvents(_return, sinceId, timeoutMs);
+        }
+
+        void startCopyFromRepositoryToDatastore(std::string& _return, const std::string& virtualImageRepositoryPath,
+                const std::string& datastorePath, const std::string& virtualMachineUUID)
+        {
+            string datastoreIn = datastorePath;
+            _return = rimp->startCopyFromRepositoryToDatastore(virtualImageRepositoryPath, datastoreIn, virtualMachineUUID);
+        }
+
+        void startCopyFromDatastoreToRepository(std::string& _return, const std::string& virtualMachineUUID,
+                const std::string& snapshot, const std::string& destinationRepositoryPath,
+                const std::string& sourceDatastorePath)
+        {
+            _return = rimp->startCopyFromDatastoreToRepository(virtualMachineUUID, snapshot, destinationRepositoryPath,
+                    sourceDatastorePath);
+        }
+
+        void startCopy(std::string& _return, const std::string& source, const std::string& destination)
+        {
+            _return = rimp->startCopy(source, destination);
+        }
+
+        void getJobStatus(JobStatus& _return, const std::string& jobId)
+        {
+            _return = rimp->getJobStatus(jobId);
+        }
+
+        void cancelJob(const std::string& jobId)
+        {
+            rimp->cancelJob(jobId);
+        }
+
+        void openUpload(std::string& _return, const std::string& path, const int64_t size)
+        {
+            _return = rimp->openUpload(path, size);
+        }
+
+        void writeChunk(const std::string& uploadId, const int64_t offset, const std::string& data)
+        {
+            rimp->writeChunk(uploadId, offset, data);
+        }
+
+        void commitUpload(const std::string& uploadId, const int64_t crc32)
+        {
+            rimp->commitUpload(uploadId, crc32);
+        }
+
+        void abortUpload(const std::string& uploadId)
+        {
+            rimp->abortUpload(uploadId);
+        }
+
+        void readChunk(FileChunk& _return, const std::string& path, const int64_t offset, const int32_t length,
+                const bool compress)
+        {
+            rimp->readChunk(_return, path, offset, length, compress);
+        }
+
+        void getServerStats(ServerStats& _return)
+        {
+            if (requestStats.get() != NULL)
+            {
+                requestStats->getServerStats(_return);
+            }
+
+            libvirt->getDomainLocks().getStats(_return.domainLocks);
+        }
 };
 
 #endif
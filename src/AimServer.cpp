@@ -1,24 +1,33 @@
 #include <Aim.h>
 
 #include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/protocol/TCompactProtocol.h>
 #include <thrift/server/TServer.h>
 #include <thrift/server/TNonblockingServer.h>
+#include <thrift/server/TThreadedServer.h>
 #include <thrift/transport/TServerSocket.h>
 #include <thrift/transport/TBufferTransports.h>
 #include <thrift/concurrency/ThreadManager.h>
 #include <thrift/concurrency/PosixThreadFactory.h>
 
 #include <cstdlib>
+#include <cstdio>
 #include <cctype>
 #include <getopt.h>
 
 #include <AimServer.h>
+#include <LaneProcessor.h>
+#include <CompressedProcessor.h>
+#include <DeadlineProcessor.h>
+#include <RequestStats.h>
+#include <UnixServerSocket.h>
 #include <Service.h>
 #include <Macros.h>
 #include <Debug.h>
 
 #include <vector>
 #include <signal.h>
+#include <sched.h>
 #include <sys/stat.h>
 
 #include <version.h>
@@ -38,6 +47,10 @@ using namespace std;
 
 bool daemonizeServer = false;
 int threads = DEFAULT_THREADS;
+int ioThreads = 0;
+string ioCpus;
+string workerCpus;
+string unixSocket;
 
 int main(int argc, char **argv)
 {
@@ -69,10 +82,75 @@ int main(int argc, char **argv)
     // Print configuration summary
     int serverPort = configuration.GetInteger("server", "port", 60606);
 
+    // Command line arguments take precedence over the configuration file
+    if (ioThreads <= 0)
+    {
+        ioThreads = configuration.GetInteger("server", "ioThreads", DEFAULT_IO_THREADS);
+        ioThreads = (ioThreads > 0 ? ioThreads : DEFAULT_IO_THREADS);
+    }
+    if (ioCpus.empty())
+    {
+        ioCpus = configuration.Get("server", "ioCpus", "");
+    }
+    if (workerCpus.empty())
+    {
+        workerCpus = configuration.Get("server", "workerCpus", "");
+    }
+    unixSocket = configuration.Get("server", "unixSocket", "");
+
     // Aim server initialization
     LOG("Initializing AIM v%s", aim_version);
-    shared_ptr<TProcessor> processor(new AimProcessor(aimHandler));
-    shared_ptr<TProtocolFactory> protocolFactory(new TBinaryProtocolFactory());
+    shared_ptr<LaneProcessor> processor(new LaneProcessor(aimHandler));
+    processor->initialize(configuration, threads);
+    aimHandler->configure(configuration);
+
+    // Request counters and latencies, see getServerStats
+    shared_ptr<RequestStats> requestStats(new RequestStats());
+    processor->setEventHandler(requestStats);
+    aimHandler->setRequestStats(requestStats);
+    processor->setRequestStats(requestStats.get());
+
+    // Wire protocol. With auto, requests sent with the compact protocol are answered with it too
+    string protocol = configuration.Get("server", "protocol", DEFAULT_PROTOCOL);
+    shared_ptr<TProtocolFactory> protocolFactory;
+
+    if (protocol == "compact")
+    {
+        protocolFactory.reset(new TCompactProtocolFactory());
+    }
+    else if (protocol == "binary" || protocol == "auto")
+    {
+        protocolFactory.reset(new TBinaryProtocolFactory());
+        processor->setProtocolDetection(protocol == "auto");
+    }
+    else
+    {
+        LOG("Unknown protocol '%s', it must be binary, compact or auto", protocol.c_str());
+        exit(EXIT_FAILURE);
+    }
+
+    // Deadlines, set by the clients on each request or by default
+    int defaultDeadline = configuration.GetInteger("server", "defaultDeadline", DEFAULT_DEADLINE);
+    shared_ptr<DeadlineProcessor> deadlineProcessor(new DeadlineProcessor(processor, protocolFactory,
+            defaultDeadline, configuration.GetInteger("server", "maxStuckCalls", DEFAULT_MAX_STUCK_CALLS)));
+    requestStats->setWatchdog(deadlineProcessor.get());
+    deadlineProcessor->setRequestStats(requestStats.get());
+
+    if (defaultDeadline > 0)
+    {
+        LOG("Requests without a deadline time out after %d ms", defaultDeadline);
+    }
+
+    // Optional zlib compression, used only with the clients that send compressed requests
+    shared_ptr<TProcessor> serverProcessor = deadlineProcessor;
+    if (configuration.GetBoolean("server", "compression", false))
+    {
+        int threshold = configuration.GetInteger("server", "compressionThreshold", DEFAULT_COMPRESSION_THRESHOLD);
+        int level = configuration.GetInteger("server", "compressionLevel", DEFAULT_COMPRESSION_LEVEL);
+
+        LOG("Compressing the replies of at least %d bytes (level %d) to compressed requests", threshold, level);
+        serverProcessor.reset(new CompressedProcessor(deadlineProcessor, protocolFactory, threshold, level));
+    }
 
     // Aim services initialization and start
     vector<Service*> services = aimHandler->getServices();
@@ -105,13 +183,40 @@ int main(int argc, char **argv)
     signal(SIGINT, deinitialize);
     signal(SIGTERM, deinitialize);
 
+    // Threads inherit the CPU affinity of the thread that creates them. The main thread is pinned to the worker
+    // CPUs while the thread pool is started, and to the I/O ones before serving (it creates the I/O threads)
+    cpu_set_t defaultCpus;
+    CPU_ZERO(&defaultCpus);
+    sched_getaffinity(0, sizeof(defaultCpus), &defaultCpus);
+
     // Main loop
-    LOG("Aim listening at port %d using %d threads", serverPort, threads);
-    shared_ptr<ThreadManager> threadManager = ThreadManager::newSimpleThreadManager(threads);
+    int serverThreads = processor->getThreads();
+    LOG("Aim listening at port %d using %d threads and %d I/O threads (%s protocol)", serverPort, serverThreads,
+            ioThreads, protocol.c_str());
+    shared_ptr<ThreadManager> threadManager = ThreadManager::newSimpleThreadManager(serverThreads);
     shared_ptr<PosixThreadFactory> threadFactory = shared_ptr<PosixThreadFactory>(new PosixThreadFactory());
     threadManager->threadFactory(threadFactory);
+    requestStats->setSources(processor.get(), threadManager);
+
+    setAffinity(workerCpus, defaultCpus, "worker");
     threadManager->start();
-    TNonblockingServer server(processor, protocolFactory, serverPort, threadManager);
+
+    // Local clients use the same processor (and framing) through a Unix socket. Each connection has its own thread
+    if (!unixSocket.empty())
+    {
+        shared_ptr<TServerTransport> localSocket(new UnixServerSocket(unixSocket,
+                configuration.Get("server", "unixSocketUsers", "")));
+        shared_ptr<TTransportFactory> localTransportFactory(new LocalFramedTransportFactory());
+        shared_ptr<TServer> localServer(new TThreadedServer(serverProcessor, localSocket, localTransportFactory,
+                protocolFactory));
+
+        LOG("Aim listening at '%s'", unixSocket.c_str());
+        boost::thread localThread(boost::bind(serveLocal, localServer));
+    }
+    setAffinity(ioCpus, defaultCpus, "I/O");
+
+    TNonblockingServer server(serverProcessor, protocolFactory, serverPort, threadManager);
+    server.setNumIOThreads(ioThreads);
     server.serve();
     
     exit(EXIT_FAILURE);
@@ -138,10 +243,27 @@ void deinitialize(int param)
         }
     }
 
+    if (!unixSocket.empty())
+    {
+        unlink(unixSocket.c_str());
+    }
+
     LOG("Bye!");
     exit(EXIT_SUCCESS);
 }
 
+void serveLocal(shared_ptr<TServer> server)
+{
+    try
+    {
+        server->serve();
+    }
+    catch (TException& e)
+    {
+        LOG("Unable to serve at '%s': %s", unixSocket.c_str(), e.what());
+    }
+}
+
 const char * parseArguments(int argc, char **argv)
 {
     int next_opt;
@@ -174,6 +296,18 @@ const char * parseArguments(int argc, char **argv)
                 if (threads <= 0) { threads = DEFAULT_THREADS; }
                 break;
 
+            case 'i':
+                ioThreads = atoi(optarg);
+                break;
+
+            case 'a':
+                ioCpus = optarg;
+                break;
+
+            case 'w':
+                workerCpus = optarg;
+                break;
+
             default:
                 printUsage(argv[0]);
                 exit(EXIT_FAILURE);
@@ -190,7 +324,74 @@ void printUsage(const char* program)
             "    -c --config-file=<file>         Alternate configuration file\n"
             "    -d --daemon                     Run as daemon\n"
             "    -v --version                    Show AIM server version\n"
-            "    -t --threads                    Maximum threads to handle requests\n" );
+            "    -t --threads                    Maximum threads to handle queries\n"
+            "    -i --io-threads                 Threads handling the network I/O\n"
+            "    -a --io-cpus=<list>             CPUs to run the I/O threads on (e.g. 0-3,8)\n"
+            "    -w --worker-cpus=<list>         CPUs to run the request threads on (e.g. 4-63)\n" );
+}
+
+bool parseCpuList(const string& list, cpu_set_t& cpus)
+{
+    CPU_ZERO(&cpus);
+
+    size_t start = 0;
+    while (start <= list.size())
+    {
+        size_t end = list.find(',', start);
+        if (end == string::npos)
+        {
+            end = list.size();
+        }
+
+        int first, last;
+        string range = list.substr(start, end - start);
+        if (sscanf(range.c_str(), "%d-%d", &first, &last) != 2)
+        {
+            if (sscanf(range.c_str(), "%d", &first) != 1)
+            {
+                return false;
+            }
+            last = first;
+        }
+
+        if (first < 0 || last < first || last >= CPU_SETSIZE)
+        {
+            return false;
+        }
+
+        for (int cpu = first; cpu <= last; cpu++)
+        {
+            CPU_SET(cpu, &cpus);
+        }
+
+        start = end + 1;
+    }
+
+    return CPU_COUNT(&cpus) > 0;
+}
+
+void setAffinity(const string& list, const cpu_set_t& defaultCpus, const char* threadType)
+{
+    cpu_set_t cpus;
+
+    if (list.empty())
+    {
+        cpus = defaultCpus;
+    }
+    else if (!parseCpuList(list, cpus))
+    {
+        LOG("Invalid %s CPU list '%s', threads not pinned", threadType, list.c_str());
+        cpus = defaultCpus;
+    }
+    else
+    {
+        LOG("Pinning %s threads to CPUs %s", threadType, list.c_str());
+    }
+
+    if (sched_setaffinity(0, sizeof(cpus), &cpus) < 0)
+    {
+        LOG("Unable to pin %s threads to CPUs %s", threadType, list.c_str());
+    }
 }
 
 static void daemonize(void)
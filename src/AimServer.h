@@ -23,17 +23,20 @@
 #define AIMSERVER_H
 
 #include <getopt.h>
+#include <sched.h>
 
 #include <AimHandler.hpp>
 
 #define DEFAULT_PORT 60606
 #define DEFAULT_CONFIG "aim.ini"
 #define DEFAULT_THREADS 4
+#define DEFAULT_IO_THREADS 1
+#define DEFAULT_PROTOCOL "auto"
 
 using boost::shared_ptr;
 
 // Server command line parsing structures
-const char* const short_opt = "hc:p:dvt:";
+const char* const short_opt = "hc:p:dvt:i:a:w:";
 const struct option long_opt[] =
 {
     { "help",        0, NULL, 'h' },
@@ -42,6 +45,9 @@ const struct option long_opt[] =
     { "daemon",      0, NULL, 'd' },
     { "version",     0, NULL, 'v' },
     { "threads",     1, NULL, 't' },
+    { "io-threads",  1, NULL, 'i' },
+    { "io-cpus",     1, NULL, 'a' },
+    { "worker-cpus", 1, NULL, 'w' },
     { NULL,          0, NULL, 0   }
 };
 
@@ -49,6 +55,9 @@ const struct option long_opt[] =
 const char * parseArguments(int argc, char **argv);
 void printUsage(const char* program);
 void deinitialize(int param);
+bool parseCpuList(const string& list, cpu_set_t& cpus);
+void setAffinity(const string& list, const cpu_set_t& defaultCpus, const char* threadType);
+void serveLocal(shared_ptr< ::apache::thrift::server::TServer> server);
 static void daemonize(void);
 
 // AIM handler
@@ -0,0 +1,145 @@
+#include <CompressedProcessor.h>
+
+#include <thrift/transport/TBufferTransports.h>
+
+#include <vector>
+
+#include <string.h>
+#include <zlib.h>
+
+using namespace ::apache::thrift;
+using namespace ::apache::thrift::protocol;
+using namespace ::apache::thrift::transport;
+
+#define INFLATE_BUFFER_SIZE     (64 * 1024)
+
+CompressedProcessor::CompressedProcessor(boost::shared_ptr<TProcessor> processor,
+        boost::shared_ptr<TProtocolFactory> protocolFactory, int threshold, int level) :
+    processor(processor), protocolFactory(protocolFactory), threshold(threshold), level(level)
+{
+}
+
+bool CompressedProcessor::isCompressed(TTransport* transport)
+{
+    uint32_t length = 1;
+    const uint8_t* first = transport->borrow(NULL, &length);
+
+    return first != NULL && first[0] == ZLIB_HEADER;
+}
+
+void CompressedProcessor::inflateMessage(TTransport* transport, string& _return)
+{
+    vector<uint8_t> input(INFLATE_BUFFER_SIZE);
+    vector<char> output(INFLATE_BUFFER_SIZE);
+
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+
+    if (inflateInit(&stream) != Z_OK)
+    {
+        throw TTransportException(TTransportException::INTERNAL_ERROR, "Unable to initialize zlib");
+    }
+
+    int ret = Z_OK;
+    string error;
+
+    // The message ends with the zlib stream, nothing after it is read
+    while (ret != Z_STREAM_END && error.empty())
+    {
+        if (stream.avail_in == 0)
+        {
+            uint32_t bytes = transport->read(&input[0], input.size());
+            if (bytes == 0)
+            {
+                error = "Compressed message truncated";
+                break;
+            }
+
+            stream.next_in = &input[0];
+            stream.avail_in = bytes;
+        }
+
+        stream.next_out = (Bytef*) &output[0];
+        stream.avail_out = output.size();
+
+        ret = inflate(&stream, Z_NO_FLUSH);
+        if (ret != Z_OK && ret != Z_STREAM_END)
+        {
+            error = "Corrupted compressed message";
+            break;
+        }
+
+        _return.append(&output[0], output.size() - stream.avail_out);
+
+        if (_return.size() > MAX_INFLATED_REQUEST)
+        {
+            error = "Compressed message too large";
+        }
+    }
+
+    inflateEnd(&stream);
+
+    if (!error.empty())
+    {
+        throw TTransportException(TTransportException::CORRUPTED_DATA, error);
+    }
+}
+
+void CompressedProcessor::deflateMessage(const uint8_t* message, uint32_t length, string& _return)
+{
+    uLongf size = compressBound(length);
+    _return.resize(size);
+
+    if (compress2((Bytef*) &_return[0], &size, message, length, level) != Z_OK)
+    {
+        throw TTransportException(TTransportException::INTERNAL_ERROR, "Unable to compress the reply");
+    }
+
+    _return.resize(size);
+}
+
+bool CompressedProcessor::process(boost::shared_ptr<TProtocol> in, boost::shared_ptr<TProtocol> out,
+        void* connectionContext)
+{
+    if (!isCompressed(in->getTransport().get()))
+    {
+        return processor->process(in, out, connectionContext);
+    }
+
+    string request;
+    inflateMessage(in->getTransport().get(), request);
+    in->getTransport()->readEnd();
+
+    // The plain message is processed as usual, from and to memory
+    boost::shared_ptr<TMemoryBuffer> requestBuffer(new TMemoryBuffer((uint8_t*) request.data(), request.size()));
+    boost::shared_ptr<TMemoryBuffer> replyBuffer(new TMemoryBuffer());
+
+    bool result = processor->process(protocolFactory->getProtocol(requestBuffer),
+            protocolFactory->getProtocol(replyBuffer), connectionContext);
+
+    uint8_t* reply;
+    uint32_t length;
+    replyBuffer->getBuffer(&reply, &length);
+
+    // Oneway calls have no reply
+    if (length == 0)
+    {
+        return result;
+    }
+
+    if ((int) length < threshold)
+    {
+        out->getTransport()->write(reply, length);
+    }
+    else
+    {
+        string compressed;
+        deflateMessage(reply, length, compressed);
+        out->getTransport()->write((const uint8_t*) compressed.data(), compressed.size());
+    }
+
+    out->getTransport()->writeEnd();
+    out->getTransport()->flush();
+
+    return result;
+}
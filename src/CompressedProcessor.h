@@ -0,0 +1,77 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef COMPRESSED_PROCESSOR_H
+#define COMPRESSED_PROCESSOR_H
+
+#include <string>
+
+#include <thrift/TProcessor.h>
+#include <thrift/protocol/TProtocol.h>
+#include <thrift/transport/TTransport.h>
+
+#define DEFAULT_COMPRESSION_THRESHOLD   4096
+#define DEFAULT_COMPRESSION_LEVEL       1
+
+// Largest request accepted once inflated, so a small message can not take all the memory
+#define MAX_INFLATED_REQUEST            (64 * 1024 * 1024)
+
+// First byte of a zlib stream (deflate with a 32K window). Thrift messages start with 0x80 or 0x82
+#define ZLIB_HEADER                     0x78
+
+using namespace std;
+
+/*
+ * Processor that accepts requests compressed with zlib and compresses
+ * their replies when they are large enough. A client opts in by
+ * compressing its requests: the whole message is sent as a zlib stream
+ * in place of the plain one. Replies to those requests are compressed
+ * the same way if they have at least the threshold size, and are sent
+ * plain otherwise, so clients tell them apart by their first byte.
+ * Plain requests are passed through untouched.
+ */
+class CompressedProcessor : public ::apache::thrift::TProcessor
+{
+    protected:
+        boost::shared_ptr< ::apache::thrift::TProcessor> processor;
+        boost::shared_ptr< ::apache::thrift::protocol::TProtocolFactory> protocolFactory;
+
+        int threshold;
+        int level;
+
+        bool isCompressed(::apache::thrift::transport::TTransport* transport);
+
+        // Read the compressed message (up to the end of the zlib stream) and return it inflated
+        void inflateMessage(::apache::thrift::transport::TTransport* transport, string& _return);
+
+        void deflateMessage(const uint8_t* message, uint32_t length, string& _return);
+
+    public:
+        CompressedProcessor(boost::shared_ptr< ::apache::thrift::TProcessor> processor,
+                boost::shared_ptr< ::apache::thrift::protocol::TProtocolFactory> protocolFactory, int threshold,
+                int level);
+
+        virtual bool process(boost::shared_ptr< ::apache::thrift::protocol::TProtocol> in,
+                boost::shared_ptr< ::apache::thrift::protocol::TProtocol> out, void* connectionContext);
+};
+
+#endif
@@ -0,0 +1,266 @@
+#include <CopyJobs.h>
+#include <RimpUtils.h>
+#include <Debug.h>
+
+#include <boost/bind.hpp>
+
+#include <uuid/uuid.h>
+
+using namespace boost::posix_time;
+
+static string newJobId()
+{
+    char id[37];
+    uuid_t uuid;
+    uuid_generate_random(uuid);
+    uuid_unparse(uuid, id);
+    return string(id);
+}
+
+CopyJobs::CopyJobs() : workers(DEFAULT_COPY_WORKERS), retentionSeconds(DEFAULT_JOB_RETENTION), stopping(false)
+{
+}
+
+CopyJobs::~CopyJobs()
+{
+}
+
+void CopyJobs::initialize(int copyWorkers, int jobRetentionSeconds)
+{
+    workers = copyWorkers > 0 ? copyWorkers : DEFAULT_COPY_WORKERS;
+    retentionSeconds = jobRetentionSeconds >= 0 ? jobRetentionSeconds : DEFAULT_JOB_RETENTION;
+
+    LOG("[DEBUG] [RIMP] Copy workers: %d, job retention: %ds", workers, retentionSeconds);
+}
+
+void CopyJobs::start()
+{
+    stopping = false;
+
+    for (int i = 0; i < workers; i++)
+    {
+        threads.create_thread(boost::bind(&CopyJobs::run, this));
+    }
+}
+
+void CopyJobs::stop()
+{
+    {
+        boost::mutex::scoped_lock lock(jobs_mutex);
+        stopping = true;
+
+        // Running copies stop at the next chunk
+        for (map<string, CopyJob>::iterator it = jobs.begin(); it != jobs.end(); ++it)
+        {
+            it->second.cancelled = true;
+        }
+
+        queue_condition.notify_all();
+    }
+
+    threads.join_all();
+}
+
+void CopyJobs::purge()
+{
+    ptime limit = microsec_clock::universal_time() - seconds(retentionSeconds);
+
+    map<string, CopyJob>::iterator it = jobs.begin();
+    while (it != jobs.end())
+    {
+        if (!it->second.finished.is_not_a_date_time() && it->second.finished < limit)
+        {
+            jobs.erase(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+string CopyJobs::submit(const string& source, const string& destination)
+{
+    boost::mutex::scoped_lock lock(jobs_mutex);
+
+    purge();
+
+    CopyJob job;
+    job.id = newJobId();
+    job.source = source;
+    job.destination = destination;
+    job.state = JobState::QUEUED;
+    job.totalBytes = 0;
+    job.copiedBytes = 0;
+    job.cancelled = false;
+
+    jobs[job.id] = job;
+    queue.push_back(job.id);
+    queue_condition.notify_one();
+
+    LOG("[RIMP] Copy job %s queued: '%s' to '%s'", job.id.c_str(), source.c_str(), destination.c_str());
+    return job.id;
+}
+
+string CopyJobs::done(const string& destination)
+{
+    boost::mutex::scoped_lock lock(jobs_mutex);
+
+    purge();
+
+    CopyJob job;
+    job.id = newJobId();
+    job.destination = destination;
+    job.state = JobState::DONE;
+    job.totalBytes = 0;
+    job.copiedBytes = 0;
+    job.started = microsec_clock::universal_time();
+    job.finished = job.started;
+    job.cancelled = false;
+
+    jobs[job.id] = job;
+    return job.id;
+}
+
+bool CopyJobs::getStatus(const string& id, JobStatus& _return)
+{
+    boost::mutex::scoped_lock lock(jobs_mutex);
+
+    map<string, CopyJob>::const_iterator it = jobs.find(id);
+    if (it == jobs.end())
+    {
+        return false;
+    }
+
+    const CopyJob& job = it->second;
+
+    _return.id = job.id;
+    _return.state = job.state;
+    _return.totalBytes = job.totalBytes;
+    _return.copiedBytes = job.copiedBytes;
+    _return.error = job.error;
+    _return.bytesPerSecond = 0;
+    _return.etaSeconds = -1;
+
+    if (!job.started.is_not_a_date_time())
+    {
+        ptime end = job.finished.is_not_a_date_time() ? microsec_clock::universal_time() : job.finished;
+        double elapsed = (end - job.started).total_milliseconds() / 1000.0;
+
+        if (elapsed > 0)
+        {
+            _return.bytesPerSecond = job.copiedBytes / elapsed;
+        }
+    }
+
+    if (job.state == JobState::DONE)
+    {
+        _return.etaSeconds = 0;
+    }
+    else if (job.state == JobState::RUNNING && _return.bytesPerSecond > 0)
+    {
+        _return.etaSeconds = (int32_t) ((job.totalBytes - job.copiedBytes) / _return.bytesPerSecond);
+    }
+
+    return true;
+}
+
+bool CopyJobs::cancel(const string& id)
+{
+    boost::mutex::scoped_lock lock(jobs_mutex);
+
+    map<string, CopyJob>::iterator it = jobs.find(id);
+    if (it == jobs.end())
+    {
+        return false;
+    }
+
+    CopyJob& job = it->second;
+    job.cancelled = true;
+
+    // Queued jobs are just skipped by the workers
+    if (job.state == JobState::QUEUED)
+    {
+        job.state = JobState::CANCELLED;
+        job.finished = microsec_clock::universal_time();
+    }
+
+    LOG("[RIMP] Copy job %s cancelled", id.c_str());
+    return true;
+}
+
+void CopyJobs::run()
+{
+    while (true)
+    {
+        CopyJob* job = NULL;
+
+        {
+            boost::mutex::scoped_lock lock(jobs_mutex);
+
+            while (!stopping && queue.empty())
+            {
+                queue_condition.wait(lock);
+            }
+
+            if (stopping)
+            {
+                return;
+            }
+
+            map<string, CopyJob>::iterator it = jobs.find(queue.front());
+            queue.pop_front();
+
+            if (it == jobs.end() || it->second.state != JobState::QUEUED)
+            {
+                continue;
+            }
+
+            // Not finished, so it will not be purged while running
+            job = &it->second;
+            job->state = JobState::RUNNING;
+            job->started = microsec_clock::universal_time();
+        }
+
+        execute(*job);
+    }
+}
+
+void CopyJobs::execute(CopyJob& job)
+{
+    LOG("[RIMP] Copy job %s started", job.id.c_str());
+
+    // Same copy as the synchronous calls, parent directory included
+    string error = fileCopy(job.source, job.destination,
+        boost::bind(&CopyJobs::progress, this, boost::ref(job), _1, _2));
+
+    boost::mutex::scoped_lock lock(jobs_mutex);
+    job.finished = microsec_clock::universal_time();
+
+    if (error.empty())
+    {
+        job.state = JobState::DONE;
+        LOG("[RIMP] Copy job %s done: '%s' copied", job.id.c_str(), job.destination.c_str());
+    }
+    else if (job.cancelled)
+    {
+        job.state = JobState::CANCELLED;
+        LOG("[RIMP] Copy job %s stopped", job.id.c_str());
+    }
+    else
+    {
+        job.state = JobState::FAILED;
+        job.error = error;
+        LOG("[ERROR] [RIMP] Copy job %s failed: %s", job.id.c_str(), error.c_str());
+    }
+}
+
+bool CopyJobs::progress(CopyJob& job, int64_t copied, int64_t total)
+{
+    boost::mutex::scoped_lock lock(jobs_mutex);
+
+    job.totalBytes = total;
+    job.copiedBytes = copied;
+
+    return !job.cancelled;
+}
@@ -0,0 +1,104 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef COPY_JOBS_H
+#define COPY_JOBS_H
+
+#include <string>
+#include <deque>
+#include <map>
+
+#include <boost/thread.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <aim_types.h>
+
+#define DEFAULT_COPY_WORKERS        2
+#define DEFAULT_JOB_RETENTION       3600
+
+using namespace std;
+
+struct CopyJob
+{
+    string id;
+    string source;
+    string destination;
+    JobState::type state;
+    int64_t totalBytes;
+    int64_t copiedBytes;
+    boost::posix_time::ptime started;
+    boost::posix_time::ptime finished;
+    string error;
+    bool cancelled;
+};
+
+/*
+ * Background file copies.
+ *
+ * Copies are queued and run by a fixed set of worker threads, so long
+ * copies do not hold the threads serving requests. Their progress can be
+ * queried (and they can be cancelled) by the id given when submitted.
+ */
+class CopyJobs : private boost::noncopyable
+{
+    protected:
+        map<string, CopyJob> jobs;
+
+        /** Ids of the jobs waiting for a worker */
+        deque<string> queue;
+
+        int workers;
+        int retentionSeconds;
+        bool stopping;
+
+        boost::thread_group threads;
+        boost::mutex jobs_mutex;
+        boost::condition_variable queue_condition;
+
+        void run();
+        void execute(CopyJob& job);
+
+        // Publish the progress of a running job, false if it was cancelled
+        bool progress(CopyJob& job, int64_t copied, int64_t total);
+
+        // Forget the jobs finished longer than retentionSeconds ago
+        void purge();
+
+    public:
+        CopyJobs();
+        ~CopyJobs();
+
+        void initialize(int copyWorkers, int jobRetentionSeconds);
+        void start();
+        void stop();
+
+        // Queue the copy of source to destination and return the job id
+        string submit(const string& source, const string& destination);
+
+        // Register a job with nothing to copy (already in place)
+        string done(const string& destination);
+
+        // They return false if the job does not exist
+        bool getStatus(const string& id, JobStatus& _return);
+        bool cancel(const string& id);
+};
+
+#endif
@@ -0,0 +1,299 @@
+#include <DeadlineProcessor.h>
+#include <LaneProcessor.h>
+#include <RequestStats.h>
+#include <UnixServerSocket.h>
+#include <Debug.h>
+
+#include <thrift/protocol/TCompactProtocol.h>
+
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+
+using namespace ::apache::thrift;
+using namespace ::apache::thrift::protocol;
+using namespace ::apache::thrift::transport;
+
+DeadlineProcessor::DeadlineProcessor(boost::shared_ptr<TProcessor> processor,
+        boost::shared_ptr<TProtocolFactory> protocolFactory, int defaultDeadline, int maxStuck) :
+    processor(processor), protocolFactory(protocolFactory), defaultDeadline(defaultDeadline > 0 ? defaultDeadline : 0),
+    maxStuck(maxStuck > 0 ? maxStuck : 0), timedOut(0), stuck(0), stats(NULL), idleRunners(0)
+{
+    watchdog = boost::thread(boost::bind(&DeadlineProcessor::runWatchdog, this));
+}
+
+DeadlineProcessor::~DeadlineProcessor()
+{
+    // Runners may be blocked in a stuck call, so they are not waited for
+    watchdog.interrupt();
+    watchdog.join();
+}
+
+void DeadlineProcessor::runWatchdog()
+{
+    boost::mutex::scoped_lock lock(deadline_mutex);
+
+    while (true)
+    {
+        if (deadlines.empty())
+        {
+            watchdog_condition.wait(lock);
+            continue;
+        }
+
+        boost::system_time now = boost::get_system_time();
+
+        // Abandon every call past its deadline and wake up its server thread
+        while (!deadlines.empty() && deadlines.begin()->first <= now)
+        {
+            DeadlineCall* call = deadlines.begin()->second;
+            deadlines.erase(deadlines.begin());
+
+            call->abandoned = true;
+            stuck++;
+            timedOut++;
+            call->finished.notify_one();
+        }
+
+        if (!deadlines.empty())
+        {
+            watchdog_condition.timed_wait(lock, deadlines.begin()->first);
+        }
+    }
+}
+
+void DeadlineProcessor::runRunner()
+{
+    boost::mutex::scoped_lock lock(deadline_mutex);
+
+    // Counted as idle since it was created
+    while (true)
+    {
+        while (pending.empty())
+        {
+            pending_condition.wait(lock);
+        }
+
+        boost::shared_ptr<DeadlineCall> call = pending.front();
+        pending.pop_front();
+        idleRunners--;
+
+        lock.unlock();
+        run(call);
+        lock.lock();
+
+        idleRunners++;
+    }
+}
+
+bool DeadlineProcessor::readDeadline(TTransport* transport, unsigned int& deadline)
+{
+    uint32_t length = 1;
+    const uint8_t* first = transport->borrow(NULL, &length);
+
+    if (first == NULL || first[0] != DEADLINE_HEADER)
+    {
+        return false;
+    }
+
+    uint8_t header[DEADLINE_HEADER_SIZE];
+    transport->readAll(header, DEADLINE_HEADER_SIZE);
+
+    deadline = (header[1] << 24) | (header[2] << 16) | (header[3] << 8) | header[4];
+    return true;
+}
+
+bool DeadlineProcessor::readMessage(TTransport* transport, string& _return)
+{
+    uint32_t length = 0;
+
+    // Reading further than the message would block waiting for the next one
+    TMemoryBuffer* memory = dynamic_cast<TMemoryBuffer*>(transport);
+    LocalFramedTransport* framed = dynamic_cast<LocalFramedTransport*>(transport);
+
+    if (memory != NULL)
+    {
+        length = memory->available_read();
+    }
+    else if (framed != NULL)
+    {
+        length = framed->available();
+    }
+
+    if (length == 0)
+    {
+        return false;
+    }
+
+    _return.resize(length);
+    transport->readAll((uint8_t*) &_return[0], length);
+
+    return true;
+}
+
+void DeadlineProcessor::run(boost::shared_ptr<DeadlineCall> call)
+{
+    boost::shared_ptr<TMemoryBuffer> requestBuffer(new TMemoryBuffer((uint8_t*) call->request.data(),
+            call->request.size()));
+    bool result = false;
+    string error;
+
+    try
+    {
+        // The connection may be gone by the time an abandoned call finishes, so it gets no context
+        result = processor->process(protocolFactory->getProtocol(requestBuffer),
+                protocolFactory->getProtocol(call->reply), NULL);
+    }
+    catch (TException& e)
+    {
+        error = e.what();
+    }
+
+    boost::mutex::scoped_lock lock(deadline_mutex);
+
+    call->result = result;
+    call->error = error;
+    call->done = true;
+
+    if (call->abandoned)
+    {
+        stuck--;
+        LOG("Abandoned request finished, %u still running", stuck);
+    }
+    else
+    {
+        deadlines.erase(call->position);
+    }
+
+    call->finished.notify_one();
+}
+
+void DeadlineProcessor::timeout(const string& request, boost::shared_ptr<TProtocol> out,
+        const TimeoutException& exception)
+{
+    boost::shared_ptr<TMemoryBuffer> requestBuffer(new TMemoryBuffer((uint8_t*) request.data(), request.size()));
+    boost::shared_ptr<TProtocol> iprot = protocolFactory->getProtocol(requestBuffer);
+    boost::shared_ptr<TProtocol> oprot = out;
+
+    // Answer with the protocol of the request, as the LaneProcessor does
+    if ((uint8_t) request[0] == COMPACT_PROTOCOL_ID)
+    {
+        iprot.reset(new TCompactProtocol(requestBuffer));
+        oprot.reset(new TCompactProtocol(out->getTransport()));
+    }
+
+    string fname;
+    TMessageType type;
+    int32_t seqid;
+    iprot->readMessageBegin(fname, type, seqid);
+
+    LOG("Timing out '%s' request: %s", fname.c_str(), exception.description.c_str());
+
+    if (stats != NULL)
+    {
+        stats->declaredError(fname);
+    }
+
+    // Oneway calls have no reply
+    if (type != T_ONEWAY)
+    {
+        writeDeclaredException(oprot.get(), fname, seqid, "timeout", TIMEOUT_FIELD_ID, exception);
+    }
+}
+
+bool DeadlineProcessor::process(boost::shared_ptr<TProtocol> in, boost::shared_ptr<TProtocol> out,
+        void* connectionContext)
+{
+    TTransport* transport = in->getTransport().get();
+    unsigned int deadline = defaultDeadline;
+    readDeadline(transport, deadline);
+
+    string request;
+    if (deadline == 0 || !readMessage(transport, request))
+    {
+        return processor->process(in, out, connectionContext);
+    }
+    transport->readEnd();
+
+    TimeoutException exception;
+    exception.timeoutMs = deadline;
+
+    boost::shared_ptr<DeadlineCall> call(new DeadlineCall());
+    call->request.swap(request);
+    call->reply.reset(new TMemoryBuffer());
+
+    {
+        boost::mutex::scoped_lock lock(deadline_mutex);
+
+        // Do not pile up more threads behind whatever is blocking the stuck ones
+        if (stuck >= maxStuck)
+        {
+            timedOut++;
+            lock.unlock();
+
+            exception.description = "Too many requests stuck, not even trying";
+            timeout(call->request, out, exception);
+            return true;
+        }
+    }
+
+    boost::system_time expiry = boost::get_system_time() + boost::posix_time::milliseconds(deadline);
+
+    boost::mutex::scoped_lock lock(deadline_mutex);
+
+    call->position = deadlines.insert(make_pair(expiry, call.get()));
+    if (call->position == deadlines.begin())
+    {
+        watchdog_condition.notify_one();
+    }
+
+    // A new runner only when all of them are busy (or stuck)
+    pending.push_back(call);
+    if (idleRunners < pending.size())
+    {
+        idleRunners++;
+        runners.create_thread(boost::bind(&DeadlineProcessor::runRunner, this));
+    }
+    pending_condition.notify_one();
+
+    while (!call->done && !call->abandoned)
+    {
+        call->finished.wait(lock);
+    }
+
+    if (!call->done)
+    {
+        lock.unlock();
+
+        exception.description = "Request not finished before its deadline, it may still complete";
+        timeout(call->request, out, exception);
+        return true;
+    }
+
+    lock.unlock();
+
+    if (!call->error.empty())
+    {
+        throw TException(call->error);
+    }
+
+    uint8_t* reply;
+    uint32_t length;
+    call->reply->getBuffer(&reply, &length);
+
+    if (length > 0)
+    {
+        out->getTransport()->write(reply, length);
+        out->getTransport()->writeEnd();
+        out->getTransport()->flush();
+    }
+
+    return call->result;
+}
+
+int64_t DeadlineProcessor::getWatchdogStats(int32_t& stuckCalls)
+{
+    boost::mutex::scoped_lock lock(deadline_mutex);
+
+    stuckCalls = stuck;
+    return timedOut;
+}
@@ -0,0 +1,152 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef DEADLINE_PROCESSOR_H
+#define DEADLINE_PROCESSOR_H
+
+#include <string>
+#include <map>
+#include <deque>
+
+#include <boost/thread.hpp>
+
+#include <thrift/TProcessor.h>
+#include <thrift/protocol/TProtocol.h>
+#include <thrift/transport/TTransport.h>
+#include <thrift/transport/TBufferTransports.h>
+
+#include <aim_types.h>
+
+#define DEFAULT_DEADLINE            0
+#define DEFAULT_MAX_STUCK_CALLS     16
+
+// First byte of a deadline header: followed by the deadline, in milliseconds, as a 32 bit big endian integer.
+// Thrift messages start with 0x80 or 0x82, and zlib streams with 0x78
+#define DEADLINE_HEADER             0xD1
+#define DEADLINE_HEADER_SIZE        5
+
+// Field id of the TimeoutException in the result of every method (see aim.thrift)
+#define TIMEOUT_FIELD_ID            98
+
+using namespace std;
+
+class RequestStats;
+struct DeadlineCall;
+
+/** Calls running, by deadline */
+typedef multimap<boost::system_time, DeadlineCall*> DeadlineQueue;
+
+/*
+ * Request run by a runner thread, shared with it so it can be abandoned
+ */
+struct DeadlineCall
+{
+    string request;
+    boost::shared_ptr< ::apache::thrift::transport::TMemoryBuffer> reply;
+
+    bool result;
+    string error;
+
+    bool done;
+    bool abandoned;
+    boost::condition_variable finished;
+
+    /** Position in the deadline queue while it is watched */
+    DeadlineQueue::iterator position;
+
+    DeadlineCall() : result(false), done(false), abandoned(false) {}
+};
+
+/*
+ * Processor that enforces a deadline on each request. A client sets the
+ * deadline of a request by sending a deadline header right before the
+ * message, otherwise the default one (if any) applies.
+ *
+ * Requests with a deadline run in a runner thread, from and to memory,
+ * while the server thread waits for them. Runners are kept and reused,
+ * and a single watchdog thread watches the deadlines of all the calls.
+ * When one expires the server thread answers with a TimeoutException and
+ * goes back to the pool. The abandoned call keeps its runner until
+ * libvirt (or whatever it is blocked on) returns, and its reply is
+ * discarded. Calls stuck this way are counted, and over maxStuck new
+ * requests time out right away.
+ */
+class DeadlineProcessor : public ::apache::thrift::TProcessor
+{
+    protected:
+        boost::shared_ptr< ::apache::thrift::TProcessor> processor;
+        boost::shared_ptr< ::apache::thrift::protocol::TProtocolFactory> protocolFactory;
+
+        /** Deadline of the requests without a deadline header, in milliseconds (0 for none) */
+        unsigned int defaultDeadline;
+        unsigned int maxStuck;
+
+        /** Requests answered with a TimeoutException, and abandoned calls still running */
+        int64_t timedOut;
+        unsigned int stuck;
+
+        /** Where the requests timed out are counted as errors */
+        RequestStats* stats;
+
+        /** Calls waiting for a runner, and calls running by deadline */
+        deque<boost::shared_ptr<DeadlineCall> > pending;
+        DeadlineQueue deadlines;
+
+        /** Runners waiting for a call */
+        unsigned int idleRunners;
+
+        boost::thread_group runners;
+        boost::thread watchdog;
+
+        boost::mutex deadline_mutex;
+        boost::condition_variable pending_condition;
+        boost::condition_variable watchdog_condition;
+
+        // Deadline header of the message, if any. Returns false when there is none
+        bool readDeadline(::apache::thrift::transport::TTransport* transport, unsigned int& deadline);
+
+        // Read the rest of the message. Returns false if the transport can not tell its size
+        bool readMessage(::apache::thrift::transport::TTransport* transport, string& _return);
+
+        void run(boost::shared_ptr<DeadlineCall> call);
+        void runRunner();
+        void runWatchdog();
+
+        void timeout(const string& request, boost::shared_ptr< ::apache::thrift::protocol::TProtocol> out,
+                const TimeoutException& exception);
+
+    public:
+        DeadlineProcessor(boost::shared_ptr< ::apache::thrift::TProcessor> processor,
+                boost::shared_ptr< ::apache::thrift::protocol::TProtocolFactory> protocolFactory,
+                int defaultDeadline, int maxStuck);
+        ~DeadlineProcessor();
+
+        virtual bool process(boost::shared_ptr< ::apache::thrift::protocol::TProtocol> in,
+                boost::shared_ptr< ::apache::thrift::protocol::TProtocol> out, void* connectionContext);
+
+        void setRequestStats(RequestStats* requestStats) { stats = requestStats; }
+
+        // Returns the number of requests timed out
+        int64_t getWatchdogStats(int32_t& stuckCalls);
+};
+
+#endif
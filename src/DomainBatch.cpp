@@ -0,0 +1,85 @@
+#include <DomainBatch.h>
+#include <Debug.h>
+
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+
+DomainBatch::DomainBatch(boost::function<void (const string&, DomainResult&)> operation, const vector<string>& domains,
+        vector<DomainResult>& results) :
+    operation(operation), domains(domains), results(results), next(0)
+{
+}
+
+void DomainBatch::work()
+{
+    while (true)
+    {
+        size_t index;
+        boost::posix_time::ptime start;
+
+        {
+            boost::mutex::scoped_lock lock(batch_mutex);
+
+            if (next >= domains.size())
+            {
+                return;
+            }
+
+            index = next++;
+            start = boost::posix_time::microsec_clock::universal_time();
+            start = (start < nextStart ? nextStart : start);
+            nextStart = start + stagger;
+        }
+
+        boost::this_thread::sleep(start);
+
+        DomainResult& result = results[index];
+        result.domainName = domains[index];
+        result.state = DomainState::UNKNOWN;
+
+        try
+        {
+            operation(domains[index], result);
+            result.success = true;
+        }
+        catch (LibvirtException& e)
+        {
+            result.success = false;
+            result.error = e;
+        }
+        catch (OverloadException& e)
+        {
+            result.success = false;
+            result.error.msg = e.description;
+        }
+        catch (std::exception& e)
+        {
+            result.success = false;
+            result.error.msg = e.what();
+        }
+
+        result.durationMs = (boost::posix_time::microsec_clock::universal_time() - start).total_microseconds() /
+            1000.0;
+    }
+}
+
+void DomainBatch::run(int parallelism, int staggerMs)
+{
+    results.clear();
+    results.resize(domains.size());
+
+    stagger = boost::posix_time::milliseconds(staggerMs > 0 ? staggerMs : 0);
+    nextStart = boost::posix_time::microsec_clock::universal_time();
+
+    int workers = (parallelism < (int) domains.size() ? parallelism : (int) domains.size());
+    boost::thread_group threads;
+
+    for (int i = 1; i < workers; i++)
+    {
+        threads.create_thread(boost::bind(&DomainBatch::work, this));
+    }
+
+    // The calling thread is a worker too
+    work();
+    threads.join_all();
+}
@@ -0,0 +1,73 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef DOMAIN_BATCH_H
+#define DOMAIN_BATCH_H
+
+#include <string>
+#include <vector>
+
+#include <boost/function.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <aim_types.h>
+
+#define DEFAULT_BATCH_PARALLELISM   8
+
+using namespace std;
+
+/*
+ * Runs an operation on a list of domains, a few at a time.
+ *
+ * Workers take the next domain of the list until it is done, optionally
+ * waiting so that two operations never start closer than the stagger
+ * (to spread boot storms). The result of each domain, with its error,
+ * is kept in its position of the list; the operation may fill in the rest
+ * of it (e.g. the final state of the domain).
+ */
+class DomainBatch : private boost::noncopyable
+{
+    protected:
+        boost::function<void (const string&, DomainResult&)> operation;
+        const vector<string>& domains;
+        vector<DomainResult>& results;
+
+        boost::posix_time::time_duration stagger;
+
+        /** Next domain to run, and earliest start of its operation */
+        size_t next;
+        boost::posix_time::ptime nextStart;
+
+        boost::mutex batch_mutex;
+
+        void work();
+
+    public:
+        DomainBatch(boost::function<void (const string&, DomainResult&)> operation, const vector<string>& domains,
+                vector<DomainResult>& results);
+
+        // Run the operation on every domain and wait for all of them
+        void run(int parallelism, int staggerMs);
+};
+
+#endif
@@ -0,0 +1,206 @@
+#include <DomainCache.h>
+
+DomainCache::DomainCache() : synchronized(false), sequence(0)
+{
+}
+
+DomainCache::~DomainCache()
+{
+}
+
+bool DomainCache::isSynchronized()
+{
+    boost::mutex::scoped_lock lock(cache_mutex);
+    return synchronized;
+}
+
+void DomainCache::setSynchronized(bool value)
+{
+    boost::mutex::scoped_lock lock(cache_mutex);
+    synchronized = value;
+}
+
+unsigned long DomainCache::getSequence()
+{
+    boost::mutex::scoped_lock lock(cache_mutex);
+    return sequence;
+}
+
+void DomainCache::touch(const string& uuid)
+{
+    changes[uuid] = ++sequence;
+}
+
+bool DomainCache::get(const string& uuid, DomainInfo& _return)
+{
+    boost::mutex::scoped_lock lock(cache_mutex);
+
+    if (!synchronized)
+    {
+        return false;
+    }
+
+    map<string, CachedDomain>::const_iterator it = domains.find(uuid);
+    if (it == domains.end())
+    {
+        return false;
+    }
+
+    _return = it->second.info;
+    return true;
+}
+
+bool DomainCache::getState(const string& uuid, DomainState::type& _return)
+{
+    boost::mutex::scoped_lock lock(cache_mutex);
+
+    if (!synchronized)
+    {
+        return false;
+    }
+
+    map<string, CachedDomain>::const_iterator it = domains.find(uuid);
+    if (it == domains.end())
+    {
+        return false;
+    }
+
+    _return = it->second.state;
+    return true;
+}
+
+bool DomainCache::getAll(vector<DomainInfo>& _return, const DomainFields::type fields)
+{
+    boost::mutex::scoped_lock lock(cache_mutex);
+
+    // Pending domains are not in the map, so the listing would be incomplete
+    if (!synchronized || !dirty.empty() || !refreshing.empty())
+    {
+        return false;
+    }
+
+    _return.reserve(_return.size() + domains.size());
+    for (map<string, CachedDomain>::const_iterator it = domains.begin(); it != domains.end(); ++it)
+    {
+        _return.push_back(project(it->second.info, fields));
+    }
+
+    return true;
+}
+
+void DomainCache::put(const CachedDomain& domain)
+{
+    boost::mutex::scoped_lock lock(cache_mutex);
+
+    // Changed again while it was being read, it will be refreshed later. Removed (undefined) while it was
+    // being read, it is no longer refreshing and must not come back
+    if (refreshing.count(domain.info.uuid) != 0 && dirty.count(domain.info.uuid) == 0)
+    {
+        domains[domain.info.uuid] = domain;
+    }
+
+    refreshing.erase(domain.info.uuid);
+}
+
+void DomainCache::remove(const string& uuid)
+{
+    boost::mutex::scoped_lock lock(cache_mutex);
+    domains.erase(uuid);
+    dirty.erase(uuid);
+    refreshing.erase(uuid);
+    touch(uuid);
+}
+
+void DomainCache::replace(const vector<CachedDomain>& all, unsigned long since)
+{
+    boost::mutex::scoped_lock lock(cache_mutex);
+
+    // Domains changed after the listing was started keep their current entry (if any)
+    map<string, CachedDomain> current;
+    for (map<string, CachedDomain>::const_iterator it = domains.begin(); it != domains.end(); ++it)
+    {
+        map<string, unsigned long>::const_iterator change = changes.find(it->first);
+        if (change != changes.end() && change->second > since)
+        {
+            current[it->first] = it->second;
+        }
+    }
+
+    for (vector<CachedDomain>::const_iterator it = all.begin(); it != all.end(); ++it)
+    {
+        const string& uuid = it->info.uuid;
+        map<string, unsigned long>::const_iterator change = changes.find(uuid);
+        bool outdated = (change != changes.end() && change->second > since);
+
+        if (!outdated && dirty.count(uuid) == 0 && refreshing.count(uuid) == 0)
+        {
+            current[uuid] = *it;
+        }
+    }
+
+    domains.swap(current);
+
+    // Older changes are already reflected in the new listing
+    map<string, unsigned long>::iterator it = changes.begin();
+    while (it != changes.end())
+    {
+        if (it->second <= since)
+        {
+            changes.erase(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void DomainCache::invalidate(const string& uuid)
+{
+    boost::mutex::scoped_lock lock(cache_mutex);
+    domains.erase(uuid);
+    dirty.insert(uuid);
+    touch(uuid);
+    dirty_condition.notify_one();
+}
+
+void DomainCache::takeDirty(set<string>& _return, const boost::posix_time::time_duration& timeout)
+{
+    boost::mutex::scoped_lock lock(cache_mutex);
+
+    if (dirty.empty())
+    {
+        dirty_condition.timed_wait(lock, timeout);
+    }
+
+    _return = dirty;
+    refreshing.insert(dirty.begin(), dirty.end());
+    dirty.clear();
+}
+
+void DomainCache::refreshDone()
+{
+    boost::mutex::scoped_lock lock(cache_mutex);
+    refreshing.clear();
+}
+
+DomainInfo DomainCache::project(const DomainInfo& info, const DomainFields::type fields)
+{
+    if (fields == DomainFields::FULL)
+    {
+        return info;
+    }
+
+    DomainInfo _return;
+    _return.name = info.name;
+    _return.uuid = info.uuid;
+    _return.state = info.state;
+
+    if (fields == DomainFields::RESOURCES)
+    {
+        _return.numberVirtCpu = info.numberVirtCpu;
+        _return.memory = info.memory;
+    }
+
+    return _return;
+}
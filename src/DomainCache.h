@@ -0,0 +1,107 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef DOMAIN_CACHE_H
+#define DOMAIN_CACHE_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <aim_types.h>
+
+using namespace std;
+
+/** Cached view of a domain: the info returned by getDomainInfo plus its plain libvirt state */
+struct CachedDomain
+{
+    DomainInfo info;
+    DomainState::type state;
+};
+
+/*
+ * In-memory copy of the domains defined in libvirt.
+ *
+ * Entries are invalidated by libvirt events (or by our own mutations) and
+ * re-read in the background. A domain is never served while it is pending
+ * a refresh, and nothing is served until the cache has been synchronized
+ * with a full listing, so callers fall back to libvirt on any miss.
+ */
+class DomainCache : private boost::noncopyable
+{
+    protected:
+        map<string, CachedDomain> domains;
+
+        /** Domains that changed and must be read again before being served */
+        set<string> dirty;
+
+        /** Domains being read by the refresher */
+        set<string> refreshing;
+
+        /** True while the cache is complete and kept current by events */
+        bool synchronized;
+
+        /** Sequence of the last change of each domain, used to discard outdated full listings */
+        unsigned long sequence;
+        map<string, unsigned long> changes;
+
+        void touch(const string& uuid);
+
+        boost::mutex cache_mutex;
+        boost::condition_variable dirty_condition;
+
+    public:
+        DomainCache();
+        ~DomainCache();
+
+        bool isSynchronized();
+        void setSynchronized(bool value);
+
+        // Current change sequence. Take it before reading a full listing to be given to replace()
+        unsigned long getSequence();
+
+        // Lookups. They return false if the cache can not answer and libvirt must be queried
+        bool get(const string& uuid, DomainInfo& _return);
+        bool getState(const string& uuid, DomainState::type& _return);
+        bool getAll(vector<DomainInfo>& _return, const DomainFields::type fields);
+
+        // Updates. Only domains being refreshed (see takeDirty) are put
+        void put(const CachedDomain& domain);
+        void remove(const string& uuid);
+        void replace(const vector<CachedDomain>& all, unsigned long since);
+        void invalidate(const string& uuid);
+
+        // Wait until some domain is invalidated (or the timeout expires) and take the pending ones
+        void takeDirty(set<string>& _return, const boost::posix_time::time_duration& timeout);
+
+        // Called once the taken domains have been read. The ones that could not be read are left out
+        void refreshDone();
+
+        // Copy of a full domain info with only the requested fields
+        static DomainInfo project(const DomainInfo& info, const DomainFields::type fields);
+};
+
+#endif
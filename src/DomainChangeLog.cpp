@@ -0,0 +1,83 @@
+#include <DomainChangeLog.h>
+#include <Debug.h>
+
+#include <sys/time.h>
+
+DomainChangeLog::DomainChangeLog() : size(DEFAULT_CHANGE_LOG_SIZE)
+{
+    // Start from the current time, so generations given by a previous run are always too old.
+    // Nothing is known until the first reset()
+    struct timeval now;
+    gettimeofday(&now, NULL);
+
+    generation = (int64_t) now.tv_sec * 1000 + now.tv_usec / 1000;
+    oldest = generation + 1;
+}
+
+DomainChangeLog::~DomainChangeLog()
+{
+}
+
+void DomainChangeLog::initialize(int maxSize)
+{
+    size = maxSize > 0 ? maxSize : DEFAULT_CHANGE_LOG_SIZE;
+    LOG("Domain change log size: %u", size);
+}
+
+int64_t DomainChangeLog::getGeneration()
+{
+    boost::mutex::scoped_lock lock(log_mutex);
+    return generation;
+}
+
+void DomainChangeLog::append(const string& uuid, const DomainChangeType::type type)
+{
+    boost::mutex::scoped_lock lock(log_mutex);
+
+    LoggedChange change;
+    change.generation = ++generation;
+    change.uuid = uuid;
+    change.type = type;
+    log.push_back(change);
+
+    if (log.size() > size)
+    {
+        oldest = log.front().generation;
+        log.pop_front();
+    }
+}
+
+void DomainChangeLog::reset()
+{
+    boost::mutex::scoped_lock lock(log_mutex);
+
+    log.clear();
+    oldest = ++generation;
+}
+
+bool DomainChangeLog::since(int64_t since, map<string, DomainChangeType::type>& _return, int64_t& current)
+{
+    boost::mutex::scoped_lock lock(log_mutex);
+
+    current = generation;
+    if (since < oldest || since > generation)
+    {
+        return false;
+    }
+
+    for (deque<LoggedChange>::const_iterator it = log.begin(); it != log.end(); ++it)
+    {
+        if (it->generation <= since)
+        {
+            continue;
+        }
+
+        map<string, DomainChangeType::type>::iterator found = _return.find(it->uuid);
+        if (found == _return.end() || found->second != DomainChangeType::ADDED || it->type == DomainChangeType::REMOVED)
+        {
+            _return[it->uuid] = it->type;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,84 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef DOMAIN_CHANGE_LOG_H
+#define DOMAIN_CHANGE_LOG_H
+
+#include <string>
+#include <deque>
+#include <map>
+
+#include <boost/thread/mutex.hpp>
+
+#include <aim_types.h>
+
+#define DEFAULT_CHANGE_LOG_SIZE     4096
+
+using namespace std;
+
+struct LoggedChange
+{
+    int64_t generation;
+    string uuid;
+    DomainChangeType::type type;
+};
+
+/*
+ * Bounded log of the domain changes notified by libvirt events.
+ *
+ * Each change gets the next generation. Callers keep the generation they
+ * were given and later ask for the changes after it. When those are no
+ * longer known (the log wrapped, events were lost or AIM was restarted)
+ * they must read all the domains again.
+ */
+class DomainChangeLog : private boost::noncopyable
+{
+    protected:
+        deque<LoggedChange> log;
+        unsigned int size;
+
+        /** Generation of the last change */
+        int64_t generation;
+
+        /** Changes after this generation are all in the log */
+        int64_t oldest;
+
+        boost::mutex log_mutex;
+
+    public:
+        DomainChangeLog();
+        ~DomainChangeLog();
+
+        void initialize(int maxSize);
+
+        int64_t getGeneration();
+
+        void append(const string& uuid, const DomainChangeType::type type);
+
+        // Forget all the changes. Called when events may have been lost
+        void reset();
+
+        // Domains changed after the given generation, with the generation they are current to. Returns
+        // false if some of them are unknown. A domain both added and changed is reported as ADDED
+        bool since(int64_t since, map<string, DomainChangeType::type>& _return, int64_t& current);
+};
+
+#endif
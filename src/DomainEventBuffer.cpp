@@ -0,0 +1,109 @@
+#include <DomainEventBuffer.h>
+#include <Debug.h>
+
+#include <sys/time.h>
+
+static int64_t currentTimeMillis()
+{
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return (int64_t) now.tv_sec * 1000 + now.tv_usec / 1000;
+}
+
+DomainEventBuffer::DomainEventBuffer() : size(DEFAULT_EVENT_BUFFER_SIZE), next(0), count(0)
+{
+    // Start from the current time, so ids given by a previous run are always too old.
+    // Nothing is known until the first reset()
+    lastId = currentTimeMillis();
+    oldest = lastId + 1;
+    events.resize(size);
+}
+
+DomainEventBuffer::~DomainEventBuffer()
+{
+}
+
+void DomainEventBuffer::initialize(int maxSize)
+{
+    boost::mutex::scoped_lock lock(buffer_mutex);
+
+    size = maxSize > 0 ? maxSize : DEFAULT_EVENT_BUFFER_SIZE;
+    events.clear();
+    events.resize(size);
+    next = 0;
+    count = 0;
+
+    LOG("Domain event buffer size: %u", size);
+}
+
+void DomainEventBuffer::push(DomainEvent& event)
+{
+    boost::mutex::scoped_lock lock(buffer_mutex);
+
+    event.id = ++lastId;
+    event.timestamp = currentTimeMillis();
+
+    if (count == size)
+    {
+        // Overwrite the oldest one
+        oldest = events[next].id;
+    }
+    else
+    {
+        count++;
+    }
+
+    events[next] = event;
+    next = (next + 1) % size;
+
+    buffer_condition.notify_all();
+}
+
+void DomainEventBuffer::reset()
+{
+    boost::mutex::scoped_lock lock(buffer_mutex);
+
+    next = 0;
+    count = 0;
+    oldest = ++lastId;
+
+    buffer_condition.notify_all();
+}
+
+void DomainEventBuffer::wait(int64_t sinceId, const boost::posix_time::time_duration& timeout, DomainEvents& _return)
+{
+    boost::mutex::scoped_lock lock(buffer_mutex);
+
+    bool fromNow = (sinceId < 0);
+    if (fromNow)
+    {
+        sinceId = lastId;
+    }
+
+    boost::system_time deadline = boost::get_system_time() + timeout;
+    while (lastId == sinceId)
+    {
+        if (!buffer_condition.timed_wait(lock, deadline))
+        {
+            break;
+        }
+    }
+
+    _return.lastId = lastId;
+    _return.lost = (sinceId < oldest || sinceId > lastId) && !(fromNow && lastId == sinceId);
+
+    if (_return.lost)
+    {
+        sinceId = oldest;
+    }
+
+    unsigned int first = (next + size - count) % size;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        const DomainEvent& event = events[(first + i) % size];
+        if (event.id > sinceId)
+        {
+            _return.events.push_back(event);
+        }
+    }
+}
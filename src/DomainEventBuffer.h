@@ -0,0 +1,79 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef DOMAIN_EVENT_BUFFER_H
+#define DOMAIN_EVENT_BUFFER_H
+
+#include <vector>
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <aim_types.h>
+
+#define DEFAULT_EVENT_BUFFER_SIZE   1024
+
+using namespace std;
+
+/*
+ * Ring buffer with the last domain events notified by libvirt.
+ *
+ * Events get consecutive ids. Callers wait for the events after the last one
+ * they received; if some of them were overwritten (or lost while libvirt was
+ * unreachable) they are told so and get all the events still buffered.
+ */
+class DomainEventBuffer : private boost::noncopyable
+{
+    protected:
+        vector<DomainEvent> events;
+        unsigned int size;
+
+        /** Position of the next event to write, and number of events written */
+        unsigned int next;
+        unsigned int count;
+
+        /** Id of the last event */
+        int64_t lastId;
+
+        /** Events after this id are all in the buffer */
+        int64_t oldest;
+
+        boost::mutex buffer_mutex;
+        boost::condition_variable buffer_condition;
+
+    public:
+        DomainEventBuffer();
+        ~DomainEventBuffer();
+
+        void initialize(int maxSize);
+
+        // Store an event (its id and timestamp are set here) and wake up the waiting callers
+        void push(DomainEvent& event);
+
+        // Forget all the events. Called when events may have been lost
+        void reset();
+
+        // Events after sinceId (-1 for the next ones), waiting up to timeout if there are none
+        void wait(int64_t sinceId, const boost::posix_time::time_duration& timeout, DomainEvents& _return);
+};
+
+#endif
@@ -0,0 +1,129 @@
+#include <DomainLocks.h>
+#include <Debug.h>
+
+DomainLocks::DomainLocks() : maxWait(0), acquired(0), contended(0), held(0), waitMicros(0), maxWaitMicros(0)
+{
+}
+
+DomainLocks::~DomainLocks()
+{
+}
+
+void DomainLocks::setMaxWait(int maxWaitMs)
+{
+    maxWait = maxWaitMs > 0 ? maxWaitMs : 0;
+}
+
+DomainLocks::Stripe& DomainLocks::getStripe(const string& uuid)
+{
+    unsigned int hash = 5381;
+    for (string::const_iterator c = uuid.begin(); c != uuid.end(); ++c)
+    {
+        hash = hash * 33 + (unsigned char) *c;
+    }
+
+    return stripes[hash % DOMAIN_LOCK_STRIPES];
+}
+
+void DomainLocks::recordWait(uint64_t micros)
+{
+    __sync_fetch_and_add(&contended, 1);
+    __sync_fetch_and_add(&waitMicros, micros);
+
+    uint64_t max = maxWaitMicros;
+    while (micros > max)
+    {
+        uint64_t previous = __sync_val_compare_and_swap(&maxWaitMicros, max, micros);
+        if (previous == max)
+        {
+            break;
+        }
+        max = previous;
+    }
+}
+
+void DomainLocks::lock(const string& uuid)
+{
+    Stripe& stripe = getStripe(uuid);
+    boost::mutex::scoped_lock lock(stripe.mutex);
+
+    Tickets& tickets = stripe.domains[uuid];
+    unsigned long ticket = tickets.next++;
+
+    if (tickets.serving != ticket)
+    {
+        boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+        boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(maxWait);
+
+        // Map entries keep their address while the domain is locked
+        while (tickets.serving != ticket)
+        {
+            if (maxWait == 0)
+            {
+                stripe.condition.wait(lock);
+            }
+            else if (!stripe.condition.timed_wait(lock, deadline) && tickets.serving != ticket)
+            {
+                // The holder ahead skips it, so the entry lives until then
+                tickets.abandoned.insert(ticket);
+                recordWait((boost::posix_time::microsec_clock::universal_time() - start).total_microseconds());
+
+                OverloadException overload;
+                overload.lane = "mutation";
+                overload.retryAfterMs = maxWait;
+                overload.description = "Domain '" + uuid + "' is busy with another operation, try again later";
+
+                LOG("Rejecting operation on domain '%s': it has been locked for more than %u ms", uuid.c_str(),
+                        maxWait);
+                throw overload;
+            }
+        }
+
+        recordWait((boost::posix_time::microsec_clock::universal_time() - start).total_microseconds());
+    }
+
+    __sync_fetch_and_add(&acquired, 1);
+    __sync_fetch_and_add(&held, 1);
+}
+
+void DomainLocks::unlock(const string& uuid)
+{
+    Stripe& stripe = getStripe(uuid);
+    boost::mutex::scoped_lock lock(stripe.mutex);
+
+    map<string, Tickets>::iterator it = stripe.domains.find(uuid);
+    if (it == stripe.domains.end())
+    {
+        LOG("Unlocking domain '%s', which is not locked", uuid.c_str());
+        return;
+    }
+
+    __sync_fetch_and_sub(&held, 1);
+
+    Tickets& tickets = it->second;
+    tickets.serving++;
+
+    while (tickets.abandoned.erase(tickets.serving) != 0)
+    {
+        tickets.serving++;
+    }
+
+    if (tickets.serving == tickets.next)
+    {
+        stripe.domains.erase(it);
+    }
+    else
+    {
+        // Waiters of every domain of the stripe share the condition, only the next ticket goes on
+        stripe.condition.notify_all();
+    }
+}
+
+void DomainLocks::getStats(DomainLockStats& _return)
+{
+    _return.acquired = acquired;
+    _return.contended = contended;
+    _return.waitMs = waitMicros / 1000.0;
+    _return.maxWaitMs = maxWaitMicros / 1000.0;
+    _return.held = held;
+}
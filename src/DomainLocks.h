@@ -0,0 +1,137 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef DOMAIN_LOCKS_H
+#define DOMAIN_LOCKS_H
+
+#include <string>
+#include <map>
+#include <set>
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/thread_time.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <aim_types.h>
+
+// Stripes of the lock table. Domains in the same stripe only share its (short) bookkeeping
+#define DOMAIN_LOCK_STRIPES     64
+
+using namespace std;
+
+/*
+ * Per domain locks for the libvirt mutations.
+ *
+ * Domains are spread in stripes, each one with the tickets of the domains
+ * locked in it. Operations on the same domain run one at a time, in the
+ * order they asked for the lock, and operations on different domains run
+ * in parallel. Entries only exist while a domain is locked. Operations
+ * wait for the lock up to the maximum wait of the mutation lane, as they
+ * already hold a lane slot, and then fail with an OverloadException;
+ * their ticket is skipped when its turn comes.
+ *
+ * Ordering: the lock of a domain is always taken before a libvirt
+ * connection, never while holding one, and a holder only keeps a connection
+ * for the duration of its libvirt calls (long waits, as the shutdowns with
+ * deadline, give it back in between). The stripe mutex is only held for the
+ * bookkeeping, so a domain locked for long only delays its own operations
+ * (and for no longer than the maximum wait), never the pool or the other
+ * domains of the stripe.
+ */
+class DomainLocks : private boost::noncopyable
+{
+    protected:
+        struct Tickets
+        {
+            unsigned long next;
+            unsigned long serving;
+
+            /** Tickets whose holders gave up waiting */
+            set<unsigned long> abandoned;
+
+            Tickets() : next(0), serving(0) {}
+        };
+
+        struct Stripe
+        {
+            map<string, Tickets> domains;
+            boost::mutex mutex;
+            boost::condition_variable condition;
+        };
+
+        Stripe stripes[DOMAIN_LOCK_STRIPES];
+
+        /** Milliseconds to wait for a lock (0 waits forever) */
+        unsigned int maxWait;
+
+        /** Counters, only updated with atomic operations */
+        volatile int64_t acquired;
+        volatile int64_t contended;
+        volatile int64_t held;
+        volatile uint64_t waitMicros;
+        volatile uint64_t maxWaitMicros;
+
+        Stripe& getStripe(const string& uuid);
+        void recordWait(uint64_t micros);
+
+    public:
+        DomainLocks();
+        ~DomainLocks();
+
+        void setMaxWait(int maxWaitMs);
+
+        // Wait for the lock of the domain. Throws an OverloadException when it takes longer than the maximum wait
+        void lock(const string& uuid);
+        void unlock(const string& uuid);
+
+        void getStats(DomainLockStats& _return);
+};
+
+/*
+ * Holds the lock of a domain while in scope. An empty UUID locks nothing
+ */
+class DomainLock : private boost::noncopyable
+{
+    protected:
+        DomainLocks& locks;
+        string uuid;
+
+    public:
+        DomainLock(DomainLocks& locks, const string& uuid) : locks(locks), uuid(uuid)
+        {
+            if (!uuid.empty())
+            {
+                locks.lock(uuid);
+            }
+        }
+
+        ~DomainLock()
+        {
+            if (!uuid.empty())
+            {
+                locks.unlock(uuid);
+            }
+        }
+};
+
+#endif
@@ -1,7 +1,11 @@
 #include <ExecUtils.h>
 #include <Debug.h>
 #include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
 #include <cstdlib>
+#include <sstream>
 
 bool commandExist(string& command)
 {
@@ -22,6 +26,50 @@ int executeCommand(string command, bool redirect)
     return WEXITSTATUS(status);
 }
 
+int executeProgram(const vector<string>& args, bool redirect)
+{
+    ostringstream command;
+    vector<char*> argv;
+
+    for (vector<string>::const_iterator it = args.begin(); it != args.end(); ++it)
+    {
+        command << (it == args.begin() ? "" : " ") << *it;
+        argv.push_back(const_cast<char*>(it->c_str()));
+    }
+    argv.push_back(NULL);
+
+    LOG("Executing '%s'", command.str().c_str());
+
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        return 127;
+    }
+
+    if (pid == 0)
+    {
+        if (redirect)
+        {
+            int null = open("/dev/null", O_WRONLY);
+            dup2(null, STDOUT_FILENO);
+        }
+
+        execvp(argv[0], &argv[0]);
+        _exit(127);
+    }
+
+    int status;
+    while (waitpid(pid, &status, 0) < 0)
+    {
+        if (errno != EINTR)
+        {
+            return 127;
+        }
+    }
+
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 127;
+}
+
 std::string exec(std::string cmd)
 {
     LOG("Executing: '%s'", cmd.c_str());
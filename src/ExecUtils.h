@@ -23,10 +23,15 @@
 #define EXEC_UTILS_H
 
 #include <string>
+#include <vector>
 
 using namespace std;
 
 int executeCommand(string command, bool redirect = false);
+
+// Run a program with its arguments (args[0] is the program), without a shell. Returns its exit status,
+// 127 if it can not be run
+int executeProgram(const vector<string>& args, bool redirect = false);
 bool commandExist(string& command);
 std::string exec(std::string cmd);
 
@@ -0,0 +1,313 @@
+#include <LaneProcessor.h>
+#include <RequestStats.h>
+#include <Debug.h>
+
+#include <thrift/protocol/TCompactProtocol.h>
+
+using namespace ::apache::thrift;
+using namespace ::apache::thrift::protocol;
+using namespace ::apache::thrift::transport;
+
+Lane::Lane() : threads(1), queue(0), maxWait(0), running(0), waiting(0), rejected(0), expired(0), averageMs(0)
+{
+}
+
+void Lane::configure(const string& laneName, int maxThreads, int maxQueue, int maxWaitMs)
+{
+    name = laneName;
+    threads = maxThreads > 0 ? maxThreads : 1;
+    queue = maxQueue >= 0 ? maxQueue : 0;
+    maxWait = maxWaitMs >= 0 ? maxWaitMs : 0;
+
+    LOG("Lane '%s': %u threads, %u queued requests, %u ms maximum wait", name.c_str(), threads, queue, maxWait);
+}
+
+Lane::Admission Lane::enter()
+{
+    boost::mutex::scoped_lock lock(lane_mutex);
+
+    if (running >= threads)
+    {
+        if (waiting >= queue)
+        {
+            rejected++;
+            return QUEUE_FULL;
+        }
+
+        boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(maxWait);
+
+        waiting++;
+        while (running >= threads)
+        {
+            if (maxWait == 0)
+            {
+                lane_condition.wait(lock);
+            }
+            else if (!lane_condition.timed_wait(lock, deadline) && running >= threads)
+            {
+                waiting--;
+                expired++;
+                return WAIT_EXPIRED;
+            }
+        }
+        waiting--;
+    }
+
+    running++;
+    return ADMITTED;
+}
+
+void Lane::leave(const boost::posix_time::time_duration& elapsed)
+{
+    boost::mutex::scoped_lock lock(lane_mutex);
+    running--;
+    averageMs = 0.9 * averageMs + 0.1 * elapsed.total_milliseconds();
+    lane_condition.notify_one();
+}
+
+int Lane::getRetryAfter()
+{
+    boost::mutex::scoped_lock lock(lane_mutex);
+
+    // Time to drain the requests already waiting, plus this one
+    double retryAfter = averageMs * (waiting + 1) / threads;
+
+    if (retryAfter < MIN_RETRY_AFTER_MS)
+    {
+        return MIN_RETRY_AFTER_MS;
+    }
+
+    return retryAfter > MAX_RETRY_AFTER_MS ? MAX_RETRY_AFTER_MS : (int) retryAfter;
+}
+
+void Lane::getStats(LaneStats& _return)
+{
+    boost::mutex::scoped_lock lock(lane_mutex);
+
+    _return.name = name;
+    _return.threads = threads;
+    _return.running = running;
+    _return.queued = waiting;
+    _return.rejected = rejected;
+    _return.expired = expired;
+}
+
+// Leaves the lane when the request is done, even if it throws
+class LaneSlot
+{
+    protected:
+        Lane* lane;
+        boost::posix_time::ptime start;
+
+    public:
+        LaneSlot(Lane* lane) : lane(lane), start(boost::posix_time::microsec_clock::universal_time()) {}
+        ~LaneSlot() { lane->leave(boost::posix_time::microsec_clock::universal_time() - start); }
+};
+
+// The watched protocol belongs to the server, the watcher only borrows it
+static void keepProtocol(TProtocol* protocol)
+{
+}
+
+ReplyWatcher::ReplyWatcher(TProtocol* oprot) :
+    TProtocolDecorator(boost::shared_ptr<TProtocol>(oprot, keepProtocol)), reply(false), depth(0), exception(false)
+{
+}
+
+uint32_t ReplyWatcher::writeMessageBegin_virt(const std::string& name, const TMessageType messageType,
+        const int32_t seqid)
+{
+    reply = (messageType == T_REPLY);
+    return TProtocolDecorator::writeMessageBegin_virt(name, messageType, seqid);
+}
+
+uint32_t ReplyWatcher::writeStructBegin_virt(const char* name)
+{
+    depth++;
+    return TProtocolDecorator::writeStructBegin_virt(name);
+}
+
+uint32_t ReplyWatcher::writeStructEnd_virt()
+{
+    depth--;
+    return TProtocolDecorator::writeStructEnd_virt();
+}
+
+uint32_t ReplyWatcher::writeFieldBegin_virt(const char* name, const TType fieldType, const int16_t fieldId)
+{
+    // Only the first field of the result is set
+    if (reply && depth == 1 && fieldId != 0)
+    {
+        exception = true;
+    }
+
+    return TProtocolDecorator::writeFieldBegin_virt(name, fieldType, fieldId);
+}
+
+LaneProcessor::LaneProcessor(boost::shared_ptr<AimIf> iface) : AimProcessor(iface), detectProtocol(false), stats(NULL)
+{
+    const char* mutations[] = { "defineDomain", "undefineDomain", "powerOn", "powerOff", "shutdown", "reset", "pause",
+        "resume", "createISCSIStoragePool", "createNFSStoragePool", "createDirStoragePool", "deleteDisk", "resizeVol",
+        "createVLAN", "deleteVLAN", "startCopyFromRepositoryToDatastore", "startCopyFromDatastoreToRepository",
+        "startCopy", "cancelJob", "abortUpload", NULL };
+
+    const char* bulkio[] = { "copyFromRepositoryToDatastore", "copyFromDatastoreToRepository",
+        "deleteVirtualImageFromDatastore", "instanceDisk", "renameDisk", "rescanISCSI", "createDisk", "resizeDisk",
+        "upload", "openUpload", "writeChunk", "commitUpload", "readChunk", "powerOnMany", "powerOffMany",
+        "shutdownMany", "resetMany", "pauseMany", "resumeMany", NULL };
+
+    for (int i = 0; mutations[i] != NULL; i++)
+    {
+        lanes[mutations[i]] = &mutation;
+    }
+
+    for (int i = 0; bulkio[i] != NULL; i++)
+    {
+        lanes[bulkio[i]] = &bulk;
+    }
+
+    lanes["waitForEvents"] = &events;
+
+    // They can wait for the guests for up to an hour, away from the data transfers
+    lanes["shutdownWithDeadline"] = &shutdowns;
+    lanes["shutdownManyWithDeadline"] = &shutdowns;
+
+    // Never rejected, it must answer while the server is overloaded
+    lanes["getServerStats"] = NULL;
+}
+
+void LaneProcessor::initialize(INIReader& configuration, int queryThreads)
+{
+    query.configure("query", configuration.GetInteger("server", "queryThreads", queryThreads),
+            configuration.GetInteger("server", "queryQueue", DEFAULT_QUERY_QUEUE),
+            configuration.GetInteger("server", "queryMaxWait", DEFAULT_QUERY_MAX_WAIT));
+    mutation.configure("mutation", configuration.GetInteger("server", "mutationThreads", DEFAULT_MUTATION_THREADS),
+            configuration.GetInteger("server", "mutationQueue", DEFAULT_MUTATION_QUEUE),
+            configuration.GetInteger("server", "mutationMaxWait", DEFAULT_MUTATION_MAX_WAIT));
+    bulk.configure("bulk", configuration.GetInteger("server", "bulkThreads", DEFAULT_BULK_THREADS),
+            configuration.GetInteger("server", "bulkQueue", DEFAULT_BULK_QUEUE),
+            configuration.GetInteger("server", "bulkMaxWait", DEFAULT_BULK_MAX_WAIT));
+    events.configure("events", configuration.GetInteger("server", "eventThreads", DEFAULT_EVENT_THREADS),
+            configuration.GetInteger("server", "eventQueue", DEFAULT_EVENT_QUEUE),
+            configuration.GetInteger("server", "eventMaxWait", DEFAULT_EVENT_MAX_WAIT));
+    shutdowns.configure("shutdown", configuration.GetInteger("server", "shutdownThreads", DEFAULT_SHUTDOWN_THREADS),
+            configuration.GetInteger("server", "shutdownQueue", DEFAULT_SHUTDOWN_QUEUE),
+            configuration.GetInteger("server", "shutdownMaxWait", DEFAULT_SHUTDOWN_MAX_WAIT));
+}
+
+unsigned int LaneProcessor::getThreads()
+{
+    // Waiting requests hold a server thread too
+    return query.getCapacity() + mutation.getCapacity() + bulk.getCapacity() + events.getCapacity() +
+        shutdowns.getCapacity() + SPARE_THREADS;
+}
+
+int64_t LaneProcessor::getLaneStats(vector<LaneStats>& _return)
+{
+    Lane* all[] = { &query, &mutation, &bulk, &events, &shutdowns };
+    int64_t shed = 0;
+
+    for (int i = 0; i < 5; i++)
+    {
+        LaneStats stats;
+        all[i]->getStats(stats);
+        _return.push_back(stats);
+        shed += stats.rejected + stats.expired;
+    }
+
+    return shed;
+}
+
+Lane* LaneProcessor::getLane(const std::string& fname)
+{
+    map<string, Lane*>::const_iterator it = lanes.find(fname);
+    return it == lanes.end() ? &query : it->second;
+}
+
+bool LaneProcessor::isCompact(TTransport* transport)
+{
+    // Peek the first byte of the message without consuming it
+    uint32_t length = 1;
+    const uint8_t* first = transport->borrow(NULL, &length);
+
+    return first != NULL && first[0] == COMPACT_PROTOCOL_ID;
+}
+
+bool LaneProcessor::process(boost::shared_ptr<TProtocol> in, boost::shared_ptr<TProtocol> out,
+        void* connectionContext)
+{
+    if (detectProtocol && isCompact(in->getTransport().get()))
+    {
+        boost::shared_ptr<TProtocol> compactIn(new TCompactProtocol(in->getTransport()));
+        boost::shared_ptr<TProtocol> compactOut(new TCompactProtocol(out->getTransport()));
+
+        return AimProcessor::process(compactIn, compactOut, connectionContext);
+    }
+
+    return AimProcessor::process(in, out, connectionContext);
+}
+
+void LaneProcessor::reject(TProtocol* iprot, TProtocol* oprot, const std::string& fname, int32_t seqid,
+        const OverloadException& overload)
+{
+    iprot->skip(T_STRUCT);
+    iprot->readMessageEnd();
+    iprot->getTransport()->readEnd();
+
+    writeDeclaredException(oprot, fname, seqid, "overload", OVERLOAD_FIELD_ID, overload);
+}
+
+bool LaneProcessor::dispatchWatched(TProtocol* iprot, TProtocol* oprot, const std::string& fname, int32_t seqid,
+        void* callContext)
+{
+    if (stats == NULL)
+    {
+        return AimProcessor::dispatchCall(iprot, oprot, fname, seqid, callContext);
+    }
+
+    // Declared exceptions are written in the result, the event handler only hears of the undeclared ones
+    ReplyWatcher watcher(oprot);
+    bool result = AimProcessor::dispatchCall(iprot, &watcher, fname, seqid, callContext);
+
+    if (watcher.isDeclaredException())
+    {
+        stats->declaredError(fname);
+    }
+
+    return result;
+}
+
+bool LaneProcessor::dispatchCall(TProtocol* iprot, TProtocol* oprot, const std::string& fname, int32_t seqid,
+        void* callContext)
+{
+    Lane* lane = getLane(fname);
+
+    if (lane == NULL)
+    {
+        return dispatchWatched(iprot, oprot, fname, seqid, callContext);
+    }
+
+    Lane::Admission admission = lane->enter();
+
+    if (admission != Lane::ADMITTED)
+    {
+        OverloadException overload;
+        overload.lane = lane->getName();
+        overload.retryAfterMs = lane->getRetryAfter();
+        overload.description = (admission == Lane::QUEUE_FULL ?
+                "Too many '" + lane->getName() + "' requests in progress, try again later" :
+                "Timed out waiting for a free '" + lane->getName() + "' thread, try again later");
+
+        LOG("Rejecting '%s' request: %s", fname.c_str(), overload.description.c_str());
+
+        reject(iprot, oprot, fname, seqid, overload);
+        if (stats != NULL)
+        {
+            stats->declaredError(fname);
+        }
+        return true;
+    }
+
+    LaneSlot slot(lane);
+    return dispatchWatched(iprot, oprot, fname, seqid, callContext);
+}
@@ -0,0 +1,221 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef LANE_PROCESSOR_H
+#define LANE_PROCESSOR_H
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <thrift/protocol/TProtocolDecorator.h>
+
+#include <INIReader.h>
+#include <Aim.h>
+
+#define DEFAULT_QUERY_QUEUE         16
+#define DEFAULT_MUTATION_THREADS    4
+#define DEFAULT_MUTATION_QUEUE      16
+#define DEFAULT_BULK_THREADS        2
+#define DEFAULT_BULK_QUEUE          8
+#define DEFAULT_EVENT_THREADS       2
+#define DEFAULT_EVENT_QUEUE         0
+#define DEFAULT_SHUTDOWN_THREADS    4
+#define DEFAULT_SHUTDOWN_QUEUE      16
+
+#define DEFAULT_QUERY_MAX_WAIT      2000
+#define DEFAULT_MUTATION_MAX_WAIT   10000
+#define DEFAULT_BULK_MAX_WAIT       60000
+#define DEFAULT_EVENT_MAX_WAIT      0
+#define DEFAULT_SHUTDOWN_MAX_WAIT   60000
+
+// Bounds of the retry hint given to rejected requests, in milliseconds
+#define MIN_RETRY_AFTER_MS          100
+#define MAX_RETRY_AFTER_MS          30000
+
+// Server threads kept out of the lanes, so requests can be rejected (and stats read) with every lane full
+#define SPARE_THREADS               2
+
+// Field id of the OverloadException in the result of every method (see aim.thrift)
+#define OVERLOAD_FIELD_ID           99
+
+// First byte of the messages encoded with the compact protocol (binary ones start with 0x80)
+#define COMPACT_PROTOCOL_ID         0x82
+
+using namespace std;
+
+class RequestStats;
+
+// Write the reply of a method that threw one of its declared exceptions, as its result struct would
+template <class E>
+void writeDeclaredException(::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid,
+        const char* field, int16_t fieldId, const E& exception)
+{
+    oprot->writeMessageBegin(fname, ::apache::thrift::protocol::T_REPLY, seqid);
+    oprot->writeStructBegin("result");
+    oprot->writeFieldBegin(field, ::apache::thrift::protocol::T_STRUCT, fieldId);
+    exception.write(oprot);
+    oprot->writeFieldEnd();
+    oprot->writeFieldStop();
+    oprot->writeStructEnd();
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+}
+
+/*
+ * Protocol that writes through another one and tells whether the reply was
+ * a declared exception: the first field of the result is 0 for the value
+ * returned, and the id of the exception otherwise.
+ */
+class ReplyWatcher : public ::apache::thrift::protocol::TProtocolDecorator
+{
+    protected:
+        bool reply;
+        int depth;
+        bool exception;
+
+    public:
+        ReplyWatcher(::apache::thrift::protocol::TProtocol* oprot);
+
+        bool isDeclaredException() { return exception; }
+
+        virtual uint32_t writeMessageBegin_virt(const std::string& name,
+                const ::apache::thrift::protocol::TMessageType messageType, const int32_t seqid);
+        virtual uint32_t writeStructBegin_virt(const char* name);
+        virtual uint32_t writeStructEnd_virt();
+        virtual uint32_t writeFieldBegin_virt(const char* name, const ::apache::thrift::protocol::TType fieldType,
+                const int16_t fieldId);
+};
+
+/*
+ * Bounded set of requests running at the same time. Requests over the
+ * limit wait for a free slot, and are rejected if too many are waiting
+ * or if they wait for too long.
+ */
+class Lane : private boost::noncopyable
+{
+    protected:
+        string name;
+        unsigned int threads;
+        unsigned int queue;
+
+        /** Maximum time a request waits for a slot, in milliseconds (0 waits forever) */
+        unsigned int maxWait;
+
+        unsigned int running;
+        unsigned int waiting;
+
+        /** Requests rejected because the queue was full, and because they waited too long */
+        int64_t rejected;
+        int64_t expired;
+
+        /** Moving average of the time requests hold their slot, in milliseconds */
+        double averageMs;
+
+        boost::mutex lane_mutex;
+        boost::condition_variable lane_condition;
+
+    public:
+        enum Admission { ADMITTED, QUEUE_FULL, WAIT_EXPIRED };
+
+        Lane();
+
+        void configure(const string& laneName, int maxThreads, int maxQueue, int maxWaitMs);
+
+        const string& getName() { return name; }
+
+        // Maximum number of requests in the lane, running or waiting
+        unsigned int getCapacity() { return threads + queue; }
+
+        // Take a slot, waiting for it if needed
+        Admission enter();
+        void leave(const boost::posix_time::time_duration& elapsed);
+
+        // Suggested time to wait before retrying a rejected request, in milliseconds
+        int getRetryAfter();
+
+        void getStats(LaneStats& _return);
+};
+
+/*
+ * Aim processor that runs each method in a lane depending on its cost:
+ * queries, libvirt mutations, bulk I/O (disk copies, iSCSI rescans), event
+ * waits and shutdowns with deadline, which mostly wait for the guests. Each
+ * lane has its own limits, so a burst of slow requests can not take all the
+ * server threads.
+ */
+class LaneProcessor : public AimProcessor
+{
+    protected:
+        Lane query;
+        Lane mutation;
+        Lane bulk;
+        Lane events;
+        Lane shutdowns;
+
+        /** Lane of each method. Methods not listed are queries */
+        map<string, Lane*> lanes;
+
+        /** Whether to answer compact requests with the compact protocol, whatever the server protocol is */
+        bool detectProtocol;
+
+        /** Where the declared exceptions and the rejected requests are counted */
+        RequestStats* stats;
+
+        bool isCompact(::apache::thrift::transport::TTransport* transport);
+
+        Lane* getLane(const std::string& fname);
+
+        void reject(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot,
+                const std::string& fname, int32_t seqid, const OverloadException& overload);
+
+        // Run the method, counting its declared exceptions
+        bool dispatchWatched(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot,
+                const std::string& fname, int32_t seqid, void* callContext);
+
+        virtual bool dispatchCall(::apache::thrift::protocol::TProtocol* iprot,
+                ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext);
+
+    public:
+        LaneProcessor(boost::shared_ptr<AimIf> iface);
+
+        void initialize(INIReader& configuration, int queryThreads);
+
+        void setProtocolDetection(bool enabled) { detectProtocol = enabled; }
+
+        void setRequestStats(RequestStats* requestStats) { stats = requestStats; }
+
+        virtual bool process(boost::shared_ptr< ::apache::thrift::protocol::TProtocol> in,
+                boost::shared_ptr< ::apache::thrift::protocol::TProtocol> out, void* connectionContext);
+
+        // Number of server threads needed to run every lane at full capacity
+        unsigned int getThreads();
+
+        // Stats of every lane. Returns the number of requests shed
+        int64_t getLaneStats(vector<LaneStats>& _return);
+};
+
+#endif
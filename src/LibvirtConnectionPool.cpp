@@ -0,0 +1,149 @@
+#include <LibvirtConnectionPool.h>
+
+LibvirtConnectionPool::LibvirtConnectionPool() :
+    readOnly(false), size(DEFAULT_POOL_SIZE), waitMs(DEFAULT_POOL_WAIT), keepAliveInterval(DEFAULT_KEEPALIVE_INTERVAL), keepAliveCount(DEFAULT_KEEPALIVE_COUNT),
+    opened(0), closed(false)
+{
+}
+
+LibvirtConnectionPool::~LibvirtConnectionPool()
+{
+    close();
+}
+
+void LibvirtConnectionPool::initialize(const string& libvirtUri, bool readOnlyConnections, int poolSize,
+        int poolWaitMs, int keepAliveIntervalSeconds, int keepAliveMaxCount)
+{
+    uri = libvirtUri;
+    readOnly = readOnlyConnections;
+    size = poolSize > 0 ? poolSize : DEFAULT_POOL_SIZE;
+    waitMs = poolWaitMs > 0 ? poolWaitMs : 0;
+    keepAliveInterval = keepAliveIntervalSeconds;
+    keepAliveCount = keepAliveMaxCount > 0 ? keepAliveMaxCount : DEFAULT_KEEPALIVE_COUNT;
+
+    LOG("Libvirt %s connection pool config: {uri='%s', size=%u, wait=%dms, keepAliveInterval=%ds, keepAliveCount=%u}",
+            readOnly ? "read-only" : "read-write", uri.c_str(), size, waitMs, keepAliveInterval, keepAliveCount);
+}
+
+virConnectPtr LibvirtConnectionPool::open()
+{
+    const char* name = (uri.empty() ? NULL : uri.c_str());
+    virConnectPtr conn = (readOnly ? virConnectOpenReadOnly(name) : virConnectOpen(name));
+    if (conn == NULL)
+    {
+        LOG("Unable to open a new %s connection to local libvirt", readOnly ? "read-only" : "read-write");
+        return NULL;
+    }
+
+    // Keepalive messages are sent from the event loop, so a dead peer is
+    // noticed even if the connection stays idle in the pool
+    if (keepAliveInterval > 0 && virConnectSetKeepAlive(conn, keepAliveInterval, keepAliveCount) < 0)
+    {
+        LOG("Unable to enable keepalive on libvirt connection");
+        virResetLastError();
+    }
+
+    return conn;
+}
+
+bool LibvirtConnectionPool::isAlive(const virConnectPtr conn)
+{
+    return virConnectIsAlive(conn) == 1;
+}
+
+virConnectPtr LibvirtConnectionPool::acquire()
+{
+    boost::mutex::scoped_lock lock(pool_mutex);
+    boost::system_time deadline = boost::get_system_time() + boost::posix_time::milliseconds(waitMs);
+
+    while (!closed && idle.empty() && opened >= size)
+    {
+        if (waitMs == 0)
+        {
+            pool_condition.wait(lock);
+        }
+        else if (!pool_condition.timed_wait(lock, deadline) && idle.empty() && opened >= size)
+        {
+            LOG("No %s libvirt connection free after %d ms", readOnly ? "read-only" : "read-write", waitMs);
+            return NULL;
+        }
+    }
+
+    if (closed)
+    {
+        return NULL;
+    }
+
+    while (!idle.empty())
+    {
+        virConnectPtr conn = idle.back();
+        idle.pop_back();
+
+        if (isAlive(conn))
+        {
+            return conn;
+        }
+
+        LOG("Discarding dead libvirt connection");
+        virConnectClose(conn);
+        opened--;
+    }
+
+    // Reserve the slot and open the connection without holding the lock
+    opened++;
+    lock.unlock();
+
+    virConnectPtr conn = open();
+    if (conn == NULL)
+    {
+        lock.lock();
+        opened--;
+        pool_condition.notify_one();
+    }
+
+    return conn;
+}
+
+void LibvirtConnectionPool::release(const virConnectPtr conn)
+{
+    if (conn == NULL)
+    {
+        return;
+    }
+
+    boost::mutex::scoped_lock lock(pool_mutex);
+
+    if (!closed && isAlive(conn))
+    {
+        idle.push_back(conn);
+    }
+    else
+    {
+        if (virConnectClose(conn) < 0)
+        {
+            LOG("Error closing connection to local libvirt");
+        }
+        opened--;
+    }
+
+    pool_condition.notify_one();
+}
+
+void LibvirtConnectionPool::close()
+{
+    boost::mutex::scoped_lock lock(pool_mutex);
+
+    closed = true;
+
+    for (vector<virConnectPtr>::iterator it = idle.begin(); it != idle.end(); ++it)
+    {
+        if (virConnectClose(*it) < 0)
+        {
+            LOG("Error closing connection to local libvirt");
+        }
+        opened--;
+    }
+
+    idle.clear();
+    pool_condition.notify_all();
+}
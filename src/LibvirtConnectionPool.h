@@ -0,0 +1,99 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef LIBVIRT_CONNECTION_POOL_H
+#define LIBVIRT_CONNECTION_POOL_H
+
+#include <Debug.h>
+
+#include <string>
+#include <vector>
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include <libvirt/libvirt.h>
+#include <libvirt/virterror.h>
+
+#define DEFAULT_POOL_SIZE               4
+#define DEFAULT_READ_ONLY_POOL_SIZE     4
+#define DEFAULT_KEEPALIVE_INTERVAL      5
+#define DEFAULT_KEEPALIVE_COUNT         5
+#define DEFAULT_POOL_WAIT               30000
+
+using namespace std;
+
+/*
+ * Bounded pool of persistent connections to the local libvirt daemon, all
+ * of them read-write or read-only.
+ *
+ * Connections are opened lazily up to the configured size and reused across
+ * requests. Dead connections (libvirtd restarted, keepalive timeout) are
+ * detected when borrowed or returned and transparently replaced.
+ */
+class LibvirtConnectionPool : private boost::noncopyable
+{
+    protected:
+        /** Libvirt URI (empty for the default one) */
+        string uri;
+        bool readOnly;
+
+        unsigned int size;
+
+        /** Milliseconds to wait for a free connection (0 waits forever) */
+        int waitMs;
+
+        int keepAliveInterval;
+        unsigned int keepAliveCount;
+
+        /** Connections ready to be borrowed */
+        vector<virConnectPtr> idle;
+
+        /** Number of connections currently open (idle + borrowed) */
+        unsigned int opened;
+
+        /** Set once the pool has been closed; borrowed connections are closed on release */
+        bool closed;
+
+        boost::mutex pool_mutex;
+        boost::condition_variable pool_condition;
+
+        virConnectPtr open();
+        bool isAlive(const virConnectPtr conn);
+
+    public:
+        LibvirtConnectionPool();
+        ~LibvirtConnectionPool();
+
+        void initialize(const string& libvirtUri, bool readOnlyConnections, int poolSize, int poolWaitMs,
+                int keepAliveIntervalSeconds, int keepAliveMaxCount);
+
+        // Borrow a healthy connection, waiting up to waitMs if all of them are in use. Returns NULL on failure.
+        virConnectPtr acquire();
+
+        // Give back a borrowed connection
+        void release(const virConnectPtr conn);
+
+        // Close all the idle connections and stop handing out new ones
+        void close();
+};
+
+#endif
@@ -12,6 +12,8 @@
 #include <boost/filesystem.hpp>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include <pugixml.hpp>
 
@@ -20,10 +22,26 @@
 #define RESCAN_DEVICE_ERROR_CODE    -3
 #define NONE_ERROR_OCCURRED_CODE    -4
 #define NFS_MOUNT_POINT_CREATION    -5
+#define DISK_RESIZE_ERROR_CODE      -6
+
+// Magic of the qcow2 images, and offset of their virtual size in the header
+#define QCOW2_MAGIC                 0x514649fb
+#define QCOW2_SIZE_OFFSET           24
+
+#define EVENT_LOOP_TICK_MS          1000
+#define EVENT_RECONNECT_SECONDS     5
+#define DEFAULT_CACHE_RECONCILE     60
+#define MAX_EVENT_WAIT_MS           60000
+
+// Longest shutdown allowed, and interval the domain state is checked at while waiting for its events
+#define MAX_SHUTDOWN_TIMEOUT        3600
+#define SHUTDOWN_CHECK_MS           5000
 
 using namespace boost::filesystem;
 
-LibvirtService::LibvirtService() : Service("Libvirt")
+LibvirtService::LibvirtService() : Service("Libvirt"), readOnlyQueries(false), eventLoopTimer(-1),
+    keepAliveInterval(DEFAULT_KEEPALIVE_INTERVAL), keepAliveCount(DEFAULT_KEEPALIVE_COUNT), eventConn(NULL),
+    lifecycleCallback(-1), jobCallback(-1), storagePoolCallback(-1), cacheReconcileSeconds(DEFAULT_CACHE_RECONCILE)
 {
 }
 
@@ -33,6 +51,490 @@ LibvirtService::~LibvirtService()
 
 // Private methods
 
+static void eventLoopTick(int timer, void *opaque)
+{
+    // Nothing to do, it just wakes up the event loop periodically so it can be stopped
+}
+
+void LibvirtService::runEventLoop()
+{
+    while (true)
+    {
+        if (virEventRunDefaultImpl() < 0)
+        {
+            LOG("Error running libvirt event loop");
+        }
+
+        boost::this_thread::interruption_point();
+    }
+}
+
+void LibvirtService::pushDomainEvent(virDomainPtr domain, const DomainEventType::type type, int detail)
+{
+    char uuid[VIR_UUID_STRING_BUFLEN];
+    const char *name = virDomainGetName(domain);
+    if (name == NULL || virDomainGetUUIDString(domain, uuid) < 0)
+    {
+        virResetLastError();
+        return;
+    }
+
+    DomainEvent event;
+    event.uuid = string(uuid);
+    event.name = string(name);
+    event.type = type;
+    event.detail = detail;
+    eventBuffer.push(event);
+}
+
+int LibvirtService::domainLifecycleEvent(virConnectPtr conn, virDomainPtr domain, int event, int detail, void *opaque)
+{
+    LibvirtService* service = static_cast<LibvirtService*>(opaque);
+
+    char uuid[VIR_UUID_STRING_BUFLEN];
+    if (virDomainGetUUIDString(domain, uuid) < 0)
+    {
+        return 0;
+    }
+
+    if (event == VIR_DOMAIN_EVENT_UNDEFINED)
+    {
+        service->cache.remove(string(uuid));
+        service->changeLog.append(string(uuid), DomainChangeType::REMOVED);
+    }
+    else
+    {
+        service->cache.invalidate(string(uuid));
+        service->changeLog.append(string(uuid),
+                event == VIR_DOMAIN_EVENT_DEFINED ? DomainChangeType::ADDED : DomainChangeType::CHANGED);
+    }
+
+    switch (event)
+    {
+        case VIR_DOMAIN_EVENT_DEFINED:
+            service->pushDomainEvent(domain, DomainEventType::DEFINED, detail);
+            break;
+        case VIR_DOMAIN_EVENT_UNDEFINED:
+            service->pushDomainEvent(domain, DomainEventType::UNDEFINED, detail);
+            break;
+        case VIR_DOMAIN_EVENT_STARTED:
+            service->pushDomainEvent(domain, DomainEventType::STARTED, detail);
+            break;
+        case VIR_DOMAIN_EVENT_SUSPENDED:
+            service->pushDomainEvent(domain, DomainEventType::SUSPENDED, detail);
+            break;
+        case VIR_DOMAIN_EVENT_RESUMED:
+            service->pushDomainEvent(domain, DomainEventType::RESUMED, detail);
+            break;
+        case VIR_DOMAIN_EVENT_STOPPED:
+            service->pushDomainEvent(domain, DomainEventType::STOPPED, detail);
+            break;
+        case VIR_DOMAIN_EVENT_SHUTDOWN:
+            service->pushDomainEvent(domain, DomainEventType::SHUTDOWN, detail);
+            break;
+        case VIR_DOMAIN_EVENT_PMSUSPENDED:
+            service->pushDomainEvent(domain, DomainEventType::PMSUSPENDED, detail);
+            break;
+        case VIR_DOMAIN_EVENT_CRASHED:
+            service->pushDomainEvent(domain, DomainEventType::CRASHED, detail);
+            break;
+        default:
+            // Events added by newer libvirt versions are not notified
+            break;
+    }
+
+    return 0;
+}
+
+void LibvirtService::domainJobCompletedEvent(virConnectPtr conn, virDomainPtr domain, virTypedParameterPtr params,
+        int nparams, void *opaque)
+{
+    LibvirtService* service = static_cast<LibvirtService*>(opaque);
+
+    char uuid[VIR_UUID_STRING_BUFLEN];
+    if (virDomainGetUUIDString(domain, uuid) == 0)
+    {
+        service->cache.invalidate(string(uuid));
+        service->changeLog.append(string(uuid), DomainChangeType::CHANGED);
+        service->pushDomainEvent(domain, DomainEventType::JOB_COMPLETED, 0);
+    }
+}
+
+void LibvirtService::storagePoolLifecycleEvent(virConnectPtr conn, virStoragePoolPtr pool, int event, int detail,
+        void *opaque)
+{
+    LibvirtService* service = static_cast<LibvirtService*>(opaque);
+
+    char uuid[VIR_UUID_STRING_BUFLEN];
+    if (virStoragePoolGetUUIDString(pool, uuid) < 0)
+    {
+        return;
+    }
+
+    // Started and stopped pools keep their source, only (re)definitions change it
+    if (event == VIR_STORAGE_POOL_EVENT_UNDEFINED)
+    {
+        service->storagePools.remove(string(uuid));
+    }
+    else if (event == VIR_STORAGE_POOL_EVENT_DEFINED)
+    {
+        service->storagePools.invalidate(string(uuid));
+    }
+}
+
+void LibvirtService::eventConnectionClosed(virConnectPtr conn, int reason, void *opaque)
+{
+    LibvirtService* service = static_cast<LibvirtService*>(opaque);
+
+    LOG("Libvirt event connection closed (reason %d). Domain cache disabled until reconnected", reason);
+    service->cache.setSynchronized(false);
+    service->storagePools.setSynchronized(false);
+    service->changeLog.reset();
+    service->eventBuffer.reset();
+}
+
+bool LibvirtService::registerDomainEvents()
+{
+    eventConn = virConnectOpenReadOnly(uri.empty() ? NULL : uri.c_str());
+    if (eventConn == NULL)
+    {
+        LOG("Unable to open the libvirt event connection");
+        return false;
+    }
+
+    if (keepAliveInterval > 0 && virConnectSetKeepAlive(eventConn, keepAliveInterval, keepAliveCount) < 0)
+    {
+        LOG("Unable to enable keepalive on libvirt event connection");
+        virResetLastError();
+    }
+
+    virConnectRegisterCloseCallback(eventConn, eventConnectionClosed, this, NULL);
+
+    lifecycleCallback = virConnectDomainEventRegisterAny(eventConn, NULL, VIR_DOMAIN_EVENT_ID_LIFECYCLE,
+            VIR_DOMAIN_EVENT_CALLBACK(domainLifecycleEvent), this, NULL);
+    if (lifecycleCallback < 0)
+    {
+        LOG("Unable to register domain lifecycle events");
+        deregisterDomainEvents();
+        return false;
+    }
+
+#if LIBVIR_VERSION_NUMBER >= 3003000
+    // Domains with a job in progress are reported in UNKNOWN state, refresh them when it finishes
+    jobCallback = virConnectDomainEventRegisterAny(eventConn, NULL, VIR_DOMAIN_EVENT_ID_JOB_COMPLETED,
+            VIR_DOMAIN_EVENT_CALLBACK(domainJobCompletedEvent), this, NULL);
+    if (jobCallback < 0)
+    {
+        LOG("Unable to register domain job events");
+        virResetLastError();
+    }
+#endif
+
+#if LIBVIR_VERSION_NUMBER >= 2000000
+    // Without them the storage pools are listed each time one is created
+    storagePoolCallback = virConnectStoragePoolEventRegisterAny(eventConn, NULL, VIR_STORAGE_POOL_EVENT_ID_LIFECYCLE,
+            VIR_STORAGE_POOL_EVENT_CALLBACK(storagePoolLifecycleEvent), this, NULL);
+    if (storagePoolCallback < 0)
+    {
+        LOG("Unable to register storage pool events");
+        virResetLastError();
+    }
+#endif
+
+    // Changes before the registration are unknown
+    changeLog.reset();
+    eventBuffer.reset();
+
+    LOG("Registered for libvirt domain events");
+    return true;
+}
+
+void LibvirtService::deregisterDomainEvents()
+{
+    cache.setSynchronized(false);
+    storagePools.setSynchronized(false);
+
+    if (eventConn == NULL)
+    {
+        return;
+    }
+
+    if (lifecycleCallback >= 0)
+    {
+        virConnectDomainEventDeregisterAny(eventConn, lifecycleCallback);
+        lifecycleCallback = -1;
+    }
+
+    if (jobCallback >= 0)
+    {
+        virConnectDomainEventDeregisterAny(eventConn, jobCallback);
+        jobCallback = -1;
+    }
+
+#if LIBVIR_VERSION_NUMBER >= 2000000
+    if (storagePoolCallback >= 0)
+    {
+        virConnectStoragePoolEventDeregisterAny(eventConn, storagePoolCallback);
+        storagePoolCallback = -1;
+    }
+#endif
+
+    virConnectUnregisterCloseCallback(eventConn, eventConnectionClosed);
+    virConnectClose(eventConn);
+    virResetLastError();
+    eventConn = NULL;
+}
+
+bool LibvirtService::reconcileDomainCache()
+{
+    virConnectPtr conn = queryPool().acquire();
+    if (conn == NULL)
+    {
+        return false;
+    }
+
+    bool done = false;
+    unsigned long since = cache.getSequence();
+
+    try
+    {
+        vector<CachedDomain> domains;
+        listDomains(domains, conn, DomainFields::FULL);
+        cache.replace(domains, since);
+
+        // Do not trust the listing if events were lost meanwhile
+        done = (virConnectIsAlive(eventConn) == 1);
+        cache.setSynchronized(done);
+    }
+    catch (...)
+    {
+        LOG("Unable to reconcile the domain cache");
+    }
+
+    queryPool().release(conn);
+    return done;
+}
+
+void LibvirtService::refreshDomainCache(const set<string>& uuids)
+{
+    set<string> failed;
+    virConnectPtr conn = queryPool().acquire();
+
+    for (set<string>::const_iterator it = uuids.begin(); it != uuids.end(); ++it)
+    {
+        if (conn == NULL)
+        {
+            failed.insert(*it);
+            continue;
+        }
+
+        virDomainPtr domain = virDomainLookupByUUIDString(conn, it->c_str());
+        if (domain == NULL)
+        {
+            virErrorPtr error = virGetLastError();
+            if (error != NULL && error->code == VIR_ERR_NO_DOMAIN)
+            {
+                cache.remove(*it);
+            }
+            else
+            {
+                failed.insert(*it);
+            }
+            virResetLastError();
+            continue;
+        }
+
+        try
+        {
+            CachedDomain cached;
+            cached.info = getDomainInfo(conn, domain, cached.state);
+            virDomainFree(domain);
+            cache.put(cached);
+        }
+        catch (...)
+        {
+            // The domain is already freed (see getDomainInfo(conn, domain)). It still exists, so
+            // retry it instead of leaving it out of the cache until the next reconcile
+            failed.insert(*it);
+        }
+    }
+
+    queryPool().release(conn);
+    cache.refreshDone();
+
+    // Retry later the ones that could not be read because of connection errors
+    if (!failed.empty())
+    {
+        for (set<string>::const_iterator it = failed.begin(); it != failed.end(); ++it)
+        {
+            cache.invalidate(*it);
+        }
+
+        boost::this_thread::sleep(boost::posix_time::seconds(1));
+    }
+}
+
+bool LibvirtService::reconcileStoragePools()
+{
+    virConnectPtr conn = queryPool().acquire();
+    if (conn == NULL)
+    {
+        return false;
+    }
+
+    unsigned long since = storagePools.getSequence();
+
+    virStoragePoolPtr *pools;
+    int ret = virConnectListAllStoragePools(conn, &pools, VIR_CONNECT_LIST_STORAGE_POOLS_ISCSI |
+            VIR_CONNECT_LIST_STORAGE_POOLS_NETFS | VIR_CONNECT_LIST_STORAGE_POOLS_DIR);
+    if (ret < 0)
+    {
+        LOG("Unable to list the storage pools");
+        virResetLastError();
+        queryPool().release(conn);
+        return false;
+    }
+
+    map<string, string> all;
+    bool complete = true;
+
+    for (int i = 0; i < ret; i++)
+    {
+        char uuid[VIR_UUID_STRING_BUFLEN];
+        char *xml = virStoragePoolGetXMLDesc(pools[i], 0);
+
+        if (xml == NULL || virStoragePoolGetUUIDString(pools[i], uuid) < 0)
+        {
+            complete = false;
+        }
+        else
+        {
+            all[string(uuid)] = getStoragePoolKey(string(xml));
+        }
+
+        free(xml);
+        virStoragePoolFree(pools[i]);
+    }
+
+    free(pools);
+    virResetLastError();
+    queryPool().release(conn);
+
+    if (!complete)
+    {
+        LOG("Unable to read all the storage pools");
+        return false;
+    }
+
+    storagePools.replace(all, since);
+    LOG("Storage pool registry built with %d pools", ret);
+    return true;
+}
+
+void LibvirtService::refreshStoragePools()
+{
+    set<string> uuids;
+    storagePools.takeDirty(uuids);
+
+    if (uuids.empty())
+    {
+        return;
+    }
+
+    virConnectPtr conn = queryPool().acquire();
+
+    for (set<string>::const_iterator it = uuids.begin(); it != uuids.end(); ++it)
+    {
+        virStoragePoolPtr pool = (conn == NULL ? NULL : virStoragePoolLookupByUUIDString(conn, it->c_str()));
+        char *xml = (pool == NULL ? NULL : virStoragePoolGetXMLDesc(pool, 0));
+
+        if (xml != NULL)
+        {
+            storagePools.put(*it, getStoragePoolKey(string(xml)));
+            free(xml);
+        }
+        else
+        {
+            virErrorPtr error = virGetLastError();
+            if (error != NULL && error->code == VIR_ERR_NO_STORAGE_POOL)
+            {
+                storagePools.remove(*it);
+            }
+            else
+            {
+                // Listed again from scratch
+                storagePools.setSynchronized(false);
+            }
+        }
+
+        if (pool != NULL)
+        {
+            virStoragePoolFree(pool);
+        }
+        virResetLastError();
+    }
+
+    queryPool().release(conn);
+    storagePools.refreshDone();
+}
+
+void LibvirtService::runDomainEvents()
+{
+    boost::posix_time::seconds reconcileDelay(cacheReconcileSeconds);
+    boost::posix_time::seconds refreshDelay(1);
+    boost::posix_time::ptime lastReconcile;
+    bool cacheEnabled = (cacheReconcileSeconds > 0);
+
+    while (true)
+    {
+        if (eventConn == NULL || virConnectIsAlive(eventConn) != 1)
+        {
+            deregisterDomainEvents();
+            if (!registerDomainEvents())
+            {
+                boost::this_thread::sleep(boost::posix_time::seconds(EVENT_RECONNECT_SECONDS));
+                continue;
+            }
+
+            // Events may have been lost, a full listing is needed
+            lastReconcile = boost::posix_time::ptime();
+        }
+
+        if (storagePoolCallback >= 0)
+        {
+            if (!storagePools.isSynchronized())
+            {
+                reconcileStoragePools();
+            }
+            refreshStoragePools();
+        }
+
+        if (!cacheEnabled)
+        {
+            // Just watch the event connection
+            boost::this_thread::sleep(refreshDelay);
+            continue;
+        }
+
+        boost::posix_time::ptime now = boost::posix_time::second_clock::universal_time();
+        if (lastReconcile.is_not_a_date_time() || now - lastReconcile >= reconcileDelay)
+        {
+            if (reconcileDomainCache())
+            {
+                lastReconcile = now;
+            }
+        }
+
+        set<string> uuids;
+        cache.takeDirty(uuids, refreshDelay);
+
+        if (!uuids.empty())
+        {
+            refreshDomainCache(uuids);
+        }
+    }
+}
+
 virDomainPtr LibvirtService::getDomainByUUID(const virConnectPtr conn, const std::string& uuid) throw (LibvirtException)
 {
     virDomainPtr domain = virDomainLookupByUUIDString(conn, uuid.c_str());
@@ -44,6 +546,13 @@ virDomainPtr LibvirtService::getDomainByUUID(const virConnectPtr conn, const std
 }
 
 DomainInfo LibvirtService::getDomainInfo(const virConnectPtr conn, const virDomainPtr domain) throw (LibvirtException)
+{
+    DomainState::type state;
+    return getDomainInfo(conn, domain, state);
+}
+
+DomainInfo LibvirtService::getDomainInfo(const virConnectPtr conn, const virDomainPtr domain, DomainState::type& state)
+    throw (LibvirtException)
 {
     if (domain == NULL)
     {
@@ -86,10 +595,12 @@ DomainInfo LibvirtService::getDomainInfo(const virConnectPtr conn, const virDoma
         throwLastKnownError();
     }
 
+    state = toDomainState(info.state);
+
     DomainInfo domainInfo;
     domainInfo.name            = string(name);
     domainInfo.uuid            = string(uuid);
-    domainInfo.state           = jobInProgress ? DomainState::UNKNOWN : toDomainState(info.state);
+    domainInfo.state           = jobInProgress ? DomainState::UNKNOWN : state;
     domainInfo.numberVirtCpu   = info.nrVirtCpu;            
     domainInfo.memory          = info.memory; // KBytes
     domainInfo.xmlDesc         = string(xml);
@@ -182,7 +693,69 @@ void LibvirtService::parseSourceHostAndDir(const std::string& xmlDesc, std::stri
     }
 }
 
-void LibvirtService::defineStoragePool(const virConnectPtr conn, const std::string& xmlDesc) throw (LibvirtException)
+string LibvirtService::getStoragePoolKey(const std::string& xmlDesc)
+{
+    string type = stringBetween(xmlDesc, "<pool type='", "'");
+    if (type.empty())
+    {
+        type = stringBetween(xmlDesc, "<pool type=\"", "\"");
+    }
+
+    if (type == "iscsi")
+    {
+        return StoragePoolRegistry::iscsiKey(parseDevicePath(xmlDesc));
+    }
+    else if (type == "netfs")
+    {
+        string host, dir;
+        parseSourceHostAndDir(xmlDesc, host, dir);
+        return StoragePoolRegistry::netfsKey(host, dir);
+    }
+    else if (type == "dir")
+    {
+        return StoragePoolRegistry::dirKey(parseTargetPath(xmlDesc));
+    }
+
+    return "";
+}
+
+bool LibvirtService::existStoragePool(const virConnectPtr conn, unsigned int type, const std::string& key)
+    throw (LibvirtException)
+{
+    bool defined = false;
+    if (storagePools.contains(key, defined))
+    {
+        LOG("Storage pool '%s' %s (registry)", key.c_str(), defined ? "found" : "not found");
+        return defined;
+    }
+
+    // The registry is not synchronized, so all the pools of the type are read
+    virStoragePoolPtr *pools;
+    int ret = virConnectListAllStoragePools(conn, &pools, type);
+    if (ret < 0)
+    {
+        throwLastKnownError();
+    }
+
+    for (int i = 0; i < ret; i++)
+    {
+        char *xml = virStoragePoolGetXMLDesc(pools[i], 0);
+        if (xml != NULL && !defined)
+        {
+            defined = (getStoragePoolKey(string(xml)) == key);
+        }
+        free(xml);
+        virStoragePoolFree(pools[i]);
+    }
+
+    free(pools);
+
+    LOG("Storage pool '%s' %s (%d pools listed)", key.c_str(), defined ? "found" : "not found", ret);
+    return defined;
+}
+
+void LibvirtService::defineStoragePool(const virConnectPtr conn, const std::string& xmlDesc, const std::string& key)
+    throw (LibvirtException)
 {
     LOG("Define storage pool XML: %s", xmlDesc.c_str());
     virStoragePoolPtr storagePool = virStoragePoolDefineXML(conn, xmlDesc.c_str(), 0);
@@ -208,6 +781,14 @@ void LibvirtService::defineStoragePool(const virConnectPtr conn, const std::stri
     }
 
     LOG("Storage pool defined, created and activated");
+
+    // Indexed right away, without waiting for its event
+    char uuid[VIR_UUID_STRING_BUFLEN];
+    if (virStoragePoolGetUUIDString(storagePool, uuid) == 0)
+    {
+        storagePools.put(string(uuid), key);
+    }
+
     virStoragePoolFree(storagePool);
 }
 
@@ -277,21 +858,83 @@ string LibvirtService::to_string(const double value)
 
 bool LibvirtService::initialize(INIReader configuration)
 {
+    uri = configuration.Get("libvirt", "uri", "");
+    int poolSize = configuration.GetInteger("libvirt", "poolSize", DEFAULT_POOL_SIZE);
+    int poolWaitMs = configuration.GetInteger("libvirt", "poolWaitMs", DEFAULT_POOL_WAIT);
+    int readOnlyPoolSize = configuration.GetInteger("libvirt", "readOnlyPoolSize", DEFAULT_READ_ONLY_POOL_SIZE);
+    keepAliveInterval = configuration.GetInteger("libvirt", "keepAliveInterval", DEFAULT_KEEPALIVE_INTERVAL);
+    keepAliveCount = configuration.GetInteger("libvirt", "keepAliveCount", DEFAULT_KEEPALIVE_COUNT);
+    cacheReconcileSeconds = configuration.GetInteger("libvirt", "cacheReconcileSeconds", DEFAULT_CACHE_RECONCILE);
+    int changeLogSize = configuration.GetInteger("libvirt", "changeLogSize", DEFAULT_CHANGE_LOG_SIZE);
+    int eventBufferSize = configuration.GetInteger("libvirt", "eventBufferSize", DEFAULT_EVENT_BUFFER_SIZE);
+
+    // The event loop must be registered before opening any connection to get keepalive support
+    if (virEventRegisterDefaultImpl() < 0)
+    {
+        LOG("Unable to register the libvirt event loop");
+        return false;
+    }
+
+    pool.initialize(uri, false, poolSize, poolWaitMs, keepAliveInterval, keepAliveCount);
+
+    readOnlyQueries = (readOnlyPoolSize > 0);
+    if (readOnlyQueries)
+    {
+        readOnlyPool.initialize(uri, true, readOnlyPoolSize, poolWaitMs, keepAliveInterval, keepAliveCount);
+    }
+    changeLog.initialize(changeLogSize);
+    eventBuffer.initialize(eventBufferSize);
+
+    if (cacheReconcileSeconds > 0)
+    {
+        LOG("Domain cache enabled, reconciled every %d seconds", cacheReconcileSeconds);
+    }
+    else
+    {
+        LOG("Domain cache disabled");
+    }
+
     return true;
 }
 
 bool LibvirtService::start()
 {
+    eventLoopTimer = virEventAddTimeout(EVENT_LOOP_TICK_MS, eventLoopTick, NULL, NULL);
+    if (eventLoopTimer < 0)
+    {
+        LOG("Unable to add the libvirt event loop timer");
+        return false;
+    }
+
+    eventLoopThread = boost::thread(&LibvirtService::runEventLoop, this);
+
+    eventsThread = boost::thread(&LibvirtService::runDomainEvents, this);
+
     return true;
 }
 
 bool LibvirtService::stop()
 {
+    eventsThread.interrupt();
+    eventsThread.join();
+    deregisterDomainEvents();
+
+    eventLoopThread.interrupt();
+    eventLoopThread.join();
+
+    if (eventLoopTimer >= 0)
+    {
+        virEventRemoveTimeout(eventLoopTimer);
+        eventLoopTimer = -1;
+    }
+
     return true;
 }
 
 bool LibvirtService::cleanup()
 {
+    pool.close();
+    readOnlyPool.close();
     return true;
 }
 
@@ -328,7 +971,7 @@ void LibvirtService::throwLastKnownError()
 
 virConnectPtr LibvirtService::connect() throw (LibvirtException)
 {
-    virConnectPtr conn = virConnectOpen(NULL);
+    virConnectPtr conn = pool.acquire();
     if (conn == NULL)
     {
         LibvirtException exception;
@@ -342,10 +985,32 @@ virConnectPtr LibvirtService::connect() throw (LibvirtException)
 
 void LibvirtService::disconnect(const virConnectPtr conn)
 {
-    if(conn != NULL && virConnectClose(conn))
+    pool.release(conn);
+}
+
+LibvirtConnectionPool& LibvirtService::queryPool()
+{
+    // Without read-only connections the queries share the read-write pool
+    return readOnlyQueries ? readOnlyPool : pool;
+}
+
+virConnectPtr LibvirtService::connectReadOnly() throw (LibvirtException)
+{
+    virConnectPtr conn = queryPool().acquire();
+    if (conn == NULL)
     {
-        LOG("Error closing connection to local libvirt");
+        LibvirtException exception;
+        exception.code = CONNECTION_ERROR_CODE;
+        exception.msg = "Could not connect to local libvirt";
+        LOG(exception.msg.c_str());
+        throw exception;
     }
+    return conn;
+}
+
+void LibvirtService::disconnectReadOnly(const virConnectPtr conn)
+{
+    queryPool().release(conn);
 }
 
 void LibvirtService::getNodeInfo(NodeInfo& _return, const virConnectPtr conn) throw (LibvirtException)
@@ -381,7 +1046,222 @@ void LibvirtService::getNodeInfo(NodeInfo& _return, const virConnectPtr conn) th
 
 void LibvirtService::getDomains(std::vector<DomainInfo> & _return, const virConnectPtr conn) throw (LibvirtException)
 {
-    LOG("Get all domains");
+    getDomains(_return, DomainFields::FULL, conn);
+}
+
+void LibvirtService::getDomainsLite(std::vector<DomainInfo> & _return, const virConnectPtr conn) throw (LibvirtException)
+{
+    getDomains(_return, DomainFields::RESOURCES, conn);
+}
+
+void LibvirtService::getDomains(std::vector<DomainInfo> & _return, const DomainFields::type fields,
+        const virConnectPtr conn) throw (LibvirtException)
+{
+    LOG("Get all domains (fields %d)", fields);
+
+    if (cache.getAll(_return, fields))
+    {
+        LOG("%zu domains returned from cache", _return.size());
+        return;
+    }
+
+    vector<CachedDomain> domains;
+    listDomains(domains, conn, fields);
+
+    _return.reserve(_return.size() + domains.size());
+    for (vector<CachedDomain>::const_iterator it = domains.begin(); it != domains.end(); ++it)
+    {
+        _return.push_back(it->info);
+    }
+
+    LOG("%zu domains returned", _return.size());
+}
+
+void LibvirtService::getDomainsChangedSince(DomainChanges& _return, const int64_t generation,
+        const DomainFields::type fields, const virConnectPtr conn) throw (LibvirtException)
+{
+    LOG("Get domains changed since generation %lld", (long long) generation);
+
+    map<string, DomainChangeType::type> changes;
+    if (!changeLog.since(generation, changes, _return.generation))
+    {
+        // The generation is taken before the listing, so changes made meanwhile are sent again next time
+        LOG("Changes since generation %lld are unknown, returning all domains", (long long) generation);
+        _return.snapshot = true;
+        getDomains(_return.domains, fields, conn);
+        return;
+    }
+
+    _return.snapshot = false;
+
+    for (map<string, DomainChangeType::type>::const_iterator it = changes.begin(); it != changes.end(); ++it)
+    {
+        DomainChange change;
+        change.uuid = it->first;
+        change.type = it->second;
+
+        DomainInfo info;
+        if (cache.get(it->first, info))
+        {
+            change.info = DomainCache::project(info, fields);
+        }
+        else
+        {
+            virDomainPtr domain = virDomainLookupByUUIDString(conn, it->first.c_str());
+            if (domain == NULL)
+            {
+                virErrorPtr error = virGetLastError();
+                if (error == NULL || error->code != VIR_ERR_NO_DOMAIN)
+                {
+                    throwLastKnownError();
+                }
+
+                virResetLastError();
+                change.type = DomainChangeType::REMOVED;
+                change.info.uuid = it->first;
+                _return.changes.push_back(change);
+                continue;
+            }
+
+            change.info = DomainCache::project(getDomainInfo(conn, domain), fields);
+            virDomainFree(domain);
+        }
+
+        // Removed and defined again
+        if (change.type == DomainChangeType::REMOVED)
+        {
+            change.type = DomainChangeType::ADDED;
+        }
+
+        _return.changes.push_back(change);
+    }
+
+    LOG("%zu domains changed since generation %lld", _return.changes.size(), (long long) generation);
+}
+
+void LibvirtService::waitForEvents(DomainEvents& _return, const int64_t sinceId, const int32_t timeoutMs)
+{
+    // Each waiting call holds a server thread, do not let it wait forever
+    int32_t timeout = timeoutMs < 0 ? 0 : (timeoutMs > MAX_EVENT_WAIT_MS ? MAX_EVENT_WAIT_MS : timeoutMs);
+
+    eventBuffer.wait(sinceId, boost::posix_time::milliseconds(timeout), _return);
+
+    if (_return.lost)
+    {
+        LOG("Events after %lld are unknown, returning %zu buffered events", (long long) sinceId, _return.events.size());
+    }
+}
+
+#if LIBVIR_VERSION_NUMBER >= 1002008
+
+bool LibvirtService::readDomainStats(const virDomainStatsRecordPtr record, const DomainFields::type fields,
+        CachedDomain& domain)
+{
+    virDomainPtr dom = record->dom;
+
+    const char *name = virDomainGetName(dom);
+    char uuid[VIR_UUID_STRING_BUFLEN];
+    if (name == NULL || virDomainGetUUIDString(dom, uuid) < 0)
+    {
+        virResetLastError();
+        return false;
+    }
+
+    int state = VIR_DOMAIN_NOSTATE;
+    virTypedParamsGetInt(record->params, record->nparams, "state.state", &state);
+
+    domain.state        = toDomainState(state);
+    domain.info.name    = string(name);
+    domain.info.uuid    = string(uuid);
+    domain.info.state   = domain.state;
+
+    if (fields == DomainFields::STATE)
+    {
+        return true;
+    }
+
+    unsigned int vcpus = 0;
+    unsigned long long memory = 0;
+    bool hasVcpus = (virTypedParamsGetUInt(record->params, record->nparams, "vcpu.current", &vcpus) == 1);
+    bool hasMemory = (virTypedParamsGetULLong(record->params, record->nparams, "balloon.current", &memory) == 1);
+
+    // Not all the drivers report every stat
+    if (!hasVcpus || !hasMemory)
+    {
+        virDomainInfo info;
+        if (virDomainGetInfo(dom, &info) < 0)
+        {
+            virResetLastError();
+            return false;
+        }
+
+        vcpus = hasVcpus ? vcpus : info.nrVirtCpu;
+        memory = hasMemory ? memory : info.memory;
+    }
+
+    domain.info.numberVirtCpu   = vcpus;
+    domain.info.memory          = memory; // KBytes
+
+    if (fields == DomainFields::FULL)
+    {
+        // Only running domains can have a job in progress
+        if (state != VIR_DOMAIN_SHUTOFF)
+        {
+            virDomainJobInfo jobInfo;
+            if (virDomainGetJobInfo(dom, &jobInfo) == 0 && jobInfo.type != 0)
+            {
+                domain.info.state = DomainState::UNKNOWN;
+            }
+            virResetLastError();
+        }
+
+        char *xml = virDomainGetXMLDesc(dom, 0);
+        if (xml == NULL)
+        {
+            virResetLastError();
+            return false;
+        }
+
+        domain.info.xmlDesc = string(xml);
+        free(xml);
+    }
+
+    return true;
+}
+
+#endif
+
+void LibvirtService::listDomains(vector<CachedDomain>& _return, const virConnectPtr conn, const DomainFields::type fields)
+    throw (LibvirtException)
+{
+#if LIBVIR_VERSION_NUMBER >= 1002008
+    // State, vCPUs and memory of all the domains in a single call. Only the XML
+    // description and the job info (when requested) need a call per domain
+    virDomainStatsRecordPtr *records;
+    unsigned int stats = VIR_DOMAIN_STATS_STATE;
+    if (fields != DomainFields::STATE)
+    {
+        stats |= VIR_DOMAIN_STATS_VCPU | VIR_DOMAIN_STATS_BALLOON;
+    }
+
+    int ret = virConnectGetAllDomainStats(conn, stats, &records, 0);
+    if (ret < 0)
+    {
+        throwLastKnownError();
+    }
+
+    _return.reserve(ret);
+    for (int i = 0; i < ret; i++)
+    {
+        CachedDomain domain;
+        if (readDomainStats(records[i], fields, domain))
+        {
+            _return.push_back(domain);
+        }
+    }
+
+    virDomainStatsRecordListFree(records);
+#else
     virDomainPtr *domains;
 
     int ret = virConnectListAllDomains(conn, &domains, 0);
@@ -394,9 +1274,9 @@ void LibvirtService::getDomains(std::vector<DomainInfo> & _return, const virConn
     {
         try
         {
-            
-            DomainInfo domainInfo = getDomainInfo(conn, domains[i]);
-            _return.push_back(domainInfo);
+            CachedDomain domain;
+            domain.info = DomainCache::project(getDomainInfo(conn, domains[i], domain.state), fields);
+            _return.push_back(domain);
             virDomainFree(domains[i]);
         }
         catch(...)
@@ -406,8 +1286,8 @@ void LibvirtService::getDomains(std::vector<DomainInfo> & _return, const virConn
         }
     }
 
-    LOG("%zu domains returned", _return.size());
     free(domains);
+#endif
 }
 
 void LibvirtService::defineDomain(const virConnectPtr conn, const std::string& xmlDesc) throw (LibvirtException)
@@ -419,6 +1299,12 @@ void LibvirtService::defineDomain(const virConnectPtr conn, const std::string& x
         throwLastKnownError();
     }
 
+    char uuid[VIR_UUID_STRING_BUFLEN];
+    if (virDomainGetUUIDString(domain, uuid) == 0)
+    {
+        cache.invalidate(string(uuid));
+    }
+
     virDomainFree(domain);
 }
 
@@ -455,6 +1341,7 @@ void LibvirtService::undefineDomain(const virConnectPtr conn, const std::string&
 
     int ret = virDomainUndefineFlags(domain, flags);
     virDomainFree(domain);
+    cache.invalidate(domainUUID);
 
     if (ret < 0)
     {
@@ -467,6 +1354,13 @@ bool LibvirtService::existDomain(const virConnectPtr conn, const std::string& do
     try
     {
         LOG("Check if domain '%s' exists", domainUUID.c_str());
+
+        DomainState::type state;
+        if (cache.getState(domainUUID, state))
+        {
+            return true;
+        }
+
         virDomainPtr domain = getDomainByUUID(conn, domainUUID);
         virDomainFree(domain);
         return true;
@@ -480,6 +1374,13 @@ bool LibvirtService::existDomain(const virConnectPtr conn, const std::string& do
 DomainState::type LibvirtService::getDomainState(const virConnectPtr conn, const std::string& domainUUID) throw (LibvirtException)
 {
     LOG("Get domain '%s' state", domainUUID.c_str());
+
+    DomainState::type cached;
+    if (cache.getState(domainUUID, cached))
+    {
+        return cached;
+    }
+
     virDomainPtr domain = getDomainByUUID(conn, domainUUID);
     virDomainInfo info;
 
@@ -499,6 +1400,12 @@ DomainState::type LibvirtService::getDomainState(const virConnectPtr conn, const
 void LibvirtService::getDomainInfo(DomainInfo& _return, const virConnectPtr conn, const std::string& domainUUID) throw (LibvirtException)
 {
     LOG("Get domain '%s' info", domainUUID.c_str());
+
+    if (cache.get(domainUUID, _return))
+    {
+        return;
+    }
+
     virDomainPtr domain = getDomainByUUID(conn, domainUUID);
     _return = getDomainInfo(conn, domain);
     virDomainFree(domain);
@@ -511,6 +1418,7 @@ void LibvirtService::powerOn(const virConnectPtr conn, const std::string& domain
 
     int ret = virDomainCreate(domain);
     virDomainFree(domain);
+    cache.invalidate(domainUUID);
     
     if (ret < 0)
     {
@@ -525,6 +1433,7 @@ void LibvirtService::powerOff(const virConnectPtr conn, const std::string& domai
 
     int ret = virDomainDestroy(domain);
     virDomainFree(domain);
+    cache.invalidate(domainUUID);
     
     if (ret < 0)
     {
@@ -539,6 +1448,7 @@ void LibvirtService::shutdown(const virConnectPtr conn, const std::string& domai
 
     int ret = virDomainShutdownFlags(domain, VIR_DOMAIN_SHUTDOWN_ACPI_POWER_BTN);
     virDomainFree(domain);
+    cache.invalidate(domainUUID);
     
     if (ret < 0)
     {
@@ -546,6 +1456,153 @@ void LibvirtService::shutdown(const virConnectPtr conn, const std::string& domai
     }
 }
 
+bool LibvirtService::isShutOff(const std::string& domainUUID) throw (LibvirtException)
+{
+    virConnectPtr conn = connectReadOnly();
+
+    // Gone if it was transient
+    virDomainPtr domain = virDomainLookupByUUIDString(conn, domainUUID.c_str());
+    if (domain == NULL)
+    {
+        virErrorPtr error = virGetLastError();
+        bool gone = (error != NULL && error->code == VIR_ERR_NO_DOMAIN);
+        virResetLastError();
+        disconnectReadOnly(conn);
+        return gone;
+    }
+
+    virDomainInfo info;
+    bool off = (virDomainGetInfo(domain, &info) == 0 && info.state == VIR_DOMAIN_SHUTOFF);
+    virResetLastError();
+
+    virDomainFree(domain);
+    disconnectReadOnly(conn);
+    return off;
+}
+
+void LibvirtService::shutdownWithDeadline(const std::string& domainUUID, int timeoutSec, DomainResult& _return)
+    throw (LibvirtException)
+{
+    boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+    int timeout = timeoutSec < 0 ? 0 : (timeoutSec > MAX_SHUTDOWN_TIMEOUT ? MAX_SHUTDOWN_TIMEOUT : timeoutSec);
+
+    LOG("Shutdown domain '%s' with a timeout of %d seconds", domainUUID.c_str(), timeout);
+
+    // Only the events after the shutdown request matter
+    DomainEvents known;
+    eventBuffer.wait(-1, boost::posix_time::milliseconds(0), known);
+    int64_t sinceId = known.lastId;
+
+    // Connections are only taken for each call to libvirt, never while waiting
+    bool off = isShutOff(domainUUID);
+    if (!off && timeout > 0)
+    {
+        virConnectPtr conn = connect();
+        try
+        {
+            shutdown(conn, domainUUID);
+            disconnect(conn);
+        }
+        catch (...)
+        {
+            disconnect(conn);
+            throw;
+        }
+    }
+
+    boost::posix_time::ptime deadline = start + boost::posix_time::seconds(timeout);
+    boost::posix_time::ptime now = boost::posix_time::microsec_clock::universal_time();
+
+    // Wake up with the events of the domain, checking its state now and then in case they are lost
+    while (!off && now < deadline)
+    {
+        boost::posix_time::time_duration wait = deadline - now;
+        if (wait > boost::posix_time::milliseconds(SHUTDOWN_CHECK_MS))
+        {
+            wait = boost::posix_time::milliseconds(SHUTDOWN_CHECK_MS);
+        }
+
+        DomainEvents events;
+        eventBuffer.wait(sinceId, wait, events);
+        sinceId = events.lastId;
+
+        bool check = events.lost || events.events.empty();
+        for (vector<DomainEvent>::const_iterator it = events.events.begin(); it != events.events.end(); ++it)
+        {
+            check = check || (it->uuid == domainUUID);
+        }
+
+        off = check && isShutOff(domainUUID);
+        now = boost::posix_time::microsec_clock::universal_time();
+    }
+
+    _return.forced = false;
+
+    if (!off)
+    {
+        LOG("Domain '%s' did not shut down in %d seconds, destroying it", domainUUID.c_str(), timeout);
+
+        virConnectPtr conn = connect();
+        virDomainPtr domain = virDomainLookupByUUIDString(conn, domainUUID.c_str());
+        bool destroyed = (domain != NULL && virDomainDestroy(domain) == 0);
+
+        LibvirtException error;
+        if (!destroyed)
+        {
+            try
+            {
+                throwLastKnownError();
+            }
+            catch (LibvirtException& e)
+            {
+                error = e;
+            }
+        }
+
+        if (domain != NULL)
+        {
+            virDomainFree(domain);
+        }
+        disconnect(conn);
+        cache.invalidate(domainUUID);
+
+        // It may have stopped right after the last check
+        if (!destroyed && !isShutOff(domainUUID))
+        {
+            throw error;
+        }
+
+        // Otherwise the guest finished shutting down by itself
+        _return.forced = destroyed;
+    }
+
+    _return.state = DomainState::OFF;
+
+    virConnectPtr conn = connectReadOnly();
+    virDomainPtr domain = virDomainLookupByUUIDString(conn, domainUUID.c_str());
+    virDomainInfo info;
+
+    if (domain != NULL && virDomainGetInfo(domain, &info) == 0)
+    {
+        _return.state = toDomainState(info.state);
+    }
+    virResetLastError();
+
+    if (domain != NULL)
+    {
+        virDomainFree(domain);
+    }
+    disconnectReadOnly(conn);
+    cache.invalidate(domainUUID);
+
+    _return.domainName = domainUUID;
+    _return.success = true;
+    _return.durationMs = (boost::posix_time::microsec_clock::universal_time() - start).total_microseconds() / 1000.0;
+
+    LOG("Domain '%s' %s in %.0f ms", domainUUID.c_str(), _return.forced ? "destroyed" : "shut down",
+        _return.durationMs);
+}
+
 void LibvirtService::reset(const virConnectPtr conn, const std::string& domainUUID) throw (LibvirtException)
 {
     LOG("Reset domain '%s'", domainUUID.c_str());
@@ -553,6 +1610,7 @@ void LibvirtService::reset(const virConnectPtr conn, const std::string& domainUU
 
     int ret = virDomainReboot(domain, 0);
     virDomainFree(domain);
+    cache.invalidate(domainUUID);
     
     if (ret < 0)
     {
@@ -567,6 +1625,7 @@ void LibvirtService::pause(const virConnectPtr conn, const std::string& domainUU
 
     int ret = virDomainSuspend(domain);
     virDomainFree(domain);
+    cache.invalidate(domainUUID);
     
     if (ret < 0)
     {
@@ -581,6 +1640,7 @@ void LibvirtService::resume(const virConnectPtr conn, const std::string& domainU
 
     int ret = virDomainResume(domain);
     virDomainFree(domain);
+    cache.invalidate(domainUUID);
     
     if (ret < 0)
     {
@@ -594,30 +1654,9 @@ void LibvirtService::createISCSIStoragePool(const virConnectPtr conn, const std:
     LOG("Creating iSCSI storage pool %s (host='%s' iqn='%s' targetPath='%s')", name.c_str(), host.c_str(),
             iqn.c_str(), targetPath.c_str());
 
-    virStoragePoolPtr *pools;
-    int ret = virConnectListAllStoragePools(conn, &pools, VIR_CONNECT_LIST_STORAGE_POOLS_ISCSI);
-    if (ret < 0)
-    {
-        throwLastKnownError();
-    }
-
     LOG("Creck if the iSCSI storage pool (host='%s', iqn='%s') is already defined", host.c_str(), iqn.c_str());
-    bool defined = false;
-    for (int i = 0; i < ret; i++)
-    {
-        LOG("Checking iSCSI storage pool %d of %d...", i + 1, ret);
-        char *xml = virStoragePoolGetXMLDesc(pools[i], 0);
-        if (xml != NULL && !defined)
-        {
-            string _iqn = parseDevicePath(string(xml));
-            defined = (_iqn.compare(iqn) == 0);
-            free((char *) xml);
-            LOG("Found iqn='%s'. Match=%s", _iqn.c_str(), defined ? "True" : "False");
-        }
-        virStoragePoolFree(pools[i]);
-    }
-
-    free(pools);
+    string key = StoragePoolRegistry::iscsiKey(iqn);
+    bool defined = existStoragePool(conn, VIR_CONNECT_LIST_STORAGE_POOLS_ISCSI, key);
 
     if (!defined)
     {
@@ -639,7 +1678,7 @@ void LibvirtService::createISCSIStoragePool(const virConnectPtr conn, const std:
         xml << "</pool>";
         xml.flush();
 
-        defineStoragePool(conn, xml.str());
+        defineStoragePool(conn, xml.str(), key);
     }
     else
     {
@@ -665,32 +1704,9 @@ void LibvirtService::createNFSStoragePool(const virConnectPtr conn, const std::s
     LOG("Creating NFS storage pool %s (host='%s' dir='%s' targetPath='%s')", name.c_str(), host.c_str(),
             dir.c_str(), targetPath.c_str());
 
-    virStoragePoolPtr *pools;
-    int ret = virConnectListAllStoragePools(conn, &pools, VIR_CONNECT_LIST_STORAGE_POOLS_NETFS);
-    if (ret < 0)
-    {
-        throwLastKnownError();
-    }
-
     LOG("Creck if the NFS storage pool (host='%s', dir='%s') is already defined", host.c_str(), dir.c_str());
-    bool defined = false;
-    for (int i = 0; i < ret; i++)
-    {
-        LOG("Checking NFS storage pool %d of %d...", i + 1, ret);
-        char *xml = virStoragePoolGetXMLDesc(pools[i], 0);
-        if (xml != NULL && !defined)
-        {
-            string _host = "";
-            string _dir= "";
-            parseSourceHostAndDir(string(xml), _host, _dir);
-            defined = (host.compare(_host) == 0) && (dir.compare(_dir) ==0);
-            free((char *) xml);
-            LOG("Found host='%s' dir='%s'. Match=%s", _host.c_str(), _dir.c_str(), defined ? "True" : "False");
-        }
-        virStoragePoolFree(pools[i]);
-    }
-
-    free(pools);
+    string key = StoragePoolRegistry::netfsKey(host, dir);
+    bool defined = existStoragePool(conn, VIR_CONNECT_LIST_STORAGE_POOLS_NETFS, key);
 
     LOG("Check if mount point '%s' exists", targetPath.c_str());
     if (!exists(targetPath))
@@ -726,7 +1742,7 @@ void LibvirtService::createNFSStoragePool(const virConnectPtr conn, const std::s
         xml << "</pool>";
         xml.flush();
 
-        defineStoragePool(conn, xml.str());
+        defineStoragePool(conn, xml.str(), key);
     }
 }
 
@@ -735,30 +1751,9 @@ void LibvirtService::createDirStoragePool(const virConnectPtr conn, const std::s
 {
     LOG("Creating DIR storage pool %s (targetPath='%s')", name.c_str(), targetPath.c_str());
 
-    virStoragePoolPtr *pools;
-    int ret = virConnectListAllStoragePools(conn, &pools, VIR_CONNECT_LIST_STORAGE_POOLS_DIR);
-    if (ret < 0)
-    {
-        throwLastKnownError();
-    }
-
     LOG("Creck if the DIR storage pool (targetPath='%s') is already defined", targetPath.c_str());
-    bool defined = false;
-    for (int i = 0; i < ret; i++)
-    {
-        LOG("Checking DIR storage pool %d of %d...", i + 1, ret);
-        char *xml = virStoragePoolGetXMLDesc(pools[i], 0);
-        if (xml != NULL && !defined)
-        {
-            string _path = parseTargetPath(string(xml));
-            defined = comparePaths(_path, targetPath); // (_path.compare(targetPath) == 0);
-            free((char*) xml);
-            LOG("Found directory='%s'. Match=%s", _path.c_str(), defined ? "True" : "False");
-        }
-        virStoragePoolFree(pools[i]);
-    }
-
-    free(pools);
+    string key = StoragePoolRegistry::dirKey(targetPath);
+    bool defined = existStoragePool(conn, VIR_CONNECT_LIST_STORAGE_POOLS_DIR, key);
 
     LOG("Check if directory '%s' exists", targetPath.c_str());
     if (!exists(targetPath))
@@ -792,10 +1787,16 @@ void LibvirtService::createDirStoragePool(const virConnectPtr conn, const std::s
         xml << "</pool>";
         xml.flush();
 
-        defineStoragePool(conn, xml.str());
+        defineStoragePool(conn, xml.str(), key);
     }
 }
 
+string LibvirtService::getDomainUUID(const std::string& xmlDesc)
+{
+    // Empty if libvirt generates it, such a domain can not be the target of other operations yet
+    return stringBetween(xmlDesc, "<uuid>", "</uuid>");
+}
+
 bool LibvirtService::comparePaths(const std::string& one, const std::string& other)
 {
     string _one = endsWith(one, "/") ? one : one + "/";
@@ -920,26 +1921,251 @@ void LibvirtService::resizeVol(const virConnectPtr conn, const string& poolName,
     LOG("Disk '%s' resized", name.c_str());
 }
 
+static void throwDiskResizeError(const string& message)
+{
+    LibvirtException exception;
+    exception.code = DISK_RESIZE_ERROR_CODE;
+    exception.msg = message;
+    LOG(exception.msg.c_str());
+    throw exception;
+}
+
+// Disks are never shrunk, a wrong size would destroy the data of the guest
+static void throwShrinkError(const string& source, unsigned long long size, unsigned long long bytes)
+{
+    ostringstream message;
+    message << "Disk '" << source << "' has " << size << " bytes, it can not be shrunk to " << bytes;
+    throwDiskResizeError(message.str());
+}
+
+// Virtual size of a qcow2 image, as written in its header
+static bool getQcow2Size(const string& source, unsigned long long& size)
+{
+    unsigned char header[QCOW2_SIZE_OFFSET + 8];
+    int fd = open(source.c_str(), O_RDONLY);
+    bool loaded = (fd >= 0 && pread(fd, header, sizeof(header), 0) == (ssize_t) sizeof(header));
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    if (!loaded || ((header[0] << 24) | (header[1] << 16) | (header[2] << 8) | header[3]) != QCOW2_MAGIC)
+    {
+        return false;
+    }
+
+    size = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        size = (size << 8) | header[QCOW2_SIZE_OFFSET + i];
+    }
+
+    return true;
+}
+
+bool LibvirtService::getDiskSource(const std::string& xmlDesc, const std::string& diskPath, std::string& source,
+        std::string& format)
+{
+    pugi::xml_document doc;
+    pugi::xml_parse_result result = doc.load_buffer(xmlDesc.data(), xmlDesc.size());
+
+    if (!result)
+    {
+        LOG("Error loading domain XML. Cause: '%s'", result.description());
+        return false;
+    }
+
+    // Disks are given by their target device or by their source, as virDomainBlockResize accepts
+    pugi::xml_node devices = doc.child("domain").child("devices");
+    for (pugi::xml_node disk = devices.child("disk"); disk; disk = disk.next_sibling("disk"))
+    {
+        string target = disk.child("target").attribute("dev").value();
+        string file = disk.child("source").attribute("file").value();
+        string dev = disk.child("source").attribute("dev").value();
+
+        if (diskPath == target || (!file.empty() && diskPath == file) || (!dev.empty() && diskPath == dev))
+        {
+            source = file.empty() ? dev : file;
+            format = disk.child("driver").attribute("type").value();
+            return !source.empty();
+        }
+    }
+
+    return false;
+}
+
+void LibvirtService::resizeOfflineDisk(const virConnectPtr conn, const std::string& source, const std::string& format,
+        unsigned long long bytes) throw (LibvirtException)
+{
+    // Volumes of a storage pool are resized by libvirt, whatever their format
+    virStorageVolPtr vol = virStorageVolLookupByPath(conn, source.c_str());
+    if (vol != NULL)
+    {
+        virStorageVolInfo info;
+        if (virStorageVolGetInfo(vol, &info) < 0)
+        {
+            virStorageVolFree(vol);
+            throwLastKnownError();
+        }
+
+        if (bytes < info.capacity)
+        {
+            virStorageVolFree(vol);
+            throwShrinkError(source, info.capacity, bytes);
+        }
+
+        LOG("Resizing volume '%s' from %llu to %llu bytes", source.c_str(), info.capacity, bytes);
+        if (virStorageVolResize(vol, bytes, 0) < 0 || virStorageVolGetInfo(vol, &info) < 0)
+        {
+            virStorageVolFree(vol);
+            throwLastKnownError();
+        }
+        virStorageVolFree(vol);
+
+        // Images are rounded up to whole sectors
+        if (info.capacity < bytes || info.capacity - bytes >= 512)
+        {
+            ostringstream message;
+            message << "Volume '" << source << "' has " << info.capacity << " bytes after resizing it to " << bytes;
+            throwDiskResizeError(message.str());
+        }
+        return;
+    }
+    virResetLastError();
+
+    struct stat st;
+    if (stat(source.c_str(), &st) < 0)
+    {
+        throwDiskResizeError("Unable to find disk '" + source + "'");
+    }
+
+    if (S_ISBLK(st.st_mode))
+    {
+        // Resized by the storage, the domain sees its current size when it starts
+        int fd = open(source.c_str(), O_RDONLY);
+        off_t size = (fd < 0 ? -1 : lseek(fd, 0, SEEK_END));
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+
+        if (size < 0 || (unsigned long long) size < bytes)
+        {
+            throwDiskResizeError("Device '" + source + "' is smaller than the requested size");
+        }
+
+        LOG("Device '%s' already has %lld bytes, nothing to resize", source.c_str(), (long long) size);
+        return;
+    }
+
+    unsigned long long size = 0;
+
+    if (format.empty() || format == "raw")
+    {
+        if (bytes < (unsigned long long) st.st_size)
+        {
+            throwShrinkError(source, st.st_size, bytes);
+        }
+
+        LOG("Resizing raw disk '%s' to %llu bytes", source.c_str(), bytes);
+        if (truncate(source.c_str(), bytes) < 0 || stat(source.c_str(), &st) < 0)
+        {
+            throwDiskResizeError("Unable to resize disk '" + source + "'");
+        }
+        size = st.st_size;
+    }
+    else if (format == "qcow2")
+    {
+        if (!getQcow2Size(source, size))
+        {
+            throwDiskResizeError("Unable to read the header of disk '" + source + "'");
+        }
+
+        if (bytes < size)
+        {
+            throwShrinkError(source, size, bytes);
+        }
+
+        ostringstream newSize;
+        newSize << bytes;
+
+        vector<string> command;
+        command.push_back("qemu-img");
+        command.push_back("resize");
+        command.push_back("-f");
+        command.push_back("qcow2");
+        command.push_back(source);
+        command.push_back(newSize.str());
+
+        if (executeProgram(command, true) != 0)
+        {
+            throwDiskResizeError("Unable to resize disk '" + source + "' with qemu-img");
+        }
+
+        if (!getQcow2Size(source, size))
+        {
+            throwDiskResizeError("Unable to read the header of disk '" + source + "'");
+        }
+    }
+    else
+    {
+        throwDiskResizeError("Disks in " + format + " format can not be resized while the domain is stopped");
+    }
+
+    if (size < bytes || size - bytes >= 512)
+    {
+        ostringstream message;
+        message << "Disk '" << source << "' has " << size << " bytes after resizing it to " << bytes;
+        throwDiskResizeError(message.str());
+    }
+
+    LOG("Disk '%s' resized to %llu bytes", source.c_str(), size);
+}
+
 void LibvirtService::resizeDisk(const virConnectPtr conn, const std::string& domainUUID, 
         const std::string& diskPath, const double diskSizeInKb) throw (LibvirtException)
 {
     LOG("Resize disk '%s' of domain '%s' to %f Kb", diskPath.c_str(), domainUUID.c_str(), diskSizeInKb);
 
-    virDomainInfo info;
     virDomainPtr domain = getDomainByUUID(conn, domainUUID);
 
-    // [ABICLOUDPREMIUM-5486] In the CentOS 6 libvirt version (0.10.2-18)
-    // it seems that disks can not be resized if the domain is not running.
-    // Just make sure the domain is running before resizing and restore it afterwards.
-    if (virDomainGetInfo(domain, &info) < 0)
+    // Paused domains are active too, their disks are resized online
+    int active = virDomainIsActive(domain);
+    if (active < 0)
     {
         virDomainFree(domain);
         throwLastKnownError();
     }
 
-    DomainState::type state = toDomainState(info.state);
-    bool running = (state == DomainState::ON);
+    bool running = (active == 1);
+
+    // Stopped domains get their local disks resized directly, without booting them
+    if (!running)
+    {
+        char *xml = virDomainGetXMLDesc(domain, 0);
+        if (xml == NULL)
+        {
+            virDomainFree(domain);
+            throwLastKnownError();
+        }
+
+        string source, format;
+        bool found = getDiskSource(string(xml), diskPath, source, format);
+        free(xml);
+
+        if (found)
+        {
+            virDomainFree(domain);
+            resizeOfflineDisk(conn, source, format, (unsigned long long) diskSizeInKb * 1024);
+            cache.invalidate(domainUUID);
+            return;
+        }
+    }
 
+    // [ABICLOUDPREMIUM-5486] In the CentOS 6 libvirt version (0.10.2-18)
+    // it seems that disks can not be resized if the domain is not running.
+    // Disks with no local source (network disks) are still resized making sure
+    // the domain is running before resizing and restoring it afterwards.
     if (!running)
     {
         LOG("Domain '%s' is not running. Powering on to resize the disk...", domainUUID.c_str());
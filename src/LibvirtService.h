@@ -24,7 +24,14 @@
 
 #include <string>
 #include <Service.h>
+#include <LibvirtConnectionPool.h>
+#include <DomainCache.h>
+#include <DomainChangeLog.h>
+#include <DomainEventBuffer.h>
+#include <StoragePoolRegistry.h>
+#include <DomainLocks.h>
 #include <aim_types.h>
+#include <boost/thread.hpp>
 #include <libvirt/libvirt.h>
 #include <libvirt/virterror.h>
 
@@ -33,13 +40,84 @@ using namespace std;
 class LibvirtService : public Service
 {
     private:
+        string uri;
+        LibvirtConnectionPool pool;
+
+        // Connections for the queries, so they do not take the read-write ones the mutations need
+        LibvirtConnectionPool readOnlyPool;
+        bool readOnlyQueries;
+        boost::thread eventLoopThread;
+        int eventLoopTimer;
+        int keepAliveInterval;
+        int keepAliveCount;
+
+        // Libvirt domain events, received by a thread that also keeps the domain cache current
+        boost::thread eventsThread;
+        virConnectPtr eventConn;
+        int lifecycleCallback;
+        int jobCallback;
+        int storagePoolCallback;
+
+        DomainCache cache;
+        int cacheReconcileSeconds;
+
+        // Changes notified by the events, for getDomainsChangedSince
+        DomainChangeLog changeLog;
+
+        // Last events, for waitForEvents
+        DomainEventBuffer eventBuffer;
+
+        // Storage pools by source, kept current with the storage pool events
+        StoragePoolRegistry storagePools;
+
+        // Serializes the mutations of each domain
+        DomainLocks domainLocks;
+
+        LibvirtConnectionPool& queryPool();
+
+        void runEventLoop();
+        void runDomainEvents();
+        bool registerDomainEvents();
+        void deregisterDomainEvents();
+        bool reconcileDomainCache();
+        void refreshDomainCache(const set<string>& uuids);
+        bool reconcileStoragePools();
+        void refreshStoragePools();
+
+        static int domainLifecycleEvent(virConnectPtr conn, virDomainPtr domain, int event, int detail, void *opaque);
+        static void domainJobCompletedEvent(virConnectPtr conn, virDomainPtr domain, virTypedParameterPtr params,
+                int nparams, void *opaque);
+        static void storagePoolLifecycleEvent(virConnectPtr conn, virStoragePoolPtr pool, int event, int detail,
+                void *opaque);
+        static void eventConnectionClosed(virConnectPtr conn, int reason, void *opaque);
+        void pushDomainEvent(virDomainPtr domain, const DomainEventType::type type, int detail);
+
         virDomainPtr getDomainByUUID(virConnectPtr conn, const string& uuid) throw (LibvirtException);
         DomainInfo getDomainInfo(const virConnectPtr conn, const virDomainPtr domain) throw (LibvirtException);
+        DomainInfo getDomainInfo(const virConnectPtr conn, const virDomainPtr domain, DomainState::type& state) throw (LibvirtException);
+        void listDomains(vector<CachedDomain>& _return, const virConnectPtr conn, const DomainFields::type fields)
+            throw (LibvirtException);
+#if LIBVIR_VERSION_NUMBER >= 1002008
+        bool readDomainStats(const virDomainStatsRecordPtr record, const DomainFields::type fields, CachedDomain& domain);
+#endif
         DomainState::type toDomainState(unsigned char state);
-        void defineStoragePool(const virConnectPtr conn, const std::string& xmlDesc) throw (LibvirtException);
+        void defineStoragePool(const virConnectPtr conn, const std::string& xmlDesc, const std::string& key)
+            throw (LibvirtException);
+        bool existStoragePool(const virConnectPtr conn, unsigned int type, const std::string& key)
+            throw (LibvirtException);
+        string getStoragePoolKey(const std::string& xmlDesc);
 
         bool existPrimaryDisk(const DomainInfo& domainInfo);
 
+        // Whether the domain is shut off (or gone, if it was transient), on a query connection
+        bool isShutOff(const std::string& domainUUID) throw (LibvirtException);
+
+        // Resize of the disks of the domains that are not running
+        bool getDiskSource(const std::string& xmlDesc, const std::string& diskPath, std::string& source,
+                std::string& format);
+        void resizeOfflineDisk(const virConnectPtr conn, const std::string& source, const std::string& format,
+                unsigned long long bytes) throw (LibvirtException);
+
         string parseDevicePath(const std::string& xmlDesc);
         string parseTargetPath(const std::string& xmlDesc);
         void parseSourceHostAndDir(const std::string& xmlDesc, std::string& host, std::string& dir);
@@ -58,16 +136,28 @@ class LibvirtService : public Service
         virtual bool stop();
 
         // Connection
-        virConnectPtr connect() throw (LibvirtException);       // Open a LOCAL connection
-        void disconnect(const virConnectPtr conn);                    // Closes the given connection
+        virConnectPtr connect() throw (LibvirtException);       // Borrow a LOCAL connection from the pool
+        void disconnect(const virConnectPtr conn);                    // Returns the given connection to the pool
+        virConnectPtr connectReadOnly() throw (LibvirtException);  // Borrow a connection for queries
+        void disconnectReadOnly(const virConnectPtr conn);            // Returns a connection borrowed for queries
+
+        // Lock table of the domain mutations, by UUID
+        DomainLocks& getDomainLocks() { return domainLocks; }
 
         // Utils
+        string getDomainUUID(const std::string& xmlDesc);
         bool comparePaths(const std::string& one, const std::string& other);
         bool endsWith(const std::string& value, const std::string& end);
 
         // Libvirt facade methods
         void getNodeInfo(NodeInfo& _return, const virConnectPtr conn) throw (LibvirtException);
         void getDomains(std::vector<DomainInfo> & _return, const virConnectPtr conn) throw (LibvirtException);
+        void getDomainsLite(std::vector<DomainInfo> & _return, const virConnectPtr conn) throw (LibvirtException);
+        void getDomains(std::vector<DomainInfo> & _return, const DomainFields::type fields, const virConnectPtr conn)
+            throw (LibvirtException);
+        void getDomainsChangedSince(DomainChanges& _return, const int64_t generation, const DomainFields::type fields,
+                const virConnectPtr conn) throw (LibvirtException);
+        void waitForEvents(DomainEvents& _return, const int64_t sinceId, const int32_t timeoutMs);
         void defineDomain(const virConnectPtr conn, const std::string& xmlDesc) throw (LibvirtException);
         void undefineDomain(const virConnectPtr conn, const std::string& domainUUID) throw (LibvirtException);
         bool existDomain(const virConnectPtr conn, const std::string& domainUUID);
@@ -76,6 +166,11 @@ class LibvirtService : public Service
         void powerOn(const virConnectPtr conn, const std::string& domainUUID) throw (LibvirtException);
         void powerOff(const virConnectPtr conn, const std::string& domainUUID) throw (LibvirtException);
         void shutdown(const virConnectPtr conn, const std::string& domainUUID) throw (LibvirtException);
+
+        // Shut down and wait for the domain to stop, destroying it when the timeout expires. It borrows a
+        // connection for each call to libvirt, so none is held while waiting
+        void shutdownWithDeadline(const std::string& domainUUID, int timeoutSec, DomainResult& _return)
+            throw (LibvirtException);
         void reset(const virConnectPtr conn, const std::string& domainUUID) throw (LibvirtException);
         void pause(const virConnectPtr conn, const std::string& domainUUID) throw (LibvirtException);
         void resume(const virConnectPtr conn, const std::string& domainUUID) throw (LibvirtException);
@@ -23,9 +23,11 @@ MetricCollector::MetricCollector() { }
 
 MetricCollector::~MetricCollector() { }
 
-int MetricCollector::initialize(int collectFrequencySecs, int refreshFrequencySecs, const char *databaseFile)
+int MetricCollector::initialize(int collectFrequencySecs, int refreshFrequencySecs, const char *databaseFile,
+        const char *libvirtUri)
 {
     database = string(databaseFile);
+    uri = string(libvirtUri);
     collect_frequency = collectFrequencySecs;
     refresh_frequency = refreshFrequencySecs;
     if (collect_frequency < MIN_COLLECT_FREQ_SECS) {
@@ -105,7 +107,7 @@ void MetricCollector::parse_dev_attribute(pugi::xml_document &doc, const char *x
 
 void MetricCollector::refresh(vector<Domain> &domains)
 {
-    virConnectPtr conn = virConnectOpenReadOnly(NULL);
+    virConnectPtr conn = virConnectOpenReadOnly(uri.empty() ? NULL : uri.c_str());
     if (conn != NULL) {
         virDomainPtr *domainsPtr;
         int nr_domains = virConnectListAllDomains(conn, &domainsPtr, 0);
@@ -207,7 +209,7 @@ void MetricCollector::read_statistics(vector<Domain> domains)
 {
     boost::mutex::scoped_lock lock(db_mutex);
 
-    virConnectPtr conn = virConnectOpenReadOnly(NULL);
+    virConnectPtr conn = virConnectOpenReadOnly(uri.empty() ? NULL : uri.c_str());
     if (conn != NULL)
     {
         LOG("Collecting domain statistics...");
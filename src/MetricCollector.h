@@ -63,6 +63,9 @@ class MetricCollector : private boost::noncopyable
         int refresh_frequency;
         string database;
 
+        /** Libvirt URI (empty for the default one) */
+        string uri;
+
         struct Domain
         {
             string uuid;
@@ -114,7 +117,7 @@ class MetricCollector : private boost::noncopyable
         MetricCollector();
         ~MetricCollector();
         
-        int initialize(int collectFrequencySecs, int refreshFrequencySecs, const char *databaseFile);
+        int initialize(int collectFrequencySecs, int refreshFrequencySecs, const char *databaseFile, const char *libvirtUri);
         void run();
         void get_datapoints(string &name, int start, vector<Measure> &_return);
 };
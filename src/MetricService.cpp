@@ -9,8 +9,9 @@ bool MetricService::initialize(INIReader configuration)
     int collectFreq = configuration.GetInteger("stats", "collectFreqSeconds", 60);
     int refreshFreq = configuration.GetInteger("stats", "refreshFreqSeconds", 30);
     string database = configuration.Get("stats", "database", "/var/lib/abiquo-aim.db");
+    string uri = configuration.Get("libvirt", "uri", "");
 
-    if (collector.initialize(collectFreq, refreshFreq, database.c_str()) != COLLECTOR_OK) {
+    if (collector.initialize(collectFreq, refreshFreq, database.c_str(), uri.c_str()) != COLLECTOR_OK) {
         return false;
     }
 
@@ -0,0 +1,258 @@
+#include <RequestStats.h>
+
+#include <string.h>
+#include <sys/time.h>
+
+struct CallContext
+{
+    MethodCounters* method;
+    uint64_t start;
+};
+
+static uint64_t currentMicros()
+{
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return (uint64_t) now.tv_sec * 1000000 + now.tv_usec;
+}
+
+static unsigned int bucketOf(uint64_t micros)
+{
+    if (micros < SUB_BUCKETS)
+    {
+        return micros;
+    }
+
+    int shift = (63 - __builtin_clzll(micros)) - SUB_BUCKET_BITS;
+    unsigned int bucket = (shift + 1) * SUB_BUCKETS + ((micros >> shift) & (SUB_BUCKETS - 1));
+
+    return bucket < HISTOGRAM_BUCKETS ? bucket : HISTOGRAM_BUCKETS - 1;
+}
+
+// Highest value of the bucket
+static uint64_t bucketValue(unsigned int bucket)
+{
+    if (bucket < SUB_BUCKETS)
+    {
+        return bucket;
+    }
+
+    int shift = bucket / SUB_BUCKETS - 1;
+    uint64_t lowest = (uint64_t) (SUB_BUCKETS + bucket % SUB_BUCKETS) << shift;
+
+    return lowest + ((uint64_t) 1 << shift) - 1;
+}
+
+static double percentile(const uint64_t* buckets, uint64_t total, double percent)
+{
+    if (total == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = (uint64_t) (total * percent / 100.0 + 0.5);
+    rank = rank > 0 ? rank : 1;
+
+    uint64_t count = 0;
+    for (unsigned int i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        count += buckets[i];
+        if (count >= rank)
+        {
+            return bucketValue(i) / 1000.0;
+        }
+    }
+
+    return bucketValue(HISTOGRAM_BUCKETS - 1) / 1000.0;
+}
+
+RequestStats::RequestStats() : lanes(NULL), watchdog(NULL)
+{
+    methods = new MethodCounters[MAX_METHODS];
+    memset((void*) methods, 0, sizeof(MethodCounters) * MAX_METHODS);
+    started = time(NULL);
+}
+
+RequestStats::~RequestStats()
+{
+    delete[] methods;
+}
+
+void RequestStats::setSources(LaneProcessor* laneProcessor,
+        boost::shared_ptr< ::apache::thrift::concurrency::ThreadManager> serverThreadManager)
+{
+    lanes = laneProcessor;
+    threadManager = serverThreadManager;
+}
+
+MethodCounters* RequestStats::getMethod(const char* name, bool add)
+{
+    // Open addressing. Names are string literals of the generated processor, so they can be kept
+    unsigned int hash = 5381;
+    for (const char* c = name; *c != '\0'; c++)
+    {
+        hash = hash * 33 + *c;
+    }
+
+    for (unsigned int i = 0; i < MAX_METHODS; i++)
+    {
+        MethodCounters* method = &methods[(hash + i) % MAX_METHODS];
+        const char* current = method->name;
+
+        if (current == NULL && !add)
+        {
+            return NULL;
+        }
+
+        if (current == NULL)
+        {
+            current = __sync_val_compare_and_swap(&method->name, (const char*) NULL, name);
+            if (current == NULL)
+            {
+                return method;
+            }
+        }
+
+        if (strcmp(current, name) == 0)
+        {
+            return method;
+        }
+    }
+
+    return NULL;
+}
+
+void* RequestStats::getContext(const char* fn_name, void* serverContext)
+{
+    MethodCounters* method = getMethod(fn_name, true);
+    if (method == NULL)
+    {
+        return NULL;
+    }
+
+    __sync_fetch_and_add(&method->inFlight, 1);
+
+    CallContext* context = new CallContext();
+    context->method = method;
+    context->start = currentMicros();
+    return context;
+}
+
+void RequestStats::freeContext(void* ctx, const char* fn_name)
+{
+    CallContext* context = static_cast<CallContext*>(ctx);
+    if (context == NULL)
+    {
+        return;
+    }
+
+    MethodCounters* method = context->method;
+    uint64_t now = currentMicros();
+    uint64_t elapsed = now > context->start ? now - context->start : 0;
+
+    __sync_fetch_and_add(&method->buckets[bucketOf(elapsed)], 1);
+    __sync_fetch_and_add(&method->calls, 1);
+    __sync_fetch_and_sub(&method->inFlight, 1);
+
+    uint64_t max = method->maxMicros;
+    while (elapsed > max)
+    {
+        uint64_t previous = __sync_val_compare_and_swap(&method->maxMicros, max, elapsed);
+        if (previous == max)
+        {
+            break;
+        }
+        max = previous;
+    }
+
+    delete context;
+}
+
+void RequestStats::handlerError(void* ctx, const char* fn_name)
+{
+    CallContext* context = static_cast<CallContext*>(ctx);
+    if (context != NULL)
+    {
+        __sync_fetch_and_add(&context->method->errors, 1);
+    }
+}
+
+void RequestStats::declaredError(const string& fname)
+{
+    string name = "Aim." + fname;
+    MethodCounters* method = getMethod(name.c_str(), false);
+
+    if (method != NULL)
+    {
+        __sync_fetch_and_add(&method->errors, 1);
+    }
+}
+
+void RequestStats::getServerStats(ServerStats& _return)
+{
+    _return.uptimeSeconds = time(NULL) - started;
+    _return.inFlight = 0;
+    _return.errors = 0;
+
+    uint64_t buckets[HISTOGRAM_BUCKETS];
+
+    for (unsigned int i = 0; i < MAX_METHODS; i++)
+    {
+        MethodCounters* method = &methods[i];
+        if (method->name == NULL)
+        {
+            continue;
+        }
+
+        // The histogram is copied without stopping the writers, so it may not add up exactly to calls
+        uint64_t total = 0;
+        for (unsigned int j = 0; j < HISTOGRAM_BUCKETS; j++)
+        {
+            buckets[j] = method->buckets[j];
+            total += buckets[j];
+        }
+
+        // Skip the "Aim." prefix
+        const char* name = strchr(method->name, '.');
+
+        MethodStats stats;
+        stats.name = string(name == NULL ? method->name : name + 1);
+        stats.calls = method->calls;
+        stats.errors = method->errors;
+        stats.inFlight = method->inFlight;
+        stats.p50Ms = percentile(buckets, total, 50);
+        stats.p99Ms = percentile(buckets, total, 99);
+        stats.maxMs = method->maxMicros / 1000.0;
+
+        _return.inFlight += stats.inFlight;
+        _return.errors += stats.errors;
+        _return.methods.push_back(stats);
+    }
+
+    _return.queueDepth = 0;
+    _return.shed = 0;
+
+    if (lanes != NULL)
+    {
+        _return.shed = lanes->getLaneStats(_return.lanes);
+
+        for (vector<LaneStats>::const_iterator it = _return.lanes.begin(); it != _return.lanes.end(); ++it)
+        {
+            _return.queueDepth += it->queued;
+        }
+    }
+
+    _return.timedOut = 0;
+    _return.stuck = 0;
+
+    if (watchdog != NULL)
+    {
+        _return.timedOut = watchdog->getWatchdogStats(_return.stuck);
+    }
+
+    // Requests read but not yet taken by a server thread
+    if (threadManager.get() != NULL)
+    {
+        _return.queueDepth += threadManager->pendingTaskCount();
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef REQUEST_STATS_H
+#define REQUEST_STATS_H
+
+#include <vector>
+
+#include <thrift/TProcessor.h>
+#include <thrift/concurrency/ThreadManager.h>
+
+#include <LaneProcessor.h>
+#include <DeadlineProcessor.h>
+#include <aim_types.h>
+
+// Latencies are recorded in microseconds, in log-linear buckets: values below
+// 2^SUB_BUCKET_BITS have their own bucket, and each power of two above is split
+// in 2^SUB_BUCKET_BITS buckets (12.5% precision)
+#define SUB_BUCKET_BITS         3
+#define SUB_BUCKETS             (1 << SUB_BUCKET_BITS)
+#define HISTOGRAM_BUCKETS       (SUB_BUCKETS * 38)
+
+// Slots of the method table, more than the methods of the Aim service
+#define MAX_METHODS             256
+
+using namespace std;
+
+struct MethodCounters
+{
+    const char* name;
+    volatile uint64_t calls;
+    volatile uint64_t errors;
+    volatile int64_t inFlight;
+    volatile uint64_t maxMicros;
+    volatile uint64_t buckets[HISTOGRAM_BUCKETS];
+};
+
+/*
+ * Per method request counters and latency histograms.
+ *
+ * Registered as the event handler of the processor, so it is called around
+ * every request. Counters are only updated with atomic operations, and
+ * methods get their slot the first time they are called.
+ */
+class RequestStats : public ::apache::thrift::TProcessorEventHandler
+{
+    protected:
+        MethodCounters* methods;
+        time_t started;
+
+        LaneProcessor* lanes;
+        DeadlineProcessor* watchdog;
+        boost::shared_ptr< ::apache::thrift::concurrency::ThreadManager> threadManager;
+
+        // Slot of the method, taking a free one if it has none and add is set
+        MethodCounters* getMethod(const char* name, bool add);
+
+    public:
+        RequestStats();
+        virtual ~RequestStats();
+
+        // Where the queued requests are read from
+        void setSources(LaneProcessor* laneProcessor,
+                boost::shared_ptr< ::apache::thrift::concurrency::ThreadManager> serverThreadManager);
+
+        // Where the timed out requests are read from
+        void setWatchdog(DeadlineProcessor* deadlineProcessor) { watchdog = deadlineProcessor; }
+
+        void getServerStats(ServerStats& _return);
+
+        // Count a declared exception (or a request shed or timed out) as an error of the method. Methods never
+        // called before are not counted, so unknown names do not take a slot
+        void declaredError(const string& fname);
+
+        // TProcessorEventHandler
+        virtual void* getContext(const char* fn_name, void* serverContext);
+        virtual void freeContext(void* ctx, const char* fn_name);
+        virtual void handlerError(void* ctx, const char* fn_name);
+};
+
+#endif
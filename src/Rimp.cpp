@@ -7,9 +7,10 @@
 #include <string>
 #include <fstream>
 #include <aim_types.h>
+#include <zlib.h>
 
 
-Rimp::Rimp() : Service("Rimp")
+Rimp::Rimp() : Service("Rimp"), maxChunkSize(DEFAULT_MAX_CHUNK_SIZE)
 {
 }
 
@@ -19,11 +20,15 @@ Rimp::~Rimp()
 
 bool Rimp::start()
 {
+    jobs.start();
+    uploads.start();
     return true;
 }
 
 bool Rimp::stop()
 {
+    jobs.stop();
+    uploads.stop();
     return true;
 }
 
@@ -53,6 +58,12 @@ bool Rimp::initialize(INIReader configuration)
     autobackup = configuration.GetBoolean("rimp", "autoBackup", false);
     autorestore = configuration.GetBoolean("rimp", "autoRestore", false);
     string dsTypes = configuration.Get("rimp", "datastoreValidTypes", "");
+    int copyWorkers = configuration.GetInteger("rimp", "copyWorkers", DEFAULT_COPY_WORKERS);
+    int jobRetentionSeconds = configuration.GetInteger("rimp", "jobRetentionSeconds", DEFAULT_JOB_RETENTION);
+    int uploadTimeoutSeconds = configuration.GetInteger("rimp", "uploadTimeoutSeconds", DEFAULT_UPLOAD_TIMEOUT);
+    string paths = configuration.Get("rimp", "datastorePaths", "");
+    maxChunkSize = configuration.GetInteger("rimp", "maxChunkSize", DEFAULT_MAX_CHUNK_SIZE);
+    maxChunkSize = (maxChunkSize > 0 ? maxChunkSize : DEFAULT_MAX_CHUNK_SIZE);
 
     if (repository.size() < 2)
     {
@@ -77,6 +88,12 @@ bool Rimp::initialize(INIReader configuration)
         boost::split(validTypes, dsTypes, boost::is_any_of(","));
     }
 
+    datastorePaths.clear();
+    if (paths.size() > 0)
+    {
+        boost::split(datastorePaths, paths, boost::is_any_of(","));
+    }
+
     // Print config values
     LOG("[DEBUG] Repository: '%s'", repository.c_str());
     LOG("[DEBUG] Auto-backup: %s", autobackup ? "on" : "off");
@@ -93,6 +110,9 @@ bool Rimp::initialize(INIReader configuration)
     ss << validTypes.back();
 
     LOG("[DEBUG] Valid device types to filter datastores: %s", ss.str().c_str());
+
+    jobs.initialize(copyWorkers, jobRetentionSeconds);
+    uploads.initialize(uploadTimeoutSeconds, maxChunkSize);
     return true;
 }
 
@@ -149,8 +169,8 @@ int64_t Rimp::getDiskFileSize(const std::string& virtualImageDatastorePath)
 }
 
 
-void Rimp::copyFromRepositoryToDatastore(const std::string& virtualImageRepositoryPath, std::string& datastore,
-        const std::string& virtualMachineUUID)
+bool Rimp::prepareCopyFromRepositoryToDatastore(const std::string& virtualImageRepositoryPath, std::string& datastore,
+        const std::string& virtualMachineUUID, string& viRepositoryPath, string& viDatastorePath)
 {
     string error("");
     RimpException rexception;
@@ -173,7 +193,7 @@ void Rimp::copyFromRepositoryToDatastore(const std::string& virtualImageReposito
     LOG("[DEBUG] [RIMP] Instantiating virtual image [%s] for virtual machine [%s]",
             virtualImageRepositoryPath.c_str(), virtualMachineUUID.c_str());
 
-    string viRepositoryPath(repository);
+    viRepositoryPath = repository;
     viRepositoryPath = viRepositoryPath.append(virtualImageRepositoryPath);
 
     // Check the source file (on the repository) exist and can be read
@@ -189,7 +209,7 @@ void Rimp::copyFromRepositoryToDatastore(const std::string& virtualImageReposito
     unsigned long int viSize = getFileSize(viRepositoryPath);
 
     /** Copy from ''Local Repository'' to ''Datastore''. */
-    string viDatastorePath(datastore);
+    viDatastorePath = datastore;
     viDatastorePath = viDatastorePath.append(virtualMachineUUID);
 
     // if the file exist on the datastore delete it
@@ -201,7 +221,7 @@ void Rimp::copyFromRepositoryToDatastore(const std::string& virtualImageReposito
             // NOTE: You really do want this, don't over think it.
 
             LOG("[INFO] [RIMP] Not checking for backup; existing virtual image instance found for virtual machine [%s]", virtualMachineUUID.c_str());
-            return;
+            return false;
         }
 
         LOG("[WARNING] [RIMP] File with the same UUID already present on the ''datastore'' [%s], removing it.",
@@ -230,7 +250,7 @@ void Rimp::copyFromRepositoryToDatastore(const std::string& virtualImageReposito
             }
 
             LOG("[INFO] [RIMP] Recovered virtual image instance for virtual machine [%s]", virtualMachineUUID.c_str());
-            return;
+            return false;
         }
     }
 
@@ -247,6 +267,22 @@ void Rimp::copyFromRepositoryToDatastore(const std::string& virtualImageReposito
         throw rexception;
     }
 
+    return true;
+}
+
+void Rimp::copyFromRepositoryToDatastore(const std::string& virtualImageRepositoryPath, std::string& datastore,
+        const std::string& virtualMachineUUID)
+{
+    string error("");
+    RimpException rexception;
+    string viRepositoryPath, viDatastorePath;
+
+    if (!prepareCopyFromRepositoryToDatastore(virtualImageRepositoryPath, datastore, virtualMachineUUID, viRepositoryPath,
+            viDatastorePath))
+    {
+        return;
+    }
+
     string copyError2 = fileCopy(viRepositoryPath, viDatastorePath);
 
     if (!copyError2.empty())
@@ -330,8 +366,9 @@ void Rimp::deleteVirtualImageFromDatastore(std::string& datastore, const std::st
     LOG("[INFO] [RIMP] Deleted virtual machine [%s]", virtualMachineUUID.c_str());
 }
 
-void Rimp::copyFromDatastoreToRepository(const std::string& virtualMachineUUID, const std::string& snapshot,
-        const std::string& destinationRepositoryPathIn, const std::string& sourceDatastorePathIn)
+void Rimp::prepareCopyFromDatastoreToRepository(const std::string& virtualMachineUUID, const std::string& snapshot,
+        const std::string& destinationRepositoryPathIn, const std::string& sourceDatastorePathIn, string& viDatastoreSource,
+        string& viRepositoryDestination)
 {
     string error("");
     RimpException rexception;
@@ -376,7 +413,7 @@ void Rimp::copyFromDatastoreToRepository(const std::string& virtualMachineUUID,
         }
     }
 
-    string viDatastoreSource(sourceDatastorePath);
+    viDatastoreSource = sourceDatastorePath;
     viDatastoreSource = viDatastoreSource.append(virtualMachineUUID);
 
     // Check source file exist and can be read
@@ -390,7 +427,7 @@ void Rimp::copyFromDatastoreToRepository(const std::string& virtualMachineUUID,
         throw rexception;
     }
 
-    string viRepositoryDestination(destinationRepositoryPath);
+    viRepositoryDestination = destinationRepositoryPath;
     viRepositoryDestination = viRepositoryDestination.append(snapshot);
 
     // Check target path do not exist
@@ -417,6 +454,17 @@ void Rimp::copyFromDatastoreToRepository(const std::string& virtualMachineUUID,
         rexception.description = error;
         throw rexception;
     }
+}
+
+void Rimp::copyFromDatastoreToRepository(const std::string& virtualMachineUUID, const std::string& snapshot,
+        const std::string& destinationRepositoryPathIn, const std::string& sourceDatastorePathIn)
+{
+    string error("");
+    RimpException rexception;
+    string viDatastoreSource, viRepositoryDestination;
+
+    prepareCopyFromDatastoreToRepository(virtualMachineUUID, snapshot, destinationRepositoryPathIn, sourceDatastorePathIn,
+            viDatastoreSource, viRepositoryDestination);
 
     string errorCopy = fileCopy(viDatastoreSource, viRepositoryDestination);
     if (!errorCopy.empty())
@@ -432,12 +480,12 @@ void Rimp::copyFromDatastoreToRepository(const std::string& virtualMachineUUID,
     LOG("[INFO] [RIMP] Created snapshot [%s] from virtual machine [%s]", snapshot.c_str(), virtualMachineUUID.c_str());
 }
 
-void Rimp::copy(const std::string& source, const std::string& destination)
+void Rimp::prepareCopy(const std::string& source, const std::string& destination, string& fullDestination)
 {
     checkRimpConfiguration();
 
     // Get directory from destination filename
-    string fullDestination = string(repository).append(destination);
+    fullDestination = string(repository).append(destination);
     size_t found = fullDestination.find_last_of("/\\");
     string destinationPath = fullDestination.substr(0, found);
 
@@ -506,6 +554,12 @@ void Rimp::copy(const std::string& source, const std::string& destination)
         rexception.description = error;
         throw rexception;
     }
+}
+
+void Rimp::copy(const std::string& source, const std::string& destination)
+{
+    string fullDestination;
+    prepareCopy(source, destination, fullDestination);
 
     string errorCopy = fileCopy(source, fullDestination);
     if (!errorCopy.empty())
@@ -524,6 +578,271 @@ void Rimp::copy(const std::string& source, const std::string& destination)
      LOG("[RIMP] File '%s' copied", fullDestination.c_str());
 }
 
+string Rimp::startCopyFromRepositoryToDatastore(const std::string& virtualImageRepositoryPath, std::string& datastore,
+        const std::string& virtualMachineUUID)
+{
+    string viRepositoryPath, viDatastorePath;
+
+    if (!prepareCopyFromRepositoryToDatastore(virtualImageRepositoryPath, datastore, virtualMachineUUID, viRepositoryPath,
+            viDatastorePath))
+    {
+        return jobs.done(viDatastorePath);
+    }
+
+    return jobs.submit(viRepositoryPath, viDatastorePath);
+}
+
+string Rimp::startCopyFromDatastoreToRepository(const std::string& virtualMachineUUID, const std::string& snapshot,
+        const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath)
+{
+    string viDatastoreSource, viRepositoryDestination;
+
+    prepareCopyFromDatastoreToRepository(virtualMachineUUID, snapshot, destinationRepositoryPath, sourceDatastorePath,
+            viDatastoreSource, viRepositoryDestination);
+
+    return jobs.submit(viDatastoreSource, viRepositoryDestination);
+}
+
+string Rimp::startCopy(const std::string& source, const std::string& destination)
+{
+    string fullDestination;
+    prepareCopy(source, destination, fullDestination);
+
+    return jobs.submit(source, fullDestination);
+}
+
+JobStatus Rimp::getJobStatus(const std::string& jobId)
+{
+    JobStatus status;
+
+    if (!jobs.getStatus(jobId, status))
+    {
+        string error("Unknown copy job: ");
+        error = error.append(jobId);
+        LOG("[ERROR] [RIMP] %s", error.c_str());
+
+        RimpException rexception;
+        rexception.description = error;
+        throw rexception;
+    }
+
+    return status;
+}
+
+void Rimp::cancelJob(const std::string& jobId)
+{
+    if (!jobs.cancel(jobId))
+    {
+        string error("Unknown copy job: ");
+        error = error.append(jobId);
+        LOG("[ERROR] [RIMP] %s", error.c_str());
+
+        RimpException rexception;
+        rexception.description = error;
+        throw rexception;
+    }
+}
+
+static void checkError(const string& error)
+{
+    if (!error.empty())
+    {
+        LOG("[ERROR] [RIMP] %s", error.c_str());
+
+        RimpException rexception;
+        rexception.description = error;
+        throw rexception;
+    }
+}
+
+string Rimp::openUpload(const std::string& path, int64_t size)
+{
+    char resolved[PATH_MAX];
+
+    // The file does not exist yet, so its directory is the one resolved
+    size_t slash = path.find_last_of('/');
+    string name = (slash == string::npos ? path : path.substr(slash + 1));
+    string directory = (slash == string::npos || slash == 0 ? string("/") : path.substr(0, slash));
+
+    if (name.empty() || name == "." || name == "..")
+    {
+        checkError(string("Invalid upload path: ").append(path));
+    }
+
+    if (realpath(directory.c_str(), resolved) == NULL)
+    {
+        checkError(string("Can not write ").append(path).append(": ").append(strerror(errno)));
+    }
+
+    string target(resolved);
+    target = target.append(target.at(target.size() - 1) == '/' ? "" : "/").append(name);
+
+    if (!isTransferable(target))
+    {
+        checkError(string("Can not write ").append(path).append(": not in the repository or a datastore"));
+    }
+
+    string id;
+    checkError(uploads.open(target, size, id));
+    return id;
+}
+
+void Rimp::writeChunk(const std::string& uploadId, int64_t offset, const std::string& data)
+{
+    checkError(uploads.write(uploadId, offset, data));
+}
+
+void Rimp::commitUpload(const std::string& uploadId, int64_t crc)
+{
+    checkError(uploads.commit(uploadId, (unsigned long) crc));
+}
+
+void Rimp::abortUpload(const std::string& uploadId)
+{
+    checkError(uploads.abort(uploadId));
+}
+
+bool Rimp::isTransferable(const string& resolvedPath)
+{
+    vector<string> roots = getDatastoreMountPoints(validTypes);
+    roots.insert(roots.end(), datastorePaths.begin(), datastorePaths.end());
+    roots.push_back(repository);
+
+    for (vector<string>::const_iterator it = roots.begin(); it != roots.end(); ++it)
+    {
+        char resolvedRoot[PATH_MAX];
+
+        if (realpath(it->c_str(), resolvedRoot) != NULL)
+        {
+            string root(resolvedRoot);
+
+            if (root.at(root.size() - 1) != '/')
+            {
+                root = root.append("/");
+            }
+
+            if (boost::starts_with(resolvedPath, root))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void Rimp::readChunk(FileChunk& _return, const std::string& path, int64_t offset, int32_t length, bool compress)
+{
+    char resolved[PATH_MAX];
+    string error;
+
+    if (offset < 0 || length <= 0 || length > maxChunkSize)
+    {
+        checkError(string("Invalid chunk of ").append(path));
+    }
+
+    // Symbolic links and '..' are resolved before checking where the file is
+    if (realpath(path.c_str(), resolved) == NULL)
+    {
+        checkError(string("Can not read ").append(path).append(": ").append(strerror(errno)));
+    }
+
+    if (!isTransferable(resolved))
+    {
+        checkError(string("Can not read ").append(path).append(": not in the repository or a datastore"));
+    }
+
+    int fd = open(resolved, O_RDONLY);
+    if (fd == -1)
+    {
+        checkError(string("Can not read ").append(path).append(": ").append(strerror(errno)));
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == -1 || !S_ISREG(info.st_mode))
+    {
+        close(fd);
+        checkError(string("Can not read ").append(path).append(": not a regular file"));
+    }
+
+    // Plain chunks are read straight into the reply, only the ones to compress go through the buffer
+    char* data;
+    vector<char>* buffer = NULL;
+
+    if (compress)
+    {
+        buffer = readBuffers.get();
+        if (buffer == NULL)
+        {
+            buffer = new vector<char>();
+            readBuffers.reset(buffer);
+        }
+
+        if ((int32_t) buffer->size() < length)
+        {
+            buffer->resize(length);
+        }
+
+        data = &(*buffer)[0];
+    }
+    else
+    {
+        _return.data.resize(length);
+        data = &_return.data[0];
+    }
+
+    int32_t bytes = 0;
+    while (bytes < length)
+    {
+        ssize_t ret = pread(fd, data + bytes, length - bytes, offset + bytes);
+        if (ret == 0)
+        {
+            break;
+        }
+        if (ret == -1)
+        {
+            if (errno != EINTR)
+            {
+                error = string("Can not read ").append(path).append(": ").append(strerror(errno));
+                break;
+            }
+            continue;
+        }
+
+        bytes += ret;
+    }
+
+    close(fd);
+    checkError(error);
+
+    _return.fileSize = info.st_size;
+    _return.length = bytes;
+    _return.compressed = false;
+
+    if (!compress)
+    {
+        _return.data.resize(bytes);
+        return;
+    }
+
+    if (bytes > 0)
+    {
+        uLongf size = compressBound(bytes);
+        _return.data.resize(size);
+
+        if (compress2((Bytef*) &_return.data[0], &size, (const Bytef*) data, bytes, Z_BEST_SPEED) == Z_OK
+                && size < (uLongf) bytes)
+        {
+            _return.data.resize(size);
+            _return.compressed = true;
+            return;
+        }
+    }
+
+    // Not worth compressing
+    _return.data.assign(data, bytes);
+}
+
 void Rimp::rename(const std::string& oldPath, const std::string& newPath)
 {
     LOG("[RIMP] Moving '%s' to '%s'", oldPath.c_str(), newPath.c_str());
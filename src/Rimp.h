@@ -25,7 +25,10 @@
 #include <Service.h>
 #include <vector>
 #include <aim_types.h>
+#include <CopyJobs.h>
+#include <Uploads.h>
 #include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
 
 class Rimp: public Service
 {
@@ -46,6 +49,38 @@ protected:
     /** Mutex for sync the getDatastores method access **/
     boost::mutex get_datastores_mutex;
 
+    /** Copies started with the ''start*'' methods, run by their own worker threads **/
+    CopyJobs jobs;
+
+    /** Files being uploaded in chunks **/
+    Uploads uploads;
+
+    /** Maximum size of the chunks uploaded and downloaded **/
+    int64_t maxChunkSize;
+
+    /** Datastore directories on the root file system. Files can only be read (''readChunk'') from and uploaded
+     * (''openUpload'') to them, the mounted datastores and the repository **/
+    vector<string> datastorePaths;
+
+    /** Buffer of each server thread to read the chunks to compress **/
+    boost::thread_specific_ptr<vector<char> > readBuffers;
+
+    /** @return true if the (resolved) path is inside the repository or a datastore **/
+    bool isTransferable(const string& resolvedPath);
+
+    /**
+     * Checks and preparation done before each kind of copy. They return the source and destination paths of the file
+     * to copy and throw RimpException if the copy can not be done.
+     * */
+    bool prepareCopyFromRepositoryToDatastore(const std::string& virtualImageRepositoryPath, std::string& datastorePath,
+            const std::string& virtualMachineUUID, string& source, string& destination);
+
+    void prepareCopyFromDatastoreToRepository(const std::string& virtualMachineUUID, const std::string& snapshot,
+            const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath, string& source,
+            string& destination);
+
+    void prepareCopy(const std::string& source, const std::string& destination, string& fullDestination);
+
 public:
     Rimp();
     ~Rimp();
@@ -128,6 +163,63 @@ public:
     virtual void rename(const std::string& oldPath, const std::string& newPath);
 
     virtual void dumpToFile(const std::string& data, const std::string& destination);
+
+    /**
+     * Asynchronous versions of the copies. The same checks are done before returning
+     * and the copy itself is queued.
+     *
+     * @return the id of the copy job, to be used in ''getJobStatus'' and ''cancelJob''.
+     *
+     * @throws RimpException, if the copy can not be done.
+     * */
+    virtual string startCopyFromRepositoryToDatastore(const std::string& virtualImageRepositoryPath,
+            std::string& datastorePath, const std::string& virtualMachineUUID);
+
+    virtual string startCopyFromDatastoreToRepository(const std::string& virtualMachineUUID, const std::string& snapshot,
+            const std::string& destinationRepositoryPath, const std::string& sourceDatastorePath);
+
+    virtual string startCopy(const std::string& source, const std::string& destination);
+
+    /**
+     * @return the progress of a copy job.
+     *
+     * @throws RimpException, if the job does not exist (or finished long ago).
+     * */
+    virtual JobStatus getJobStatus(const std::string& jobId);
+
+    /**
+     * Stops a copy job and removes the partial copy.
+     *
+     * @throws RimpException, if the job does not exist (or finished long ago).
+     * */
+    virtual void cancelJob(const std::string& jobId);
+
+    /**
+     * Upload of a file in chunks: open, write the chunks (in any order) and commit.
+     *
+     * @return the id of the upload, to be used in ''writeChunk'', ''commitUpload'' and ''abortUpload''.
+     *
+     * @throws RimpException, if the file can not be created.
+     * */
+    virtual string openUpload(const std::string& path, int64_t size);
+
+    virtual void writeChunk(const std::string& uploadId, int64_t offset, const std::string& data);
+
+    /**
+     * Moves the uploaded file to its path.
+     *
+     * @throws RimpException, if some chunk is missing or the CRC-32 does not match. The upload is kept open.
+     * */
+    virtual void commitUpload(const std::string& uploadId, int64_t crc);
+
+    virtual void abortUpload(const std::string& uploadId);
+
+    /**
+     * Reads a chunk of a file of the repository or a datastore, optionally compressed.
+     *
+     * @throws RimpException, if the path is out of the repository and the datastores or can not be read.
+     * */
+    virtual void readChunk(FileChunk& _return, const std::string& path, int64_t offset, int32_t length, bool compress);
 };
 
 #endif
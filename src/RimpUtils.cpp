@@ -169,6 +169,47 @@ vector<Datastore> getDatastoresFromMtab(const vector<string> validTypes)
   return datastores;
 }
 
+vector<string> getDatastoreMountPoints(const vector<string> validTypes)
+{
+  vector<string> mountPoints;
+
+  struct mntent ent;
+  char buffer[4096];
+  FILE *mounts = setmntent(MTAB_FILE.c_str(), "r");
+
+  if (mounts == NULL)
+  {
+    return mountPoints;
+  }
+
+  while (getmntent_r(mounts, &ent, buffer, sizeof(buffer)) != NULL)
+  {
+    string type(ent.mnt_type);
+    string directory(ent.mnt_dir);
+
+    bool found = false;
+    for (int i = 0; (i < (int) validTypes.size()) && !found; i++)
+    {
+      found = (validTypes[i].compare(type) == 0);
+    }
+
+    if (found && directory.compare("/") && directory.compare("/boot")
+        && !boost::starts_with(directory, "/var/lib/libvirt/images/"))
+    {
+      if (directory.at(directory.size() - 1) != '/')
+      {
+        directory = directory.append("/");
+      }
+
+      mountPoints.push_back(directory);
+    }
+  }
+
+  endmntent(mounts);
+
+  return mountPoints;
+}
+
 string getHardwareAddress(const char* devname)
 {
   int sockfd;
@@ -366,6 +407,11 @@ string createTargetDirectory(const string& target)
 }
 
 string fileCopy(const string& source, const string& target)
+{
+  return fileCopy(source, target, CopyProgress());
+}
+
+string fileCopy(const string& source, const string& target, CopyProgress progress)
 {
   string targetCopy(target);
 
@@ -378,23 +424,90 @@ string fileCopy(const string& source, const string& target)
     return error;
   }
 
-  try
+  int in = open(source.c_str(), O_RDONLY);
+  if (in == -1)
   {
-    path psource (source.c_str());
-    path ptarget (target.c_str());
+    return string("Can not open ").append(source).append(": ").append(strerror(errno));
+  }
 
-    copy_file(psource, ptarget);
+  struct stat info;
+  if (fstat(in, &info) == -1)
+  {
+    error = string("Can not read ").append(source).append(": ").append(strerror(errno));
+    close(in);
+    return error;
+  }
 
-  } catch (exception& e)
+  int out = open(target.c_str(), O_WRONLY | O_CREAT | O_EXCL, info.st_mode & 0777);
+  if (out == -1)
   {
-    string error(e.what());
+    error = string("Can not create ").append(target).append(": ").append(strerror(errno));
+    close(in);
     return error;
   }
-  //std::ifstream ifs("input.txt", std::ios::binary);
-  //std::ofstream ofs("output.txt", std::ios::binary);
-  //ofs << ifs.rdbuf();
 
-  return string();
+  vector<char> buffer(COPY_BUFFER_SIZE);
+  int64_t copied = 0;
+
+  while (error.empty())
+  {
+    if (progress && !progress(copied, info.st_size))
+    {
+      error = "Cancelled";
+      break;
+    }
+
+    ssize_t bytes = read(in, &buffer[0], buffer.size());
+    if (bytes == 0)
+    {
+      break;
+    }
+    if (bytes == -1)
+    {
+      if (errno != EINTR)
+      {
+        error = string("Can not read ").append(source).append(": ").append(strerror(errno));
+      }
+      continue;
+    }
+
+    ssize_t written = 0;
+    while (written < bytes)
+    {
+      ssize_t ret = write(out, &buffer[written], bytes - written);
+      if (ret == -1)
+      {
+        if (errno != EINTR)
+        {
+          error = string("Can not write ").append(target).append(": ").append(strerror(errno));
+          break;
+        }
+        continue;
+      }
+      written += ret;
+    }
+
+    copied += written;
+  }
+
+  if (progress && error.empty())
+  {
+    progress(copied, info.st_size);
+  }
+
+  close(in);
+  if (close(out) == -1 && error.empty())
+  {
+    error = string("Can not write ").append(target).append(": ").append(strerror(errno));
+  }
+
+  // Do not leave partial copies behind
+  if (!error.empty())
+  {
+    unlink(target.c_str());
+  }
+
+  return error;
 }
 
 string fileRename(const string& source, const string& target)
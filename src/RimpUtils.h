@@ -50,6 +50,7 @@
 
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/fstream.hpp>
+#include <boost/function.hpp>
 
 #include <uuid/uuid.h>
 
@@ -66,6 +67,15 @@ const string REPOSITORY_MARK = ".abiquo_repository\0";
 /** Datastore folder mark perfix*/
 const string DATASTORE_MARK = "datastoreuuid.\0";
 
+/** Size of the chunks files are copied in */
+#define COPY_BUFFER_SIZE            (1024 * 1024)
+
+/**
+ * Called before each chunk of a copy with the bytes copied so far and the size of the file.
+ * Returning false cancels the copy.
+ */
+typedef boost::function<bool (int64_t copied, int64_t total)> CopyProgress;
+
 /**
  * @return true if the provided ''datastore'' path exist and can be read/write.
  */
@@ -104,6 +114,15 @@ unsigned long int getFileSize(const string& filename);
  */
 string fileCopy(const string& source, const string& target);
 
+/**
+ * Copy ''source'' file into the ''target'' path in chunks, reporting the progress.
+ * If ''target'' path directory doesn't exist it will be created. Fails if ''target'' exists, and
+ * removes the partial copy when it fails or is cancelled.
+ *
+ * @return error message or empty on success ("Cancelled" if the progress callback stopped it).
+ */
+string fileCopy(const string& source, const string& target, CopyProgress progress);
+
 /**
  * Rename (move) ''source'' file into the ''target'' path.
  * If ''target'' path directory doesn't exist it will be created.
@@ -122,6 +141,14 @@ string fileRename(const string& source, const string& target);
  */
 vector<Datastore> getDatastoresFromMtab(const vector<string> validTypes);
 
+/**
+ * Mount points of the datastores (same filter as ''getDatastoresFromMtab''), without reading their size or uuid.
+ * The root file system is left out. Can be called from several threads at the same time.
+ *
+ * @return the list of mount points, ending with '/'
+ */
+vector<string> getDatastoreMountPoints(const vector<string> validTypes);
+
 /**
  * find the folder mark ''datastoreuuid.XXXX'' or create it. On the top of the datastore filesystem (the mount point)
  *
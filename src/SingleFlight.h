@@ -0,0 +1,181 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef SINGLE_FLIGHT_H
+#define SINGLE_FLIGHT_H
+
+#include <string>
+#include <map>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/function.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+using namespace std;
+
+/*
+ * Coalesces identical concurrent calls: the first caller computes the
+ * result and the ones arriving while it is in progress wait for it and
+ * get a copy. If the computation throws E, all of them get the same
+ * exception. On any other error the waiting callers compute the result
+ * on their own.
+ *
+ * Results can also be kept for a short time (the TTL of the method), so
+ * calls arriving right after the computation get the same result.
+ */
+template <class T, class E>
+class SingleFlight : private boost::noncopyable
+{
+    protected:
+        enum State { RUNNING, DONE, FAILED, ABORTED };
+
+        struct Flight
+        {
+            State state;
+            T result;
+            E error;
+            boost::posix_time::ptime expires;
+
+            Flight() : state(RUNNING) {}
+        };
+
+        /** Calls in progress (or cached) by key */
+        map<string, boost::shared_ptr<Flight> > flights;
+
+        /** Milliseconds the result of each method is kept. Methods not listed are not cached */
+        map<string, long> ttls;
+
+        boost::mutex flights_mutex;
+        boost::condition_variable flights_condition;
+
+        static boost::posix_time::ptime now()
+        {
+            return boost::posix_time::microsec_clock::universal_time();
+        }
+
+        void finish(const string& key, boost::shared_ptr<Flight> flight, State state, const string& method)
+        {
+            boost::mutex::scoped_lock lock(flights_mutex);
+
+            long ttl = getTtl(method);
+            flight->state = state;
+            flight->expires = now() + boost::posix_time::milliseconds(ttl);
+
+            typename map<string, boost::shared_ptr<Flight> >::iterator it = flights.find(key);
+            if ((state != DONE || ttl <= 0) && it != flights.end() && it->second == flight)
+            {
+                flights.erase(it);
+            }
+
+            flights_condition.notify_all();
+        }
+
+        long getTtl(const string& method)
+        {
+            map<string, long>::const_iterator it = ttls.find(method);
+            return it == ttls.end() ? 0 : it->second;
+        }
+
+    public:
+        void setTtl(const string& method, long ttlMs)
+        {
+            boost::mutex::scoped_lock lock(flights_mutex);
+            ttls[method] = ttlMs;
+        }
+
+        // Result of the method with the given arguments. Arguments must identify the result (empty if it has none)
+        void run(const string& method, const string& arguments, T& _return, const boost::function<void (T&)>& compute)
+        {
+            const string key = method + "(" + arguments + ")";
+            boost::shared_ptr<Flight> flight;
+
+            {
+                boost::mutex::scoped_lock lock(flights_mutex);
+
+                typename map<string, boost::shared_ptr<Flight> >::iterator it = flights.find(key);
+                if (it != flights.end() && it->second->state == DONE && it->second->expires <= now())
+                {
+                    flights.erase(it);
+                    it = flights.end();
+                }
+
+                if (it != flights.end())
+                {
+                    boost::shared_ptr<Flight> current = it->second;
+
+                    while (current->state == RUNNING)
+                    {
+                        flights_condition.wait(lock);
+                    }
+
+                    if (current->state == FAILED)
+                    {
+                        throw current->error;
+                    }
+
+                    if (current->state == DONE)
+                    {
+                        // The result does not change once done, it can be copied without the lock
+                        lock.unlock();
+                        _return = current->result;
+                        return;
+                    }
+
+                    // Aborted: compute it without sharing, the next callers will start a new flight
+                }
+                else
+                {
+                    flight.reset(new Flight());
+                    flights[key] = flight;
+                }
+            }
+
+            if (flight.get() == NULL)
+            {
+                compute(_return);
+                return;
+            }
+
+            try
+            {
+                compute(flight->result);
+            }
+            catch (E& e)
+            {
+                flight->error = e;
+                finish(key, flight, FAILED, method);
+                throw;
+            }
+            catch (...)
+            {
+                finish(key, flight, ABORTED, method);
+                throw;
+            }
+
+            finish(key, flight, DONE, method);
+            _return = flight->result;
+        }
+};
+
+#endif
@@ -0,0 +1,139 @@
+#include <StoragePoolRegistry.h>
+#include <Debug.h>
+
+StoragePoolRegistry::StoragePoolRegistry() : synchronized(false), sequence(0)
+{
+}
+
+StoragePoolRegistry::~StoragePoolRegistry()
+{
+}
+
+string StoragePoolRegistry::iscsiKey(const string& iqn)
+{
+    return "iscsi:" + iqn;
+}
+
+string StoragePoolRegistry::netfsKey(const string& host, const string& dir)
+{
+    return "netfs:" + host + ":" + dir;
+}
+
+string StoragePoolRegistry::dirKey(const string& targetPath)
+{
+    // Paths match with or without the trailing slash, see LibvirtService::comparePaths
+    bool slash = !targetPath.empty() && targetPath[targetPath.size() - 1] == '/';
+    return "dir:" + (slash ? targetPath : targetPath + "/");
+}
+
+bool StoragePoolRegistry::isSynchronized()
+{
+    boost::mutex::scoped_lock lock(registry_mutex);
+    return synchronized;
+}
+
+void StoragePoolRegistry::setSynchronized(bool value)
+{
+    boost::mutex::scoped_lock lock(registry_mutex);
+    synchronized = value;
+}
+
+unsigned long StoragePoolRegistry::getSequence()
+{
+    boost::mutex::scoped_lock lock(registry_mutex);
+    return sequence;
+}
+
+void StoragePoolRegistry::unindex(const string& uuid)
+{
+    map<string, string>::iterator it = pools.find(uuid);
+    if (it != pools.end())
+    {
+        // Another pool may have taken the key meanwhile
+        map<string, string>::iterator entry = index.find(it->second);
+        if (entry != index.end() && entry->second == uuid)
+        {
+            index.erase(entry);
+        }
+        pools.erase(it);
+    }
+}
+
+bool StoragePoolRegistry::contains(const string& key, bool& _return)
+{
+    boost::mutex::scoped_lock lock(registry_mutex);
+
+    if (!synchronized || !dirty.empty() || !refreshing.empty())
+    {
+        return false;
+    }
+
+    _return = (index.find(key) != index.end());
+    return true;
+}
+
+void StoragePoolRegistry::put(const string& uuid, const string& key)
+{
+    boost::mutex::scoped_lock lock(registry_mutex);
+
+    unindex(uuid);
+
+    // Pools of other types have no key, they are not indexed
+    if (!key.empty())
+    {
+        pools[uuid] = key;
+        index[key] = uuid;
+    }
+}
+
+void StoragePoolRegistry::remove(const string& uuid)
+{
+    boost::mutex::scoped_lock lock(registry_mutex);
+
+    sequence++;
+    unindex(uuid);
+    dirty.erase(uuid);
+}
+
+void StoragePoolRegistry::replace(const map<string, string>& all, unsigned long since)
+{
+    boost::mutex::scoped_lock lock(registry_mutex);
+
+    pools.clear();
+    index.clear();
+
+    for (map<string, string>::const_iterator it = all.begin(); it != all.end(); ++it)
+    {
+        if (!it->second.empty())
+        {
+            pools[it->first] = it->second;
+            index[it->second] = it->first;
+        }
+    }
+
+    // Pools removed while listing may be in it, so it is only trusted if nothing changed
+    synchronized = (sequence == since);
+}
+
+void StoragePoolRegistry::invalidate(const string& uuid)
+{
+    boost::mutex::scoped_lock lock(registry_mutex);
+
+    sequence++;
+    dirty.insert(uuid);
+}
+
+void StoragePoolRegistry::takeDirty(set<string>& _return)
+{
+    boost::mutex::scoped_lock lock(registry_mutex);
+
+    refreshing.insert(dirty.begin(), dirty.end());
+    _return.swap(dirty);
+    dirty.clear();
+}
+
+void StoragePoolRegistry::refreshDone()
+{
+    boost::mutex::scoped_lock lock(registry_mutex);
+    refreshing.clear();
+}
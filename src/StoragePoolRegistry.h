@@ -0,0 +1,98 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef STORAGE_POOL_REGISTRY_H
+#define STORAGE_POOL_REGISTRY_H
+
+#include <string>
+#include <map>
+#include <set>
+
+#include <boost/thread/mutex.hpp>
+
+using namespace std;
+
+/*
+ * Index of the storage pools defined in libvirt by their source: the IQN
+ * of the iSCSI pools, the host and directory of the NFS ones and the
+ * target path of the directory ones.
+ *
+ * It is built with a full listing and kept current with the libvirt
+ * storage pool events. Pools notified as defined are read again before
+ * the index can answer, and nothing is answered until it has been
+ * synchronized, so callers fall back to listing the pools on any miss.
+ */
+class StoragePoolRegistry : private boost::noncopyable
+{
+    protected:
+        /** Key of each pool, by UUID */
+        map<string, string> pools;
+
+        /** UUID of each pool, by key */
+        map<string, string> index;
+
+        /** Pools that changed and must be read again */
+        set<string> dirty;
+
+        /** Pools being read by the refresher */
+        set<string> refreshing;
+
+        /** True while the index is complete and kept current by events */
+        bool synchronized;
+
+        /** Incremented on each event, used to discard outdated full listings */
+        unsigned long sequence;
+
+        void unindex(const string& uuid);
+
+        boost::mutex registry_mutex;
+
+    public:
+        StoragePoolRegistry();
+        ~StoragePoolRegistry();
+
+        // Keys of each type of pool
+        static string iscsiKey(const string& iqn);
+        static string netfsKey(const string& host, const string& dir);
+        static string dirKey(const string& targetPath);
+
+        bool isSynchronized();
+        void setSynchronized(bool value);
+
+        // Current change sequence. Take it before reading a full listing to be given to replace()
+        unsigned long getSequence();
+
+        // Whether a pool with the key is defined. Returns false if the index can not answer
+        bool contains(const string& key, bool& _return);
+
+        // Updates
+        void put(const string& uuid, const string& key);
+        void remove(const string& uuid);
+        void replace(const map<string, string>& all, unsigned long since);
+        void invalidate(const string& uuid);
+
+        // Take the pools to read again, and tell when they have been read
+        void takeDirty(set<string>& _return);
+        void refreshDone();
+};
+
+#endif
@@ -16,10 +16,11 @@ StorageService::~StorageService()
 
 bool StorageService::initialize(INIReader configuration)
 {
-    INIReader reader(ISCSI_DEFAULT_INITIATOR_NAME_FILE);    
+    string initiatorNameFile = configuration.Get("storage", "initiatorNameFile", ISCSI_DEFAULT_INITIATOR_NAME_FILE);
+    INIReader reader(initiatorNameFile);
     bool initialized = (reader.ParseError() >= 0);
 
-    LOG("Reading ISCSI initiator IQN from '%s' file", ISCSI_DEFAULT_INITIATOR_NAME_FILE);
+    LOG("Reading ISCSI initiator IQN from '%s' file", initiatorNameFile.c_str());
 
     if (!initialized)
     {
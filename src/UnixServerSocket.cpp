@@ -0,0 +1,110 @@
+#include <UnixServerSocket.h>
+#include <Debug.h>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <pwd.h>
+#include <errno.h>
+#include <string.h>
+
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+
+using namespace ::apache::thrift::transport;
+
+UnixServerSocket::UnixServerSocket(const string& socketPath, const string& allowedUsers) :
+    TServerSocket(socketPath), path(socketPath)
+{
+    users.insert(0);
+    users.insert(geteuid());
+
+    vector<string> names;
+    boost::split(names, allowedUsers, boost::is_any_of(","));
+
+    for (vector<string>::iterator it = names.begin(); it != names.end(); ++it)
+    {
+        boost::trim(*it);
+        if (it->empty())
+        {
+            continue;
+        }
+
+        struct passwd* user = getpwnam(it->c_str());
+        if (user == NULL)
+        {
+            LOG("Unknown user '%s' in unixSocketUsers, ignored", it->c_str());
+            continue;
+        }
+
+        users.insert(user->pw_uid);
+    }
+}
+
+void UnixServerSocket::listen()
+{
+    // Left behind by a previous run
+    unlink(path.c_str());
+
+    TServerSocket::listen();
+
+    // Access is checked with the peer credentials of each connection
+    if (chmod(path.c_str(), 0666) == -1)
+    {
+        LOG("Unable to change the permissions of '%s': %s", path.c_str(), strerror(errno));
+    }
+}
+
+void UnixServerSocket::close()
+{
+    TServerSocket::close();
+    unlink(path.c_str());
+}
+
+bool UnixServerSocket::isAllowed(int fd)
+{
+    struct ucred credentials;
+    socklen_t length = sizeof(credentials);
+
+    if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &length) == -1)
+    {
+        LOG("Unable to read the credentials of a connection to '%s': %s", path.c_str(), strerror(errno));
+        return false;
+    }
+
+    if (users.count(credentials.uid) == 0)
+    {
+        LOG("Connection to '%s' from uid %d (pid %d) rejected", path.c_str(), (int) credentials.uid,
+                (int) credentials.pid);
+        return false;
+    }
+
+    return true;
+}
+
+boost::shared_ptr<TTransport> UnixServerSocket::acceptImpl()
+{
+    while (true)
+    {
+        boost::shared_ptr<TTransport> client = TServerSocket::acceptImpl();
+        boost::shared_ptr<TSocket> socket = boost::dynamic_pointer_cast<TSocket>(client);
+
+        if (socket.get() != NULL && isAllowed(socket->getSocketFD()))
+        {
+            return client;
+        }
+
+        client->close();
+    }
+}
+
+const uint8_t* LocalFramedTransport::borrowSlow(uint8_t* buf, uint32_t* len)
+{
+    if (rBase_ == rBound_ && !readFrame())
+    {
+        return NULL;
+    }
+
+    return (ptrdiff_t) *len <= rBound_ - rBase_ ? rBase_ : NULL;
+}
@@ -0,0 +1,87 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef UNIX_SERVER_SOCKET_H
+#define UNIX_SERVER_SOCKET_H
+
+#include <string>
+#include <set>
+
+#include <sys/types.h>
+
+#include <thrift/transport/TServerSocket.h>
+#include <thrift/transport/TSocket.h>
+#include <thrift/transport/TBufferTransports.h>
+
+using namespace std;
+
+/*
+ * Server socket bound to a Unix domain socket path. Only connections
+ * from root, the user AIM runs as, and the allowed users are accepted;
+ * the others are closed right after being accepted (SO_PEERCRED).
+ */
+class UnixServerSocket : public ::apache::thrift::transport::TServerSocket
+{
+    protected:
+        string path;
+        set<uid_t> users;
+
+        bool isAllowed(int fd);
+
+        boost::shared_ptr< ::apache::thrift::transport::TTransport> acceptImpl();
+
+    public:
+        // Users is a comma separated list of user names
+        UnixServerSocket(const string& socketPath, const string& allowedUsers);
+
+        virtual void listen();
+        virtual void close();
+};
+
+/*
+ * Framed transport that reads the next frame when it is borrowed at a
+ * frame boundary, so the protocol of a request can be detected before
+ * reading it (see LaneProcessor::process).
+ */
+class LocalFramedTransport : public ::apache::thrift::transport::TFramedTransport
+{
+    public:
+        LocalFramedTransport(boost::shared_ptr< ::apache::thrift::transport::TTransport> transport) :
+            TFramedTransport(transport) {}
+
+        const uint8_t* borrowSlow(uint8_t* buf, uint32_t* len);
+
+        // Bytes left in the current frame
+        uint32_t available() { return rBound_ - rBase_; }
+};
+
+class LocalFramedTransportFactory : public ::apache::thrift::transport::TTransportFactory
+{
+    public:
+        virtual boost::shared_ptr< ::apache::thrift::transport::TTransport> getTransport(
+                boost::shared_ptr< ::apache::thrift::transport::TTransport> transport)
+        {
+            return boost::shared_ptr< ::apache::thrift::transport::TTransport>(new LocalFramedTransport(transport));
+        }
+};
+
+#endif
@@ -0,0 +1,362 @@
+#include <Uploads.h>
+#include <Debug.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <boost/bind.hpp>
+
+#include <zlib.h>
+#include <uuid/uuid.h>
+
+using namespace boost::posix_time;
+
+static string newUploadId()
+{
+    char id[37];
+    uuid_t uuid;
+    uuid_generate_random(uuid);
+    uuid_unparse(uuid, id);
+    return string(id);
+}
+
+Upload::~Upload()
+{
+    if (fd != -1)
+    {
+        close(fd);
+    }
+}
+
+Uploads::Uploads() : timeoutSeconds(DEFAULT_UPLOAD_TIMEOUT), maxChunkSize(DEFAULT_MAX_CHUNK_SIZE)
+{
+}
+
+Uploads::~Uploads()
+{
+}
+
+void Uploads::initialize(int uploadTimeoutSeconds, int64_t maxChunk)
+{
+    timeoutSeconds = uploadTimeoutSeconds > 0 ? uploadTimeoutSeconds : DEFAULT_UPLOAD_TIMEOUT;
+    maxChunkSize = maxChunk > 0 ? maxChunk : DEFAULT_MAX_CHUNK_SIZE;
+
+    LOG("[DEBUG] [RIMP] Upload timeout: %ds, max chunk size: %lld bytes", timeoutSeconds, (long long) maxChunkSize);
+}
+
+void Uploads::start()
+{
+    purgeThread = boost::thread(boost::bind(&Uploads::runPurge, this));
+}
+
+void Uploads::stop()
+{
+    purgeThread.interrupt();
+    purgeThread.join();
+}
+
+void Uploads::runPurge()
+{
+    while (true)
+    {
+        boost::this_thread::sleep(seconds(UPLOAD_PURGE_SECONDS));
+
+        boost::mutex::scoped_lock lock(uploads_mutex);
+        purge();
+    }
+}
+
+bool Uploads::overlaps(const Upload& upload, int64_t offset, int64_t length)
+{
+    map<int64_t, UploadChunk>::const_iterator next = upload.chunks.upper_bound(offset);
+    if (next != upload.chunks.end() && next->first < offset + length)
+    {
+        return true;
+    }
+
+    map<int64_t, UploadChunk>::const_iterator previous = upload.chunks.lower_bound(offset);
+    if (previous != upload.chunks.begin())
+    {
+        --previous;
+        return previous->first + previous->second.length > offset;
+    }
+
+    return false;
+}
+
+void Uploads::purge()
+{
+    ptime limit = microsec_clock::universal_time() - seconds(timeoutSeconds);
+
+    map<string, boost::shared_ptr<Upload> >::iterator it = uploads.begin();
+    while (it != uploads.end())
+    {
+        Upload& upload = *it->second;
+
+        if (upload.writers == 0 && !upload.committing && upload.lastUsed < limit)
+        {
+            LOG("[RIMP] Upload %s of '%s' expired", upload.id.c_str(), upload.path.c_str());
+            unlink(upload.partPath.c_str());
+            uploads.erase(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+string Uploads::open(const string& path, int64_t size, string& id)
+{
+    if (size < 0)
+    {
+        return string("Invalid size for ").append(path);
+    }
+
+    boost::shared_ptr<Upload> upload(new Upload());
+    upload->id = newUploadId();
+    upload->path = path;
+    upload->partPath = path + "." + upload->id + ".part";
+    upload->size = size;
+    upload->lastUsed = microsec_clock::universal_time();
+
+    upload->fd = ::open(upload->partPath.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0666);
+    if (upload->fd == -1)
+    {
+        return string("Can not create ").append(upload->partPath).append(": ").append(strerror(errno));
+    }
+
+    // Sized from the start, so chunks can be written in any order
+    if (ftruncate(upload->fd, size) == -1)
+    {
+        string error = string("Can not allocate ").append(upload->partPath).append(": ").append(strerror(errno));
+        unlink(upload->partPath.c_str());
+        return error;
+    }
+
+    boost::mutex::scoped_lock lock(uploads_mutex);
+
+    purge();
+    uploads[upload->id] = upload;
+    id = upload->id;
+
+    LOG("[RIMP] Upload %s of '%s' opened (%lld bytes)", id.c_str(), path.c_str(), (long long) size);
+    return "";
+}
+
+string Uploads::write(const string& id, int64_t offset, const string& data)
+{
+    boost::shared_ptr<Upload> upload;
+
+    {
+        boost::mutex::scoped_lock lock(uploads_mutex);
+
+        map<string, boost::shared_ptr<Upload> >::iterator it = uploads.find(id);
+        if (it == uploads.end())
+        {
+            return string("Unknown upload: ").append(id);
+        }
+
+        upload = it->second;
+
+        if (upload->committing)
+        {
+            return string("Upload ").append(id).append(" is being committed");
+        }
+        if (data.empty() || (int64_t) data.size() > maxChunkSize)
+        {
+            return string("Invalid chunk size for upload ").append(id);
+        }
+        if (offset < 0 || offset + (int64_t) data.size() > upload->size)
+        {
+            return string("Chunk out of the file for upload ").append(id);
+        }
+        if (overlaps(*upload, offset, data.size()))
+        {
+            return string("Chunk overlaps another one of upload ").append(id);
+        }
+
+        // Only finished chunks can be replaced, another writer of the same offset would mix up its CRC
+        map<int64_t, UploadChunk>::const_iterator current = upload->chunks.find(offset);
+        if (current != upload->chunks.end() && current->second.writing)
+        {
+            return string("Chunk at the same offset of upload ").append(id).append(" is still being written");
+        }
+
+        // Reserved right away, so chunks being written at the same time do not overlap either
+        UploadChunk reserved;
+        reserved.length = data.size();
+        reserved.crc = 0;
+        reserved.writing = true;
+        upload->chunks[offset] = reserved;
+
+        upload->writers++;
+        upload->lastUsed = microsec_clock::universal_time();
+    }
+
+    string error;
+    size_t written = 0;
+
+    while (written < data.size())
+    {
+        ssize_t ret = pwrite(upload->fd, data.data() + written, data.size() - written, offset + written);
+        if (ret == -1)
+        {
+            if (errno != EINTR)
+            {
+                error = string("Can not write ").append(upload->partPath).append(": ").append(strerror(errno));
+                break;
+            }
+            continue;
+        }
+
+        written += ret;
+    }
+
+    UploadChunk chunk;
+    chunk.length = data.size();
+    chunk.crc = crc32(crc32(0L, Z_NULL, 0), (const Bytef*) data.data(), data.size());
+    chunk.writing = false;
+
+    boost::mutex::scoped_lock lock(uploads_mutex);
+
+    // The reservation is ours until now. A chunk written again at the same offset replaces the previous one
+    if (error.empty())
+    {
+        upload->chunks[offset] = chunk;
+    }
+    else
+    {
+        upload->chunks.erase(offset);
+    }
+
+    upload->writers--;
+    writers_condition.notify_all();
+
+    return error;
+}
+
+string Uploads::verify(const Upload& upload, unsigned long crc)
+{
+    unsigned long fileCrc = crc32(0L, Z_NULL, 0);
+    int64_t expected = 0;
+    char offset[32];
+
+    for (map<int64_t, UploadChunk>::const_iterator it = upload.chunks.begin(); it != upload.chunks.end(); ++it)
+    {
+        if (it->first > expected)
+        {
+            snprintf(offset, sizeof(offset), "%lld", (long long) expected);
+            return string("Missing data at offset ").append(offset).append(" of upload ").append(upload.id);
+        }
+        if (it->first < expected)
+        {
+            snprintf(offset, sizeof(offset), "%lld", (long long) it->first);
+            return string("Overlapping chunks at offset ").append(offset).append(" of upload ").append(upload.id);
+        }
+
+        fileCrc = crc32_combine(fileCrc, it->second.crc, it->second.length);
+        expected += it->second.length;
+    }
+
+    if (expected != upload.size)
+    {
+        snprintf(offset, sizeof(offset), "%lld", (long long) expected);
+        return string("Missing data at offset ").append(offset).append(" of upload ").append(upload.id);
+    }
+
+    if (fileCrc != crc)
+    {
+        return string("Checksum mismatch for upload ").append(upload.id);
+    }
+
+    return "";
+}
+
+string Uploads::commit(const string& id, unsigned long crc)
+{
+    boost::shared_ptr<Upload> upload;
+
+    {
+        boost::mutex::scoped_lock lock(uploads_mutex);
+
+        map<string, boost::shared_ptr<Upload> >::iterator it = uploads.find(id);
+        if (it == uploads.end())
+        {
+            return string("Unknown upload: ").append(id);
+        }
+
+        upload = it->second;
+
+        if (upload->committing)
+        {
+            return string("Upload ").append(id).append(" is already being committed");
+        }
+
+        // No more chunks are accepted, wait for the ones being written
+        upload->committing = true;
+        while (upload->writers > 0)
+        {
+            writers_condition.wait(lock);
+        }
+
+        string error = verify(*upload, crc);
+        if (!error.empty())
+        {
+            upload->committing = false;
+            upload->lastUsed = microsec_clock::universal_time();
+            return error;
+        }
+
+        uploads.erase(id);
+    }
+
+    string error;
+
+    if (fsync(upload->fd) == -1)
+    {
+        error = string("Can not write ").append(upload->partPath).append(": ").append(strerror(errno));
+    }
+    else if (::rename(upload->partPath.c_str(), upload->path.c_str()) == -1)
+    {
+        error = string("Can not move ").append(upload->partPath).append(" to ").append(upload->path).append(": ")
+            .append(strerror(errno));
+    }
+
+    if (!error.empty())
+    {
+        unlink(upload->partPath.c_str());
+        return error;
+    }
+
+    LOG("[RIMP] Upload %s of '%s' done", id.c_str(), upload->path.c_str());
+    return "";
+}
+
+string Uploads::abort(const string& id)
+{
+    boost::mutex::scoped_lock lock(uploads_mutex);
+
+    map<string, boost::shared_ptr<Upload> >::iterator it = uploads.find(id);
+    if (it == uploads.end())
+    {
+        return string("Unknown upload: ").append(id);
+    }
+
+    if (it->second->committing)
+    {
+        return string("Upload ").append(id).append(" is being committed");
+    }
+
+    // Chunks still being written go to the unlinked file
+    unlink(it->second->partPath.c_str());
+    uploads.erase(it);
+
+    LOG("[RIMP] Upload %s aborted", id.c_str());
+    return "";
+}
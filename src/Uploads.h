@@ -0,0 +1,122 @@
+/**
+ * Abiquo community edition
+ * cloud management application for hybrid clouds
+ * Copyright (C) 2008-2010 - Abiquo Holdings S.L.
+ *
+ * This application is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU LESSER GENERAL PUBLIC
+ * LICENSE as published by the Free Software Foundation under
+ * version 3 of the License
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * LESSER GENERAL PUBLIC LICENSE v.3 for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef UPLOADS_H
+#define UPLOADS_H
+
+#include <string>
+#include <map>
+
+#include <boost/thread.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <stdint.h>
+
+#define DEFAULT_UPLOAD_TIMEOUT      3600
+#define DEFAULT_MAX_CHUNK_SIZE      (16 * 1024 * 1024)
+#define UPLOAD_PURGE_SECONDS        60
+
+using namespace std;
+
+/** Part of an upload written (or being written), with the CRC-32 of its contents */
+struct UploadChunk
+{
+    int64_t length;
+    unsigned long crc;
+
+    /** Reserved by a write still in progress */
+    bool writing;
+};
+
+struct Upload
+{
+    string id;
+    string path;
+
+    /** The file is written here and renamed to path when committed */
+    string partPath;
+
+    int64_t size;
+    int fd;
+
+    /** Chunks written, by offset */
+    map<int64_t, UploadChunk> chunks;
+
+    /** Chunks being written right now, the upload can not be committed until they finish */
+    int writers;
+    bool committing;
+
+    boost::posix_time::ptime lastUsed;
+
+    Upload() : size(0), fd(-1), writers(0), committing(false) {}
+    ~Upload();
+};
+
+/*
+ * Files uploaded in chunks.
+ *
+ * Each chunk is written in place with pwrite as it arrives, so only the
+ * chunks in transit are held in memory and they can be written in
+ * parallel. The checksum of the file is computed from the checksums of
+ * its chunks when committed, without reading it again.
+ */
+class Uploads : private boost::noncopyable
+{
+    protected:
+        map<string, boost::shared_ptr<Upload> > uploads;
+
+        int timeoutSeconds;
+        int64_t maxChunkSize;
+
+        boost::mutex uploads_mutex;
+        boost::condition_variable writers_condition;
+
+        /** Discards the expired uploads even when no new ones are opened */
+        boost::thread purgeThread;
+
+        // Discard the uploads not used for longer than timeoutSeconds
+        void purge();
+        void runPurge();
+
+        // Whether the chunk overlaps one written at another offset
+        bool overlaps(const Upload& upload, int64_t offset, int64_t length);
+
+        // Returns the error message if the chunks do not cover the whole file or the checksum does not match
+        string verify(const Upload& upload, unsigned long crc);
+
+    public:
+        Uploads();
+        ~Uploads();
+
+        void initialize(int uploadTimeoutSeconds, int64_t maxChunk);
+        void start();
+        void stop();
+
+        // They return the error message, or an empty string on success
+        string open(const string& path, int64_t size, string& id);
+        string write(const string& id, int64_t offset, const string& data);
+        string commit(const string& id, unsigned long crc);
+        string abort(const string& id);
+};
+
+#endif
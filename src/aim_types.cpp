@@ -27,6 +27,72 @@ const char* _kDomainStateNames[] = {
 };
 const std::map<int, const char*> _DomainState_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(4, _kDomainStateValues, _kDomainStateNames), ::apache::thrift::TEnumIterator(-1, NULL, NULL));
 
+int _kDomainFieldsValues[] = {
+  DomainFields::STATE,
+  DomainFields::RESOURCES,
+  DomainFields::FULL
+};
+const char* _kDomainFieldsNames[] = {
+  "STATE",
+  "RESOURCES",
+  "FULL"
+};
+const std::map<int, const char*> _DomainFields_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(3, _kDomainFieldsValues, _kDomainFieldsNames), ::apache::thrift::TEnumIterator(-1, NULL, NULL));
+
+int _kDomainChangeTypeValues[] = {
+  DomainChangeType::ADDED,
+  DomainChangeType::REMOVED,
+  DomainChangeType::CHANGED
+};
+const char* _kDomainChangeTypeNames[] = {
+  "ADDED",
+  "REMOVED",
+  "CHANGED"
+};
+const std::map<int, const char*> _DomainChangeType_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(3, _kDomainChangeTypeValues, _kDomainChangeTypeNames), ::apache::thrift::TEnumIterator(-1, NULL, NULL));
+
+int _kDomainEventTypeValues[] = {
+  DomainEventType::DEFINED,
+  DomainEventType::UNDEFINED,
+  DomainEventType::STARTED,
+  DomainEventType::SUSPENDED,
+  DomainEventType::RESUMED,
+  DomainEventType::STOPPED,
+  DomainEventType::SHUTDOWN,
+  DomainEventType::PMSUSPENDED,
+  DomainEventType::CRASHED,
+  DomainEventType::JOB_COMPLETED
+};
+const char* _kDomainEventTypeNames[] = {
+  "DEFINED",
+  "UNDEFINED",
+  "STARTED",
+  "SUSPENDED",
+  "RESUMED",
+  "STOPPED",
+  "SHUTDOWN",
+  "PMSUSPENDED",
+  "CRASHED",
+  "JOB_COMPLETED"
+};
+const std::map<int, const char*> _DomainEventType_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(10, _kDomainEventTypeValues, _kDomainEventTypeNames), ::apache::thrift::TEnumIterator(-1, NULL, NULL));
+
+int _kJobStateValues[] = {
+  JobState::QUEUED,
+  JobState::RUNNING,
+  JobState::DONE,
+  JobState::FAILED,
+  JobState::CANCELLED
+};
+const char* _kJobStateNames[] = {
+  "QUEUED",
+  "RUNNING",
+  "DONE",
+  "FAILED",
+  "CANCELLED"
+};
+const std::map<int, const char*> _JobState_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(5, _kJobStateValues, _kJobStateNames), ::apache::thrift::TEnumIterator(-1, NULL, NULL));
+
 
 Datastore::~Datastore() throw() {
 }
@@ -1214,6 +1280,156 @@ std::ostream& operator<<(std::ostream& out, const BinaryFile& obj) {
 }
 
 
+FileChunk::~FileChunk() throw() {
+}
+
+
+void FileChunk::__set_data(const std::string& val) {
+  this->data = val;
+}
+
+void FileChunk::__set_compressed(const bool val) {
+  this->compressed = val;
+}
+
+void FileChunk::__set_length(const int32_t val) {
+  this->length = val;
+}
+
+void FileChunk::__set_fileSize(const int64_t val) {
+  this->fileSize = val;
+}
+
+const char* FileChunk::ascii_fingerprint = "18471C816D79ACB2CF7F5DD20F9923CD";
+const uint8_t FileChunk::binary_fingerprint[16] = {0x18,0x47,0x1C,0x81,0x6D,0x79,0xAC,0xB2,0xCF,0x7F,0x5D,0xD2,0x0F,0x99,0x23,0xCD};
+
+uint32_t FileChunk::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readBinary(this->data);
+          this->__isset.data = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->compressed);
+          this->__isset.compressed = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->length);
+          this->__isset.length = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->fileSize);
+          this->__isset.fileSize = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t FileChunk::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("FileChunk");
+
+  xfer += oprot->writeFieldBegin("data", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeBinary(this->data);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("compressed", ::apache::thrift::protocol::T_BOOL, 2);
+  xfer += oprot->writeBool(this->compressed);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("length", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->length);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("fileSize", ::apache::thrift::protocol::T_I64, 4);
+  xfer += oprot->writeI64(this->fileSize);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(FileChunk &a, FileChunk &b) {
+  using ::std::swap;
+  swap(a.data, b.data);
+  swap(a.compressed, b.compressed);
+  swap(a.length, b.length);
+  swap(a.fileSize, b.fileSize);
+  swap(a.__isset, b.__isset);
+}
+
+FileChunk::FileChunk(const FileChunk& other31) {
+  data = other31.data;
+  compressed = other31.compressed;
+  length = other31.length;
+  fileSize = other31.fileSize;
+  __isset = other31.__isset;
+}
+FileChunk& FileChunk::operator=(const FileChunk& other32) {
+  data = other32.data;
+  compressed = other32.compressed;
+  length = other32.length;
+  fileSize = other32.fileSize;
+  __isset = other32.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const FileChunk& obj) {
+  using apache::thrift::to_string;
+  out << "FileChunk(";
+  out << "data=" << to_string(obj.data);
+  out << ", " << "compressed=" << to_string(obj.compressed);
+  out << ", " << "length=" << to_string(obj.length);
+  out << ", " << "fileSize=" << to_string(obj.fileSize);
+  out << ")";
+  return out;
+}
+
+
 RimpException::~RimpException() throw() {
 }
 
@@ -1286,13 +1502,13 @@ void swap(RimpException &a, RimpException &b) {
   swap(a.__isset, b.__isset);
 }
 
-RimpException::RimpException(const RimpException& other31) : TException() {
-  description = other31.description;
-  __isset = other31.__isset;
+RimpException::RimpException(const RimpException& other33) : TException() {
+  description = other33.description;
+  __isset = other33.__isset;
 }
-RimpException& RimpException::operator=(const RimpException& other32) {
-  description = other32.description;
-  __isset = other32.__isset;
+RimpException& RimpException::operator=(const RimpException& other34) {
+  description = other34.description;
+  __isset = other34.__isset;
   return *this;
 }
 std::ostream& operator<<(std::ostream& out, const RimpException& obj) {
@@ -1376,13 +1592,13 @@ void swap(VLanException &a, VLanException &b) {
   swap(a.__isset, b.__isset);
 }
 
-VLanException::VLanException(const VLanException& other33) : TException() {
-  description = other33.description;
-  __isset = other33.__isset;
+VLanException::VLanException(const VLanException& other35) : TException() {
+  description = other35.description;
+  __isset = other35.__isset;
 }
-VLanException& VLanException::operator=(const VLanException& other34) {
-  description = other34.description;
-  __isset = other34.__isset;
+VLanException& VLanException::operator=(const VLanException& other36) {
+  description = other36.description;
+  __isset = other36.__isset;
   return *this;
 }
 std::ostream& operator<<(std::ostream& out, const VLanException& obj) {
@@ -1466,13 +1682,13 @@ void swap(StorageException &a, StorageException &b) {
   swap(a.__isset, b.__isset);
 }
 
-StorageException::StorageException(const StorageException& other35) : TException() {
-  description = other35.description;
-  __isset = other35.__isset;
+StorageException::StorageException(const StorageException& other37) : TException() {
+  description = other37.description;
+  __isset = other37.__isset;
 }
-StorageException& StorageException::operator=(const StorageException& other36) {
-  description = other36.description;
-  __isset = other36.__isset;
+StorageException& StorageException::operator=(const StorageException& other38) {
+  description = other38.description;
+  __isset = other38.__isset;
   return *this;
 }
 std::ostream& operator<<(std::ostream& out, const StorageException& obj) {
@@ -1692,29 +1908,29 @@ void swap(LibvirtException &a, LibvirtException &b) {
   swap(a.__isset, b.__isset);
 }
 
-LibvirtException::LibvirtException(const LibvirtException& other37) : TException() {
-  code = other37.code;
-  domain = other37.domain;
-  msg = other37.msg;
-  level = other37.level;
-  str1 = other37.str1;
-  str2 = other37.str2;
-  str3 = other37.str3;
-  int1 = other37.int1;
-  int2 = other37.int2;
-  __isset = other37.__isset;
+LibvirtException::LibvirtException(const LibvirtException& other39) : TException() {
+  code = other39.code;
+  domain = other39.domain;
+  msg = other39.msg;
+  level = other39.level;
+  str1 = other39.str1;
+  str2 = other39.str2;
+  str3 = other39.str3;
+  int1 = other39.int1;
+  int2 = other39.int2;
+  __isset = other39.__isset;
 }
-LibvirtException& LibvirtException::operator=(const LibvirtException& other38) {
-  code = other38.code;
-  domain = other38.domain;
-  msg = other38.msg;
-  level = other38.level;
-  str1 = other38.str1;
-  str2 = other38.str2;
-  str3 = other38.str3;
-  int1 = other38.int1;
-  int2 = other38.int2;
-  __isset = other38.__isset;
+LibvirtException& LibvirtException::operator=(const LibvirtException& other40) {
+  code = other40.code;
+  domain = other40.domain;
+  msg = other40.msg;
+  level = other40.level;
+  str1 = other40.str1;
+  str2 = other40.str2;
+  str3 = other40.str3;
+  int1 = other40.int1;
+  int2 = other40.int2;
+  __isset = other40.__isset;
   return *this;
 }
 std::ostream& operator<<(std::ostream& out, const LibvirtException& obj) {
@@ -1734,3 +1950,2301 @@ std::ostream& operator<<(std::ostream& out, const LibvirtException& obj) {
 }
 
 
+TimeoutException::~TimeoutException() throw() {
+}
+
+
+void TimeoutException::__set_description(const std::string& val) {
+  this->description = val;
+}
+
+void TimeoutException::__set_timeoutMs(const int32_t val) {
+  this->timeoutMs = val;
+}
+
+const char* TimeoutException::ascii_fingerprint = "EEBC915CE44901401D881E6091423036";
+const uint8_t TimeoutException::binary_fingerprint[16] = {0xEE,0xBC,0x91,0x5C,0xE4,0x49,0x01,0x40,0x1D,0x88,0x1E,0x60,0x91,0x42,0x30,0x36};
+
+uint32_t TimeoutException::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->description);
+          this->__isset.description = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->timeoutMs);
+          this->__isset.timeoutMs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t TimeoutException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("TimeoutException");
+
+  xfer += oprot->writeFieldBegin("description", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->description);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timeoutMs", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->timeoutMs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(TimeoutException &a, TimeoutException &b) {
+  using ::std::swap;
+  swap(a.description, b.description);
+  swap(a.timeoutMs, b.timeoutMs);
+  swap(a.__isset, b.__isset);
+}
+
+TimeoutException::TimeoutException(const TimeoutException& other41) : TException() {
+  description = other41.description;
+  timeoutMs = other41.timeoutMs;
+  __isset = other41.__isset;
+}
+TimeoutException& TimeoutException::operator=(const TimeoutException& other42) {
+  description = other42.description;
+  timeoutMs = other42.timeoutMs;
+  __isset = other42.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const TimeoutException& obj) {
+  using apache::thrift::to_string;
+  out << "TimeoutException(";
+  out << "description=" << to_string(obj.description);
+  out << ", " << "timeoutMs=" << to_string(obj.timeoutMs);
+  out << ")";
+  return out;
+}
+
+
+OverloadException::~OverloadException() throw() {
+}
+
+
+void OverloadException::__set_description(const std::string& val) {
+  this->description = val;
+}
+
+void OverloadException::__set_lane(const std::string& val) {
+  this->lane = val;
+}
+
+void OverloadException::__set_retryAfterMs(const int32_t val) {
+  this->retryAfterMs = val;
+}
+
+const char* OverloadException::ascii_fingerprint = "343DA57F446177400B333DC49B037B0C";
+const uint8_t OverloadException::binary_fingerprint[16] = {0x34,0x3D,0xA5,0x7F,0x44,0x61,0x77,0x40,0x0B,0x33,0x3D,0xC4,0x9B,0x03,0x7B,0x0C};
+
+uint32_t OverloadException::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->description);
+          this->__isset.description = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->lane);
+          this->__isset.lane = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->retryAfterMs);
+          this->__isset.retryAfterMs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t OverloadException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("OverloadException");
+
+  xfer += oprot->writeFieldBegin("description", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->description);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("lane", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->lane);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("retryAfterMs", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->retryAfterMs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(OverloadException &a, OverloadException &b) {
+  using ::std::swap;
+  swap(a.description, b.description);
+  swap(a.lane, b.lane);
+  swap(a.retryAfterMs, b.retryAfterMs);
+  swap(a.__isset, b.__isset);
+}
+
+OverloadException::OverloadException(const OverloadException& other43) : TException() {
+  description = other43.description;
+  lane = other43.lane;
+  retryAfterMs = other43.retryAfterMs;
+  __isset = other43.__isset;
+}
+OverloadException& OverloadException::operator=(const OverloadException& other44) {
+  description = other44.description;
+  lane = other44.lane;
+  retryAfterMs = other44.retryAfterMs;
+  __isset = other44.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const OverloadException& obj) {
+  using apache::thrift::to_string;
+  out << "OverloadException(";
+  out << "description=" << to_string(obj.description);
+  out << ", " << "lane=" << to_string(obj.lane);
+  out << ", " << "retryAfterMs=" << to_string(obj.retryAfterMs);
+  out << ")";
+  return out;
+}
+
+
+DomainChange::~DomainChange() throw() {
+}
+
+
+void DomainChange::__set_type(const DomainChangeType::type val) {
+  this->type = val;
+}
+
+void DomainChange::__set_uuid(const std::string& val) {
+  this->uuid = val;
+}
+
+void DomainChange::__set_info(const DomainInfo& val) {
+  this->info = val;
+}
+
+const char* DomainChange::ascii_fingerprint = "56A8349B3CF43B15BBA36C6A262194A7";
+const uint8_t DomainChange::binary_fingerprint[16] = {0x56,0xA8,0x34,0x9B,0x3C,0xF4,0x3B,0x15,0xBB,0xA3,0x6C,0x6A,0x26,0x21,0x94,0xA7};
+
+uint32_t DomainChange::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast45;
+          xfer += iprot->readI32(ecast45);
+          this->type = (DomainChangeType::type)ecast45;
+          this->__isset.type = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->uuid);
+          this->__isset.uuid = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->info.read(iprot);
+          this->__isset.info = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t DomainChange::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("DomainChange");
+
+  xfer += oprot->writeFieldBegin("type", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32((int32_t)this->type);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("uuid", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->uuid);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("info", ::apache::thrift::protocol::T_STRUCT, 3);
+  xfer += this->info.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(DomainChange &a, DomainChange &b) {
+  using ::std::swap;
+  swap(a.type, b.type);
+  swap(a.uuid, b.uuid);
+  swap(a.info, b.info);
+  swap(a.__isset, b.__isset);
+}
+
+DomainChange::DomainChange(const DomainChange& other46) {
+  type = other46.type;
+  uuid = other46.uuid;
+  info = other46.info;
+  __isset = other46.__isset;
+}
+DomainChange& DomainChange::operator=(const DomainChange& other47) {
+  type = other47.type;
+  uuid = other47.uuid;
+  info = other47.info;
+  __isset = other47.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const DomainChange& obj) {
+  using apache::thrift::to_string;
+  out << "DomainChange(";
+  out << "type=" << to_string(obj.type);
+  out << ", " << "uuid=" << to_string(obj.uuid);
+  out << ", " << "info=" << to_string(obj.info);
+  out << ")";
+  return out;
+}
+
+
+DomainChanges::~DomainChanges() throw() {
+}
+
+
+void DomainChanges::__set_generation(const int64_t val) {
+  this->generation = val;
+}
+
+void DomainChanges::__set_snapshot(const bool val) {
+  this->snapshot = val;
+}
+
+void DomainChanges::__set_changes(const std::vector<DomainChange> & val) {
+  this->changes = val;
+}
+
+void DomainChanges::__set_domains(const std::vector<DomainInfo> & val) {
+  this->domains = val;
+}
+
+const char* DomainChanges::ascii_fingerprint = "2DEA1A41B33B1DB5E6B47EAE53840C4F";
+const uint8_t DomainChanges::binary_fingerprint[16] = {0x2D,0xEA,0x1A,0x41,0xB3,0x3B,0x1D,0xB5,0xE6,0xB4,0x7E,0xAE,0x53,0x84,0x0C,0x4F};
+
+uint32_t DomainChanges::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->generation);
+          this->__isset.generation = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->snapshot);
+          this->__isset.snapshot = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->changes.clear();
+            uint32_t _size48;
+            ::apache::thrift::protocol::TType _etype51;
+            xfer += iprot->readListBegin(_etype51, _size48);
+            this->changes.resize(_size48);
+            uint32_t _i52;
+            for (_i52 = 0; _i52 < _size48; ++_i52)
+            {
+              xfer += this->changes[_i52].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.changes = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->domains.clear();
+            uint32_t _size53;
+            ::apache::thrift::protocol::TType _etype56;
+            xfer += iprot->readListBegin(_etype56, _size53);
+            this->domains.resize(_size53);
+            uint32_t _i57;
+            for (_i57 = 0; _i57 < _size53; ++_i57)
+            {
+              xfer += this->domains[_i57].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.domains = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t DomainChanges::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("DomainChanges");
+
+  xfer += oprot->writeFieldBegin("generation", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->generation);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("snapshot", ::apache::thrift::protocol::T_BOOL, 2);
+  xfer += oprot->writeBool(this->snapshot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("changes", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->changes.size()));
+    std::vector<DomainChange> ::const_iterator _iter58;
+    for (_iter58 = this->changes.begin(); _iter58 != this->changes.end(); ++_iter58)
+    {
+      xfer += (*_iter58).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("domains", ::apache::thrift::protocol::T_LIST, 4);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->domains.size()));
+    std::vector<DomainInfo> ::const_iterator _iter59;
+    for (_iter59 = this->domains.begin(); _iter59 != this->domains.end(); ++_iter59)
+    {
+      xfer += (*_iter59).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(DomainChanges &a, DomainChanges &b) {
+  using ::std::swap;
+  swap(a.generation, b.generation);
+  swap(a.snapshot, b.snapshot);
+  swap(a.changes, b.changes);
+  swap(a.domains, b.domains);
+  swap(a.__isset, b.__isset);
+}
+
+DomainChanges::DomainChanges(const DomainChanges& other60) {
+  generation = other60.generation;
+  snapshot = other60.snapshot;
+  changes = other60.changes;
+  domains = other60.domains;
+  __isset = other60.__isset;
+}
+DomainChanges& DomainChanges::operator=(const DomainChanges& other61) {
+  generation = other61.generation;
+  snapshot = other61.snapshot;
+  changes = other61.changes;
+  domains = other61.domains;
+  __isset = other61.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const DomainChanges& obj) {
+  using apache::thrift::to_string;
+  out << "DomainChanges(";
+  out << "generation=" << to_string(obj.generation);
+  out << ", " << "snapshot=" << to_string(obj.snapshot);
+  out << ", " << "changes=" << to_string(obj.changes);
+  out << ", " << "domains=" << to_string(obj.domains);
+  out << ")";
+  return out;
+}
+
+
+DomainEvent::~DomainEvent() throw() {
+}
+
+
+void DomainEvent::__set_id(const int64_t val) {
+  this->id = val;
+}
+
+void DomainEvent::__set_timestamp(const int64_t val) {
+  this->timestamp = val;
+}
+
+void DomainEvent::__set_uuid(const std::string& val) {
+  this->uuid = val;
+}
+
+void DomainEvent::__set_name(const std::string& val) {
+  this->name = val;
+}
+
+void DomainEvent::__set_type(const DomainEventType::type val) {
+  this->type = val;
+}
+
+void DomainEvent::__set_detail(const int32_t val) {
+  this->detail = val;
+}
+
+const char* DomainEvent::ascii_fingerprint = "DB3F31E03CBAFD8067AAC763865105D8";
+const uint8_t DomainEvent::binary_fingerprint[16] = {0xDB,0x3F,0x31,0xE0,0x3C,0xBA,0xFD,0x80,0x67,0xAA,0xC7,0x63,0x86,0x51,0x05,0xD8};
+
+uint32_t DomainEvent::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->id);
+          this->__isset.id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->timestamp);
+          this->__isset.timestamp = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->uuid);
+          this->__isset.uuid = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->name);
+          this->__isset.name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast62;
+          xfer += iprot->readI32(ecast62);
+          this->type = (DomainEventType::type)ecast62;
+          this->__isset.type = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->detail);
+          this->__isset.detail = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t DomainEvent::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("DomainEvent");
+
+  xfer += oprot->writeFieldBegin("id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timestamp", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->timestamp);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("uuid", ::apache::thrift::protocol::T_STRING, 3);
+  xfer += oprot->writeString(this->uuid);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("name", ::apache::thrift::protocol::T_STRING, 4);
+  xfer += oprot->writeString(this->name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("type", ::apache::thrift::protocol::T_I32, 5);
+  xfer += oprot->writeI32((int32_t)this->type);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("detail", ::apache::thrift::protocol::T_I32, 6);
+  xfer += oprot->writeI32(this->detail);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(DomainEvent &a, DomainEvent &b) {
+  using ::std::swap;
+  swap(a.id, b.id);
+  swap(a.timestamp, b.timestamp);
+  swap(a.uuid, b.uuid);
+  swap(a.name, b.name);
+  swap(a.type, b.type);
+  swap(a.detail, b.detail);
+  swap(a.__isset, b.__isset);
+}
+
+DomainEvent::DomainEvent(const DomainEvent& other63) {
+  id = other63.id;
+  timestamp = other63.timestamp;
+  uuid = other63.uuid;
+  name = other63.name;
+  type = other63.type;
+  detail = other63.detail;
+  __isset = other63.__isset;
+}
+DomainEvent& DomainEvent::operator=(const DomainEvent& other64) {
+  id = other64.id;
+  timestamp = other64.timestamp;
+  uuid = other64.uuid;
+  name = other64.name;
+  type = other64.type;
+  detail = other64.detail;
+  __isset = other64.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const DomainEvent& obj) {
+  using apache::thrift::to_string;
+  out << "DomainEvent(";
+  out << "id=" << to_string(obj.id);
+  out << ", " << "timestamp=" << to_string(obj.timestamp);
+  out << ", " << "uuid=" << to_string(obj.uuid);
+  out << ", " << "name=" << to_string(obj.name);
+  out << ", " << "type=" << to_string(obj.type);
+  out << ", " << "detail=" << to_string(obj.detail);
+  out << ")";
+  return out;
+}
+
+
+DomainEvents::~DomainEvents() throw() {
+}
+
+
+void DomainEvents::__set_lastId(const int64_t val) {
+  this->lastId = val;
+}
+
+void DomainEvents::__set_lost(const bool val) {
+  this->lost = val;
+}
+
+void DomainEvents::__set_events(const std::vector<DomainEvent> & val) {
+  this->events = val;
+}
+
+const char* DomainEvents::ascii_fingerprint = "1CD8F39C6B5F6D12DAC8520408FB3AD9";
+const uint8_t DomainEvents::binary_fingerprint[16] = {0x1C,0xD8,0xF3,0x9C,0x6B,0x5F,0x6D,0x12,0xDA,0xC8,0x52,0x04,0x08,0xFB,0x3A,0xD9};
+
+uint32_t DomainEvents::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->lastId);
+          this->__isset.lastId = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->lost);
+          this->__isset.lost = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->events.clear();
+            uint32_t _size65;
+            ::apache::thrift::protocol::TType _etype68;
+            xfer += iprot->readListBegin(_etype68, _size65);
+            this->events.resize(_size65);
+            uint32_t _i69;
+            for (_i69 = 0; _i69 < _size65; ++_i69)
+            {
+              xfer += this->events[_i69].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.events = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t DomainEvents::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("DomainEvents");
+
+  xfer += oprot->writeFieldBegin("lastId", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->lastId);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("lost", ::apache::thrift::protocol::T_BOOL, 2);
+  xfer += oprot->writeBool(this->lost);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("events", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->events.size()));
+    std::vector<DomainEvent> ::const_iterator _iter70;
+    for (_iter70 = this->events.begin(); _iter70 != this->events.end(); ++_iter70)
+    {
+      xfer += (*_iter70).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(DomainEvents &a, DomainEvents &b) {
+  using ::std::swap;
+  swap(a.lastId, b.lastId);
+  swap(a.lost, b.lost);
+  swap(a.events, b.events);
+  swap(a.__isset, b.__isset);
+}
+
+DomainEvents::DomainEvents(const DomainEvents& other71) {
+  lastId = other71.lastId;
+  lost = other71.lost;
+  events = other71.events;
+  __isset = other71.__isset;
+}
+DomainEvents& DomainEvents::operator=(const DomainEvents& other72) {
+  lastId = other72.lastId;
+  lost = other72.lost;
+  events = other72.events;
+  __isset = other72.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const DomainEvents& obj) {
+  using apache::thrift::to_string;
+  out << "DomainEvents(";
+  out << "lastId=" << to_string(obj.lastId);
+  out << ", " << "lost=" << to_string(obj.lost);
+  out << ", " << "events=" << to_string(obj.events);
+  out << ")";
+  return out;
+}
+
+
+JobStatus::~JobStatus() throw() {
+}
+
+
+void JobStatus::__set_id(const std::string& val) {
+  this->id = val;
+}
+
+void JobStatus::__set_state(const JobState::type val) {
+  this->state = val;
+}
+
+void JobStatus::__set_totalBytes(const int64_t val) {
+  this->totalBytes = val;
+}
+
+void JobStatus::__set_copiedBytes(const int64_t val) {
+  this->copiedBytes = val;
+}
+
+void JobStatus::__set_bytesPerSecond(const double val) {
+  this->bytesPerSecond = val;
+}
+
+void JobStatus::__set_etaSeconds(const int32_t val) {
+  this->etaSeconds = val;
+}
+
+void JobStatus::__set_error(const std::string& val) {
+  this->error = val;
+}
+
+const char* JobStatus::ascii_fingerprint = "04E6DE613C75D453E4AC814BC521328F";
+const uint8_t JobStatus::binary_fingerprint[16] = {0x04,0xE6,0xDE,0x61,0x3C,0x75,0xD4,0x53,0xE4,0xAC,0x81,0x4B,0xC5,0x21,0x32,0x8F};
+
+uint32_t JobStatus::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->id);
+          this->__isset.id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast73;
+          xfer += iprot->readI32(ecast73);
+          this->state = (JobState::type)ecast73;
+          this->__isset.state = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->totalBytes);
+          this->__isset.totalBytes = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->copiedBytes);
+          this->__isset.copiedBytes = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->bytesPerSecond);
+          this->__isset.bytesPerSecond = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->etaSeconds);
+          this->__isset.etaSeconds = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->error);
+          this->__isset.error = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t JobStatus::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("JobStatus");
+
+  xfer += oprot->writeFieldBegin("id", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("state", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32((int32_t)this->state);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("totalBytes", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64(this->totalBytes);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("copiedBytes", ::apache::thrift::protocol::T_I64, 4);
+  xfer += oprot->writeI64(this->copiedBytes);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("bytesPerSecond", ::apache::thrift::protocol::T_DOUBLE, 5);
+  xfer += oprot->writeDouble(this->bytesPerSecond);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("etaSeconds", ::apache::thrift::protocol::T_I32, 6);
+  xfer += oprot->writeI32(this->etaSeconds);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_STRING, 7);
+  xfer += oprot->writeString(this->error);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(JobStatus &a, JobStatus &b) {
+  using ::std::swap;
+  swap(a.id, b.id);
+  swap(a.state, b.state);
+  swap(a.totalBytes, b.totalBytes);
+  swap(a.copiedBytes, b.copiedBytes);
+  swap(a.bytesPerSecond, b.bytesPerSecond);
+  swap(a.etaSeconds, b.etaSeconds);
+  swap(a.error, b.error);
+  swap(a.__isset, b.__isset);
+}
+
+JobStatus::JobStatus(const JobStatus& other74) {
+  id = other74.id;
+  state = other74.state;
+  totalBytes = other74.totalBytes;
+  copiedBytes = other74.copiedBytes;
+  bytesPerSecond = other74.bytesPerSecond;
+  etaSeconds = other74.etaSeconds;
+  error = other74.error;
+  __isset = other74.__isset;
+}
+JobStatus& JobStatus::operator=(const JobStatus& other75) {
+  id = other75.id;
+  state = other75.state;
+  totalBytes = other75.totalBytes;
+  copiedBytes = other75.copiedBytes;
+  bytesPerSecond = other75.bytesPerSecond;
+  etaSeconds = other75.etaSeconds;
+  error = other75.error;
+  __isset = other75.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const JobStatus& obj) {
+  using apache::thrift::to_string;
+  out << "JobStatus(";
+  out << "id=" << to_string(obj.id);
+  out << ", " << "state=" << to_string(obj.state);
+  out << ", " << "totalBytes=" << to_string(obj.totalBytes);
+  out << ", " << "copiedBytes=" << to_string(obj.copiedBytes);
+  out << ", " << "bytesPerSecond=" << to_string(obj.bytesPerSecond);
+  out << ", " << "etaSeconds=" << to_string(obj.etaSeconds);
+  out << ", " << "error=" << to_string(obj.error);
+  out << ")";
+  return out;
+}
+
+
+MethodStats::~MethodStats() throw() {
+}
+
+
+void MethodStats::__set_name(const std::string& val) {
+  this->name = val;
+}
+
+void MethodStats::__set_calls(const int64_t val) {
+  this->calls = val;
+}
+
+void MethodStats::__set_errors(const int64_t val) {
+  this->errors = val;
+}
+
+void MethodStats::__set_inFlight(const int32_t val) {
+  this->inFlight = val;
+}
+
+void MethodStats::__set_p50Ms(const double val) {
+  this->p50Ms = val;
+}
+
+void MethodStats::__set_p99Ms(const double val) {
+  this->p99Ms = val;
+}
+
+void MethodStats::__set_maxMs(const double val) {
+  this->maxMs = val;
+}
+
+const char* MethodStats::ascii_fingerprint = "D2F2074A4FE0C6791D82A824BABC3296";
+const uint8_t MethodStats::binary_fingerprint[16] = {0xD2,0xF2,0x07,0x4A,0x4F,0xE0,0xC6,0x79,0x1D,0x82,0xA8,0x24,0xBA,0xBC,0x32,0x96};
+
+uint32_t MethodStats::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->name);
+          this->__isset.name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->calls);
+          this->__isset.calls = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->errors);
+          this->__isset.errors = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->inFlight);
+          this->__isset.inFlight = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->p50Ms);
+          this->__isset.p50Ms = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->p99Ms);
+          this->__isset.p99Ms = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->maxMs);
+          this->__isset.maxMs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t MethodStats::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("MethodStats");
+
+  xfer += oprot->writeFieldBegin("name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("calls", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->calls);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("errors", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64(this->errors);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("inFlight", ::apache::thrift::protocol::T_I32, 4);
+  xfer += oprot->writeI32(this->inFlight);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("p50Ms", ::apache::thrift::protocol::T_DOUBLE, 5);
+  xfer += oprot->writeDouble(this->p50Ms);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("p99Ms", ::apache::thrift::protocol::T_DOUBLE, 6);
+  xfer += oprot->writeDouble(this->p99Ms);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("maxMs", ::apache::thrift::protocol::T_DOUBLE, 7);
+  xfer += oprot->writeDouble(this->maxMs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(MethodStats &a, MethodStats &b) {
+  using ::std::swap;
+  swap(a.name, b.name);
+  swap(a.calls, b.calls);
+  swap(a.errors, b.errors);
+  swap(a.inFlight, b.inFlight);
+  swap(a.p50Ms, b.p50Ms);
+  swap(a.p99Ms, b.p99Ms);
+  swap(a.maxMs, b.maxMs);
+  swap(a.__isset, b.__isset);
+}
+
+MethodStats::MethodStats(const MethodStats& other76) {
+  name = other76.name;
+  calls = other76.calls;
+  errors = other76.errors;
+  inFlight = other76.inFlight;
+  p50Ms = other76.p50Ms;
+  p99Ms = other76.p99Ms;
+  maxMs = other76.maxMs;
+  __isset = other76.__isset;
+}
+MethodStats& MethodStats::operator=(const MethodStats& other77) {
+  name = other77.name;
+  calls = other77.calls;
+  errors = other77.errors;
+  inFlight = other77.inFlight;
+  p50Ms = other77.p50Ms;
+  p99Ms = other77.p99Ms;
+  maxMs = other77.maxMs;
+  __isset = other77.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const MethodStats& obj) {
+  using apache::thrift::to_string;
+  out << "MethodStats(";
+  out << "name=" << to_string(obj.name);
+  out << ", " << "calls=" << to_string(obj.calls);
+  out << ", " << "errors=" << to_string(obj.errors);
+  out << ", " << "inFlight=" << to_string(obj.inFlight);
+  out << ", " << "p50Ms=" << to_string(obj.p50Ms);
+  out << ", " << "p99Ms=" << to_string(obj.p99Ms);
+  out << ", " << "maxMs=" << to_string(obj.maxMs);
+  out << ")";
+  return out;
+}
+
+
+LaneStats::~LaneStats() throw() {
+}
+
+
+void LaneStats::__set_name(const std::string& val) {
+  this->name = val;
+}
+
+void LaneStats::__set_threads(const int32_t val) {
+  this->threads = val;
+}
+
+void LaneStats::__set_running(const int32_t val) {
+  this->running = val;
+}
+
+void LaneStats::__set_queued(const int32_t val) {
+  this->queued = val;
+}
+
+void LaneStats::__set_rejected(const int64_t val) {
+  this->rejected = val;
+}
+
+void LaneStats::__set_expired(const int64_t val) {
+  this->expired = val;
+}
+
+const char* LaneStats::ascii_fingerprint = "8CC9D9969B0006B5C073C8E938B1EBB7";
+const uint8_t LaneStats::binary_fingerprint[16] = {0x8C,0xC9,0xD9,0x96,0x9B,0x00,0x06,0xB5,0xC0,0x73,0xC8,0xE9,0x38,0xB1,0xEB,0xB7};
+
+uint32_t LaneStats::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->name);
+          this->__isset.name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->threads);
+          this->__isset.threads = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->running);
+          this->__isset.running = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->queued);
+          this->__isset.queued = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->rejected);
+          this->__isset.rejected = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->expired);
+          this->__isset.expired = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t LaneStats::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("LaneStats");
+
+  xfer += oprot->writeFieldBegin("name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("threads", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->threads);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("running", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->running);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("queued", ::apache::thrift::protocol::T_I32, 4);
+  xfer += oprot->writeI32(this->queued);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("rejected", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64(this->rejected);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("expired", ::apache::thrift::protocol::T_I64, 6);
+  xfer += oprot->writeI64(this->expired);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(LaneStats &a, LaneStats &b) {
+  using ::std::swap;
+  swap(a.name, b.name);
+  swap(a.threads, b.threads);
+  swap(a.running, b.running);
+  swap(a.queued, b.queued);
+  swap(a.rejected, b.rejected);
+  swap(a.expired, b.expired);
+  swap(a.__isset, b.__isset);
+}
+
+LaneStats::LaneStats(const LaneStats& other78) {
+  name = other78.name;
+  threads = other78.threads;
+  running = other78.running;
+  queued = other78.queued;
+  rejected = other78.rejected;
+  expired = other78.expired;
+  __isset = other78.__isset;
+}
+LaneStats& LaneStats::operator=(const LaneStats& other79) {
+  name = other79.name;
+  threads = other79.threads;
+  running = other79.running;
+  queued = other79.queued;
+  rejected = other79.rejected;
+  expired = other79.expired;
+  __isset = other79.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const LaneStats& obj) {
+  using apache::thrift::to_string;
+  out << "LaneStats(";
+  out << "name=" << to_string(obj.name);
+  out << ", " << "threads=" << to_string(obj.threads);
+  out << ", " << "running=" << to_string(obj.running);
+  out << ", " << "queued=" << to_string(obj.queued);
+  out << ", " << "rejected=" << to_string(obj.rejected);
+  out << ", " << "expired=" << to_string(obj.expired);
+  out << ")";
+  return out;
+}
+
+
+BatchOptions::~BatchOptions() throw() {
+}
+
+
+void BatchOptions::__set_parallelism(const int32_t val) {
+  this->parallelism = val;
+}
+
+void BatchOptions::__set_staggerMs(const int32_t val) {
+  this->staggerMs = val;
+}
+
+const char* BatchOptions::ascii_fingerprint = "989D1F1AE8D148D5E2119FFEC4BBBEE3";
+const uint8_t BatchOptions::binary_fingerprint[16] = {0x98,0x9D,0x1F,0x1A,0xE8,0xD1,0x48,0xD5,0xE2,0x11,0x9F,0xFE,0xC4,0xBB,0xBE,0xE3};
+
+uint32_t BatchOptions::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->parallelism);
+          this->__isset.parallelism = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->staggerMs);
+          this->__isset.staggerMs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t BatchOptions::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("BatchOptions");
+
+  xfer += oprot->writeFieldBegin("parallelism", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(this->parallelism);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("staggerMs", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->staggerMs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(BatchOptions &a, BatchOptions &b) {
+  using ::std::swap;
+  swap(a.parallelism, b.parallelism);
+  swap(a.staggerMs, b.staggerMs);
+  swap(a.__isset, b.__isset);
+}
+
+BatchOptions::BatchOptions(const BatchOptions& other80) {
+  parallelism = other80.parallelism;
+  staggerMs = other80.staggerMs;
+  __isset = other80.__isset;
+}
+BatchOptions& BatchOptions::operator=(const BatchOptions& other81) {
+  parallelism = other81.parallelism;
+  staggerMs = other81.staggerMs;
+  __isset = other81.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const BatchOptions& obj) {
+  using apache::thrift::to_string;
+  out << "BatchOptions(";
+  out << "parallelism=" << to_string(obj.parallelism);
+  out << ", " << "staggerMs=" << to_string(obj.staggerMs);
+  out << ")";
+  return out;
+}
+
+
+DomainResult::~DomainResult() throw() {
+}
+
+
+void DomainResult::__set_domainName(const std::string& val) {
+  this->domainName = val;
+}
+
+void DomainResult::__set_success(const bool val) {
+  this->success = val;
+}
+
+void DomainResult::__set_error(const LibvirtException& val) {
+  this->error = val;
+}
+
+void DomainResult::__set_durationMs(const double val) {
+  this->durationMs = val;
+}
+
+void DomainResult::__set_state(const DomainState::type val) {
+  this->state = val;
+}
+
+void DomainResult::__set_forced(const bool val) {
+  this->forced = val;
+}
+
+const char* DomainResult::ascii_fingerprint = "4FC1F050FC8E4F0FCF8815CD3FD89177";
+const uint8_t DomainResult::binary_fingerprint[16] = {0x4F,0xC1,0xF0,0x50,0xFC,0x8E,0x4F,0x0F,0xCF,0x88,0x15,0xCD,0x3F,0xD8,0x91,0x77};
+
+uint32_t DomainResult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->domainName);
+          this->__isset.domainName = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->success);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->error.read(iprot);
+          this->__isset.error = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->durationMs);
+          this->__isset.durationMs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          int32_t ecast82;
+          xfer += iprot->readI32(ecast82);
+          this->state = (DomainState::type)ecast82;
+          this->__isset.state = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->forced);
+          this->__isset.forced = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t DomainResult::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("DomainResult");
+
+  xfer += oprot->writeFieldBegin("domainName", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->domainName);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_BOOL, 2);
+  xfer += oprot->writeBool(this->success);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_STRUCT, 3);
+  xfer += this->error.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("durationMs", ::apache::thrift::protocol::T_DOUBLE, 4);
+  xfer += oprot->writeDouble(this->durationMs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("state", ::apache::thrift::protocol::T_I32, 5);
+  xfer += oprot->writeI32((int32_t)this->state);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("forced", ::apache::thrift::protocol::T_BOOL, 6);
+  xfer += oprot->writeBool(this->forced);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(DomainResult &a, DomainResult &b) {
+  using ::std::swap;
+  swap(a.domainName, b.domainName);
+  swap(a.success, b.success);
+  swap(a.error, b.error);
+  swap(a.durationMs, b.durationMs);
+  swap(a.state, b.state);
+  swap(a.forced, b.forced);
+  swap(a.__isset, b.__isset);
+}
+
+DomainResult::DomainResult(const DomainResult& other83) {
+  domainName = other83.domainName;
+  success = other83.success;
+  error = other83.error;
+  durationMs = other83.durationMs;
+  state = other83.state;
+  forced = other83.forced;
+  __isset = other83.__isset;
+}
+DomainResult& DomainResult::operator=(const DomainResult& other84) {
+  domainName = other84.domainName;
+  success = other84.success;
+  error = other84.error;
+  durationMs = other84.durationMs;
+  state = other84.state;
+  forced = other84.forced;
+  __isset = other84.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const DomainResult& obj) {
+  using apache::thrift::to_string;
+  out << "DomainResult(";
+  out << "domainName=" << to_string(obj.domainName);
+  out << ", " << "success=" << to_string(obj.success);
+  out << ", " << "error=" << to_string(obj.error);
+  out << ", " << "durationMs=" << to_string(obj.durationMs);
+  out << ", " << "state=" << to_string(obj.state);
+  out << ", " << "forced=" << to_string(obj.forced);
+  out << ")";
+  return out;
+}
+
+
+DomainLockStats::~DomainLockStats() throw() {
+}
+
+
+void DomainLockStats::__set_acquired(const int64_t val) {
+  this->acquired = val;
+}
+
+void DomainLockStats::__set_contended(const int64_t val) {
+  this->contended = val;
+}
+
+void DomainLockStats::__set_waitMs(const double val) {
+  this->waitMs = val;
+}
+
+void DomainLockStats::__set_maxWaitMs(const double val) {
+  this->maxWaitMs = val;
+}
+
+void DomainLockStats::__set_held(const int32_t val) {
+  this->held = val;
+}
+
+const char* DomainLockStats::ascii_fingerprint = "F0AE1AE2F9ADFFAA90E3D3839EFD3BEE";
+const uint8_t DomainLockStats::binary_fingerprint[16] = {0xF0,0xAE,0x1A,0xE2,0xF9,0xAD,0xFF,0xAA,0x90,0xE3,0xD3,0x83,0x9E,0xFD,0x3B,0xEE};
+
+uint32_t DomainLockStats::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->acquired);
+          this->__isset.acquired = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->contended);
+          this->__isset.contended = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->waitMs);
+          this->__isset.waitMs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->maxWaitMs);
+          this->__isset.maxWaitMs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->held);
+          this->__isset.held = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t DomainLockStats::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("DomainLockStats");
+
+  xfer += oprot->writeFieldBegin("acquired", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->acquired);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("contended", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->contended);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("waitMs", ::apache::thrift::protocol::T_DOUBLE, 3);
+  xfer += oprot->writeDouble(this->waitMs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("maxWaitMs", ::apache::thrift::protocol::T_DOUBLE, 4);
+  xfer += oprot->writeDouble(this->maxWaitMs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("held", ::apache::thrift::protocol::T_I32, 5);
+  xfer += oprot->writeI32(this->held);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(DomainLockStats &a, DomainLockStats &b) {
+  using ::std::swap;
+  swap(a.acquired, b.acquired);
+  swap(a.contended, b.contended);
+  swap(a.waitMs, b.waitMs);
+  swap(a.maxWaitMs, b.maxWaitMs);
+  swap(a.held, b.held);
+  swap(a.__isset, b.__isset);
+}
+
+DomainLockStats::DomainLockStats(const DomainLockStats& other85) {
+  acquired = other85.acquired;
+  contended = other85.contended;
+  waitMs = other85.waitMs;
+  maxWaitMs = other85.maxWaitMs;
+  held = other85.held;
+  __isset = other85.__isset;
+}
+DomainLockStats& DomainLockStats::operator=(const DomainLockStats& other86) {
+  acquired = other86.acquired;
+  contended = other86.contended;
+  waitMs = other86.waitMs;
+  maxWaitMs = other86.maxWaitMs;
+  held = other86.held;
+  __isset = other86.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const DomainLockStats& obj) {
+  using apache::thrift::to_string;
+  out << "DomainLockStats(";
+  out << "acquired=" << to_string(obj.acquired);
+  out << ", " << "contended=" << to_string(obj.contended);
+  out << ", " << "waitMs=" << to_string(obj.waitMs);
+  out << ", " << "maxWaitMs=" << to_string(obj.maxWaitMs);
+  out << ", " << "held=" << to_string(obj.held);
+  out << ")";
+  return out;
+}
+
+
+ServerStats::~ServerStats() throw() {
+}
+
+
+void ServerStats::__set_uptimeSeconds(const int64_t val) {
+  this->uptimeSeconds = val;
+}
+
+void ServerStats::__set_inFlight(const int32_t val) {
+  this->inFlight = val;
+}
+
+void ServerStats::__set_queueDepth(const int32_t val) {
+  this->queueDepth = val;
+}
+
+void ServerStats::__set_errors(const int64_t val) {
+  this->errors = val;
+}
+
+void ServerStats::__set_methods(const std::vector<MethodStats> & val) {
+  this->methods = val;
+}
+
+void ServerStats::__set_lanes(const std::vector<LaneStats> & val) {
+  this->lanes = val;
+}
+
+void ServerStats::__set_shed(const int64_t val) {
+  this->shed = val;
+}
+
+void ServerStats::__set_timedOut(const int64_t val) {
+  this->timedOut = val;
+}
+
+void ServerStats::__set_stuck(const int32_t val) {
+  this->stuck = val;
+}
+
+void ServerStats::__set_domainLocks(const DomainLockStats& val) {
+  this->domainLocks = val;
+}
+
+const char* ServerStats::ascii_fingerprint = "C1305F5B8897ECFD97D572B55BA8D3D0";
+const uint8_t ServerStats::binary_fingerprint[16] = {0xC1,0x30,0x5F,0x5B,0x88,0x97,0xEC,0xFD,0x97,0xD5,0x72,0xB5,0x5B,0xA8,0xD3,0xD0};
+
+uint32_t ServerStats::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->uptimeSeconds);
+          this->__isset.uptimeSeconds = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->inFlight);
+          this->__isset.inFlight = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->queueDepth);
+          this->__isset.queueDepth = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->errors);
+          this->__isset.errors = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->methods.clear();
+            uint32_t _size87;
+            ::apache::thrift::protocol::TType _etype90;
+            xfer += iprot->readListBegin(_etype90, _size87);
+            this->methods.resize(_size87);
+            uint32_t _i91;
+            for (_i91 = 0; _i91 < _size87; ++_i91)
+            {
+              xfer += this->methods[_i91].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.methods = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->lanes.clear();
+            uint32_t _size92;
+            ::apache::thrift::protocol::TType _etype95;
+            xfer += iprot->readListBegin(_etype95, _size92);
+            this->lanes.resize(_size92);
+            uint32_t _i96;
+            for (_i96 = 0; _i96 < _size92; ++_i96)
+            {
+              xfer += this->lanes[_i96].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.lanes = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->shed);
+          this->__isset.shed = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 8:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->timedOut);
+          this->__isset.timedOut = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 9:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->stuck);
+          this->__isset.stuck = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 10:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->domainLocks.read(iprot);
+          this->__isset.domainLocks = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ServerStats::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  oprot->incrementRecursionDepth();
+  xfer += oprot->writeStructBegin("ServerStats");
+
+  xfer += oprot->writeFieldBegin("uptimeSeconds", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->uptimeSeconds);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("inFlight", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->inFlight);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("queueDepth", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->queueDepth);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("errors", ::apache::thrift::protocol::T_I64, 4);
+  xfer += oprot->writeI64(this->errors);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("methods", ::apache::thrift::protocol::T_LIST, 5);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->methods.size()));
+    std::vector<MethodStats> ::const_iterator _iter97;
+    for (_iter97 = this->methods.begin(); _iter97 != this->methods.end(); ++_iter97)
+    {
+      xfer += (*_iter97).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("lanes", ::apache::thrift::protocol::T_LIST, 6);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->lanes.size()));
+    std::vector<LaneStats> ::const_iterator _iter98;
+    for (_iter98 = this->lanes.begin(); _iter98 != this->lanes.end(); ++_iter98)
+    {
+      xfer += (*_iter98).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("shed", ::apache::thrift::protocol::T_I64, 7);
+  xfer += oprot->writeI64(this->shed);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("timedOut", ::apache::thrift::protocol::T_I64, 8);
+  xfer += oprot->writeI64(this->timedOut);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("stuck", ::apache::thrift::protocol::T_I32, 9);
+  xfer += oprot->writeI32(this->stuck);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("domainLocks", ::apache::thrift::protocol::T_STRUCT, 10);
+  xfer += this->domainLocks.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  oprot->decrementRecursionDepth();
+  return xfer;
+}
+
+void swap(ServerStats &a, ServerStats &b) {
+  using ::std::swap;
+  swap(a.uptimeSeconds, b.uptimeSeconds);
+  swap(a.inFlight, b.inFlight);
+  swap(a.queueDepth, b.queueDepth);
+  swap(a.errors, b.errors);
+  swap(a.methods, b.methods);
+  swap(a.lanes, b.lanes);
+  swap(a.shed, b.shed);
+  swap(a.timedOut, b.timedOut);
+  swap(a.stuck, b.stuck);
+  swap(a.domainLocks, b.domainLocks);
+  swap(a.__isset, b.__isset);
+}
+
+ServerStats::ServerStats(const ServerStats& other99) {
+  uptimeSeconds = other99.uptimeSeconds;
+  inFlight = other99.inFlight;
+  queueDepth = other99.queueDepth;
+  errors = other99.errors;
+  methods = other99.methods;
+  lanes = other99.lanes;
+  shed = other99.shed;
+  timedOut = other99.timedOut;
+  stuck = other99.stuck;
+  domainLocks = other99.domainLocks;
+  __isset = other99.__isset;
+}
+ServerStats& ServerStats::operator=(const ServerStats& other100) {
+  uptimeSeconds = other100.uptimeSeconds;
+  inFlight = other100.inFlight;
+  queueDepth = other100.queueDepth;
+  errors = other100.errors;
+  methods = other100.methods;
+  lanes = other100.lanes;
+  shed = other100.shed;
+  timedOut = other100.timedOut;
+  stuck = other100.stuck;
+  domainLocks = other100.domainLocks;
+  __isset = other100.__isset;
+  return *this;
+}
+std::ostream& operator<<(std::ostream& out, const ServerStats& obj) {
+  using apache::thrift::to_string;
+  out << "ServerStats(";
+  out << "uptimeSeconds=" << to_string(obj.uptimeSeconds);
+  out << ", " << "inFlight=" << to_string(obj.inFlight);
+  out << ", " << "queueDepth=" << to_string(obj.queueDepth);
+  out << ", " << "errors=" << to_string(obj.errors);
+  out << ", " << "methods=" << to_string(obj.methods);
+  out << ", " << "lanes=" << to_string(obj.lanes);
+  out << ", " << "shed=" << to_string(obj.shed);
+  out << ", " << "timedOut=" << to_string(obj.timedOut);
+  out << ", " << "stuck=" << to_string(obj.stuck);
+  out << ", " << "domainLocks=" << to_string(obj.domainLocks);
+  out << ")";
+  return out;
+}
+
+
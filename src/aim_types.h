@@ -30,6 +30,55 @@ struct DomainState {
 
 extern const std::map<int, const char*> _DomainState_VALUES_TO_NAMES;
 
+struct DomainFields {
+  enum type {
+    STATE = 1,
+    RESOURCES = 2,
+    FULL = 3
+  };
+};
+
+extern const std::map<int, const char*> _DomainFields_VALUES_TO_NAMES;
+
+struct DomainChangeType {
+  enum type {
+    ADDED = 1,
+    REMOVED = 2,
+    CHANGED = 3
+  };
+};
+
+extern const std::map<int, const char*> _DomainChangeType_VALUES_TO_NAMES;
+
+struct DomainEventType {
+  enum type {
+    DEFINED = 1,
+    UNDEFINED = 2,
+    STARTED = 3,
+    SUSPENDED = 4,
+    RESUMED = 5,
+    STOPPED = 6,
+    SHUTDOWN = 7,
+    PMSUSPENDED = 8,
+    CRASHED = 9,
+    JOB_COMPLETED = 10
+  };
+};
+
+extern const std::map<int, const char*> _DomainEventType_VALUES_TO_NAMES;
+
+struct JobState {
+  enum type {
+    QUEUED = 1,
+    RUNNING = 2,
+    DONE = 3,
+    FAILED = 4,
+    CANCELLED = 5
+  };
+};
+
+extern const std::map<int, const char*> _JobState_VALUES_TO_NAMES;
+
 class Datastore;
 
 class NetInterface;
@@ -46,6 +95,8 @@ class DomainBlockInfo;
 
 class BinaryFile;
 
+class FileChunk;
+
 class RimpException;
 
 class VLanException;
@@ -54,6 +105,32 @@ class StorageException;
 
 class LibvirtException;
 
+class TimeoutException;
+
+class OverloadException;
+
+class DomainChange;
+
+class DomainChanges;
+
+class DomainEvent;
+
+class DomainEvents;
+
+class JobStatus;
+
+class MethodStats;
+
+class LaneStats;
+
+class BatchOptions;
+
+class DomainResult;
+
+class DomainLockStats;
+
+class ServerStats;
+
 typedef struct _Datastore__isset {
   _Datastore__isset() : device(false), path(false), type(false), totalSize(false), usableSize(false) {}
   bool device :1;
@@ -524,6 +601,67 @@ class BinaryFile {
 
 void swap(BinaryFile &a, BinaryFile &b);
 
+typedef struct _FileChunk__isset {
+  _FileChunk__isset() : data(false), compressed(false), length(false), fileSize(false) {}
+  bool data :1;
+  bool compressed :1;
+  bool length :1;
+  bool fileSize :1;
+} _FileChunk__isset;
+
+class FileChunk {
+ public:
+
+  static const char* ascii_fingerprint; // = "18471C816D79ACB2CF7F5DD20F9923CD";
+  static const uint8_t binary_fingerprint[16]; // = {0x18,0x47,0x1C,0x81,0x6D,0x79,0xAC,0xB2,0xCF,0x7F,0x5D,0xD2,0x0F,0x99,0x23,0xCD};
+
+  FileChunk(const FileChunk&);
+  FileChunk& operator=(const FileChunk&);
+  FileChunk() : data(), compressed(0), length(0), fileSize(0) {
+  }
+
+  virtual ~FileChunk() throw();
+  std::string data;
+  bool compressed;
+  int32_t length;
+  int64_t fileSize;
+
+  _FileChunk__isset __isset;
+
+  void __set_data(const std::string& val);
+
+  void __set_compressed(const bool val);
+
+  void __set_length(const int32_t val);
+
+  void __set_fileSize(const int64_t val);
+
+  bool operator == (const FileChunk & rhs) const
+  {
+    if (!(data == rhs.data))
+      return false;
+    if (!(compressed == rhs.compressed))
+      return false;
+    if (!(length == rhs.length))
+      return false;
+    if (!(fileSize == rhs.fileSize))
+      return false;
+    return true;
+  }
+  bool operator != (const FileChunk &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const FileChunk & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const FileChunk& obj);
+};
+
+void swap(FileChunk &a, FileChunk &b);
+
 typedef struct _RimpException__isset {
   _RimpException__isset() : description(false) {}
   bool description :1;
@@ -744,6 +882,871 @@ class LibvirtException : public ::apache::thrift::TException {
 
 void swap(LibvirtException &a, LibvirtException &b);
 
+typedef struct _TimeoutException__isset {
+  _TimeoutException__isset() : description(false), timeoutMs(false) {}
+  bool description :1;
+  bool timeoutMs :1;
+} _TimeoutException__isset;
+
+class TimeoutException : public ::apache::thrift::TException {
+ public:
+
+  static const char* ascii_fingerprint; // = "EEBC915CE44901401D881E6091423036";
+  static const uint8_t binary_fingerprint[16]; // = {0xEE,0xBC,0x91,0x5C,0xE4,0x49,0x01,0x40,0x1D,0x88,0x1E,0x60,0x91,0x42,0x30,0x36};
+
+  TimeoutException(const TimeoutException&);
+  TimeoutException& operator=(const TimeoutException&);
+  TimeoutException() : description(), timeoutMs(0) {
+  }
+
+  virtual ~TimeoutException() throw();
+  std::string description;
+  int32_t timeoutMs;
+
+  _TimeoutException__isset __isset;
+
+  void __set_description(const std::string& val);
+
+  void __set_timeoutMs(const int32_t val);
+
+  bool operator == (const TimeoutException & rhs) const
+  {
+    if (!(description == rhs.description))
+      return false;
+    if (!(timeoutMs == rhs.timeoutMs))
+      return false;
+    return true;
+  }
+  bool operator != (const TimeoutException &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TimeoutException & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const TimeoutException& obj);
+};
+
+void swap(TimeoutException &a, TimeoutException &b);
+
+typedef struct _OverloadException__isset {
+  _OverloadException__isset() : description(false), lane(false), retryAfterMs(false) {}
+  bool description :1;
+  bool lane :1;
+  bool retryAfterMs :1;
+} _OverloadException__isset;
+
+class OverloadException : public ::apache::thrift::TException {
+ public:
+
+  static const char* ascii_fingerprint; // = "343DA57F446177400B333DC49B037B0C";
+  static const uint8_t binary_fingerprint[16]; // = {0x34,0x3D,0xA5,0x7F,0x44,0x61,0x77,0x40,0x0B,0x33,0x3D,0xC4,0x9B,0x03,0x7B,0x0C};
+
+  OverloadException(const OverloadException&);
+  OverloadException& operator=(const OverloadException&);
+  OverloadException() : description(), lane(), retryAfterMs(0) {
+  }
+
+  virtual ~OverloadException() throw();
+  std::string description;
+  std::string lane;
+  int32_t retryAfterMs;
+
+  _OverloadException__isset __isset;
+
+  void __set_description(const std::string& val);
+
+  void __set_lane(const std::string& val);
+
+  void __set_retryAfterMs(const int32_t val);
+
+  bool operator == (const OverloadException & rhs) const
+  {
+    if (!(description == rhs.description))
+      return false;
+    if (!(lane == rhs.lane))
+      return false;
+    if (!(retryAfterMs == rhs.retryAfterMs))
+      return false;
+    return true;
+  }
+  bool operator != (const OverloadException &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const OverloadException & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const OverloadException& obj);
+};
+
+void swap(OverloadException &a, OverloadException &b);
+
+typedef struct _DomainChange__isset {
+  _DomainChange__isset() : type(false), uuid(false), info(false) {}
+  bool type :1;
+  bool uuid :1;
+  bool info :1;
+} _DomainChange__isset;
+
+class DomainChange {
+ public:
+
+  static const char* ascii_fingerprint; // = "56A8349B3CF43B15BBA36C6A262194A7";
+  static const uint8_t binary_fingerprint[16]; // = {0x56,0xA8,0x34,0x9B,0x3C,0xF4,0x3B,0x15,0xBB,0xA3,0x6C,0x6A,0x26,0x21,0x94,0xA7};
+
+  DomainChange(const DomainChange&);
+  DomainChange& operator=(const DomainChange&);
+  DomainChange() : type((DomainChangeType::type)0), uuid() {
+  }
+
+  virtual ~DomainChange() throw();
+  DomainChangeType::type type;
+  std::string uuid;
+  DomainInfo info;
+
+  _DomainChange__isset __isset;
+
+  void __set_type(const DomainChangeType::type val);
+
+  void __set_uuid(const std::string& val);
+
+  void __set_info(const DomainInfo& val);
+
+  bool operator == (const DomainChange & rhs) const
+  {
+    if (!(type == rhs.type))
+      return false;
+    if (!(uuid == rhs.uuid))
+      return false;
+    if (!(info == rhs.info))
+      return false;
+    return true;
+  }
+  bool operator != (const DomainChange &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const DomainChange & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const DomainChange& obj);
+};
+
+void swap(DomainChange &a, DomainChange &b);
+
+typedef struct _DomainChanges__isset {
+  _DomainChanges__isset() : generation(false), snapshot(false), changes(false), domains(false) {}
+  bool generation :1;
+  bool snapshot :1;
+  bool changes :1;
+  bool domains :1;
+} _DomainChanges__isset;
+
+class DomainChanges {
+ public:
+
+  static const char* ascii_fingerprint; // = "2DEA1A41B33B1DB5E6B47EAE53840C4F";
+  static const uint8_t binary_fingerprint[16]; // = {0x2D,0xEA,0x1A,0x41,0xB3,0x3B,0x1D,0xB5,0xE6,0xB4,0x7E,0xAE,0x53,0x84,0x0C,0x4F};
+
+  DomainChanges(const DomainChanges&);
+  DomainChanges& operator=(const DomainChanges&);
+  DomainChanges() : generation(0), snapshot(0) {
+  }
+
+  virtual ~DomainChanges() throw();
+  int64_t generation;
+  bool snapshot;
+  std::vector<DomainChange>  changes;
+  std::vector<DomainInfo>  domains;
+
+  _DomainChanges__isset __isset;
+
+  void __set_generation(const int64_t val);
+
+  void __set_snapshot(const bool val);
+
+  void __set_changes(const std::vector<DomainChange> & val);
+
+  void __set_domains(const std::vector<DomainInfo> & val);
+
+  bool operator == (const DomainChanges & rhs) const
+  {
+    if (!(generation == rhs.generation))
+      return false;
+    if (!(snapshot == rhs.snapshot))
+      return false;
+    if (!(changes == rhs.changes))
+      return false;
+    if (!(domains == rhs.domains))
+      return false;
+    return true;
+  }
+  bool operator != (const DomainChanges &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const DomainChanges & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const DomainChanges& obj);
+};
+
+void swap(DomainChanges &a, DomainChanges &b);
+
+typedef struct _DomainEvent__isset {
+  _DomainEvent__isset() : id(false), timestamp(false), uuid(false), name(false), type(false), detail(false) {}
+  bool id :1;
+  bool timestamp :1;
+  bool uuid :1;
+  bool name :1;
+  bool type :1;
+  bool detail :1;
+} _DomainEvent__isset;
+
+class DomainEvent {
+ public:
+
+  static const char* ascii_fingerprint; // = "DB3F31E03CBAFD8067AAC763865105D8";
+  static const uint8_t binary_fingerprint[16]; // = {0xDB,0x3F,0x31,0xE0,0x3C,0xBA,0xFD,0x80,0x67,0xAA,0xC7,0x63,0x86,0x51,0x05,0xD8};
+
+  DomainEvent(const DomainEvent&);
+  DomainEvent& operator=(const DomainEvent&);
+  DomainEvent() : id(0), timestamp(0), uuid(), name(), type((DomainEventType::type)0), detail(0) {
+  }
+
+  virtual ~DomainEvent() throw();
+  int64_t id;
+  int64_t timestamp;
+  std::string uuid;
+  std::string name;
+  DomainEventType::type type;
+  int32_t detail;
+
+  _DomainEvent__isset __isset;
+
+  void __set_id(const int64_t val);
+
+  void __set_timestamp(const int64_t val);
+
+  void __set_uuid(const std::string& val);
+
+  void __set_name(const std::string& val);
+
+  void __set_type(const DomainEventType::type val);
+
+  void __set_detail(const int32_t val);
+
+  bool operator == (const DomainEvent & rhs) const
+  {
+    if (!(id == rhs.id))
+      return false;
+    if (!(timestamp == rhs.timestamp))
+      return false;
+    if (!(uuid == rhs.uuid))
+      return false;
+    if (!(name == rhs.name))
+      return false;
+    if (!(type == rhs.type))
+      return false;
+    if (!(detail == rhs.detail))
+      return false;
+    return true;
+  }
+  bool operator != (const DomainEvent &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const DomainEvent & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const DomainEvent& obj);
+};
+
+void swap(DomainEvent &a, DomainEvent &b);
+
+typedef struct _DomainEvents__isset {
+  _DomainEvents__isset() : lastId(false), lost(false), events(false) {}
+  bool lastId :1;
+  bool lost :1;
+  bool events :1;
+} _DomainEvents__isset;
+
+class DomainEvents {
+ public:
+
+  static const char* ascii_fingerprint; // = "1CD8F39C6B5F6D12DAC8520408FB3AD9";
+  static const uint8_t binary_fingerprint[16]; // = {0x1C,0xD8,0xF3,0x9C,0x6B,0x5F,0x6D,0x12,0xDA,0xC8,0x52,0x04,0x08,0xFB,0x3A,0xD9};
+
+  DomainEvents(const DomainEvents&);
+  DomainEvents& operator=(const DomainEvents&);
+  DomainEvents() : lastId(0), lost(0) {
+  }
+
+  virtual ~DomainEvents() throw();
+  int64_t lastId;
+  bool lost;
+  std::vector<DomainEvent>  events;
+
+  _DomainEvents__isset __isset;
+
+  void __set_lastId(const int64_t val);
+
+  void __set_lost(const bool val);
+
+  void __set_events(const std::vector<DomainEvent> & val);
+
+  bool operator == (const DomainEvents & rhs) const
+  {
+    if (!(lastId == rhs.lastId))
+      return false;
+    if (!(lost == rhs.lost))
+      return false;
+    if (!(events == rhs.events))
+      return false;
+    return true;
+  }
+  bool operator != (const DomainEvents &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const DomainEvents & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const DomainEvents& obj);
+};
+
+void swap(DomainEvents &a, DomainEvents &b);
+
+typedef struct _JobStatus__isset {
+  _JobStatus__isset() : id(false), state(false), totalBytes(false), copiedBytes(false), bytesPerSecond(false), etaSeconds(false), error(false) {}
+  bool id :1;
+  bool state :1;
+  bool totalBytes :1;
+  bool copiedBytes :1;
+  bool bytesPerSecond :1;
+  bool etaSeconds :1;
+  bool error :1;
+} _JobStatus__isset;
+
+class JobStatus {
+ public:
+
+  static const char* ascii_fingerprint; // = "04E6DE613C75D453E4AC814BC521328F";
+  static const uint8_t binary_fingerprint[16]; // = {0x04,0xE6,0xDE,0x61,0x3C,0x75,0xD4,0x53,0xE4,0xAC,0x81,0x4B,0xC5,0x21,0x32,0x8F};
+
+  JobStatus(const JobStatus&);
+  JobStatus& operator=(const JobStatus&);
+  JobStatus() : id(), state((JobState::type)0), totalBytes(0), copiedBytes(0), bytesPerSecond(0), etaSeconds(0), error() {
+  }
+
+  virtual ~JobStatus() throw();
+  std::string id;
+  JobState::type state;
+  int64_t totalBytes;
+  int64_t copiedBytes;
+  double bytesPerSecond;
+  int32_t etaSeconds;
+  std::string error;
+
+  _JobStatus__isset __isset;
+
+  void __set_id(const std::string& val);
+
+  void __set_state(const JobState::type val);
+
+  void __set_totalBytes(const int64_t val);
+
+  void __set_copiedBytes(const int64_t val);
+
+  void __set_bytesPerSecond(const double val);
+
+  void __set_etaSeconds(const int32_t val);
+
+  void __set_error(const std::string& val);
+
+  bool operator == (const JobStatus & rhs) const
+  {
+    if (!(id == rhs.id))
+      return false;
+    if (!(state == rhs.state))
+      return false;
+    if (!(totalBytes == rhs.totalBytes))
+      return false;
+    if (!(copiedBytes == rhs.copiedBytes))
+      return false;
+    if (!(bytesPerSecond == rhs.bytesPerSecond))
+      return false;
+    if (!(etaSeconds == rhs.etaSeconds))
+      return false;
+    if (!(error == rhs.error))
+      return false;
+    return true;
+  }
+  bool operator != (const JobStatus &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const JobStatus & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const JobStatus& obj);
+};
+
+void swap(JobStatus &a, JobStatus &b);
+
+typedef struct _MethodStats__isset {
+  _MethodStats__isset() : name(false), calls(false), errors(false), inFlight(false), p50Ms(false), p99Ms(false), maxMs(false) {}
+  bool name :1;
+  bool calls :1;
+  bool errors :1;
+  bool inFlight :1;
+  bool p50Ms :1;
+  bool p99Ms :1;
+  bool maxMs :1;
+} _MethodStats__isset;
+
+class MethodStats {
+ public:
+
+  static const char* ascii_fingerprint; // = "D2F2074A4FE0C6791D82A824BABC3296";
+  static const uint8_t binary_fingerprint[16]; // = {0xD2,0xF2,0x07,0x4A,0x4F,0xE0,0xC6,0x79,0x1D,0x82,0xA8,0x24,0xBA,0xBC,0x32,0x96};
+
+  MethodStats(const MethodStats&);
+  MethodStats& operator=(const MethodStats&);
+  MethodStats() : name(), calls(0), errors(0), inFlight(0), p50Ms(0), p99Ms(0), maxMs(0) {
+  }
+
+  virtual ~MethodStats() throw();
+  std::string name;
+  int64_t calls;
+  int64_t errors;
+  int32_t inFlight;
+  double p50Ms;
+  double p99Ms;
+  double maxMs;
+
+  _MethodStats__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_calls(const int64_t val);
+
+  void __set_errors(const int64_t val);
+
+  void __set_inFlight(const int32_t val);
+
+  void __set_p50Ms(const double val);
+
+  void __set_p99Ms(const double val);
+
+  void __set_maxMs(const double val);
+
+  bool operator == (const MethodStats & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(calls == rhs.calls))
+      return false;
+    if (!(errors == rhs.errors))
+      return false;
+    if (!(inFlight == rhs.inFlight))
+      return false;
+    if (!(p50Ms == rhs.p50Ms))
+      return false;
+    if (!(p99Ms == rhs.p99Ms))
+      return false;
+    if (!(maxMs == rhs.maxMs))
+      return false;
+    return true;
+  }
+  bool operator != (const MethodStats &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const MethodStats & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const MethodStats& obj);
+};
+
+void swap(MethodStats &a, MethodStats &b);
+
+typedef struct _LaneStats__isset {
+  _LaneStats__isset() : name(false), threads(false), running(false), queued(false), rejected(false), expired(false) {}
+  bool name :1;
+  bool threads :1;
+  bool running :1;
+  bool queued :1;
+  bool rejected :1;
+  bool expired :1;
+} _LaneStats__isset;
+
+class LaneStats {
+ public:
+
+  static const char* ascii_fingerprint; // = "8CC9D9969B0006B5C073C8E938B1EBB7";
+  static const uint8_t binary_fingerprint[16]; // = {0x8C,0xC9,0xD9,0x96,0x9B,0x00,0x06,0xB5,0xC0,0x73,0xC8,0xE9,0x38,0xB1,0xEB,0xB7};
+
+  LaneStats(const LaneStats&);
+  LaneStats& operator=(const LaneStats&);
+  LaneStats() : name(), threads(0), running(0), queued(0), rejected(0), expired(0) {
+  }
+
+  virtual ~LaneStats() throw();
+  std::string name;
+  int32_t threads;
+  int32_t running;
+  int32_t queued;
+  int64_t rejected;
+  int64_t expired;
+
+  _LaneStats__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_threads(const int32_t val);
+
+  void __set_running(const int32_t val);
+
+  void __set_queued(const int32_t val);
+
+  void __set_rejected(const int64_t val);
+
+  void __set_expired(const int64_t val);
+
+  bool operator == (const LaneStats & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(threads == rhs.threads))
+      return false;
+    if (!(running == rhs.running))
+      return false;
+    if (!(queued == rhs.queued))
+      return false;
+    if (!(rejected == rhs.rejected))
+      return false;
+    if (!(expired == rhs.expired))
+      return false;
+    return true;
+  }
+  bool operator != (const LaneStats &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const LaneStats & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const LaneStats& obj);
+};
+
+void swap(LaneStats &a, LaneStats &b);
+
+typedef struct _BatchOptions__isset {
+  _BatchOptions__isset() : parallelism(false), staggerMs(false) {}
+  bool parallelism :1;
+  bool staggerMs :1;
+} _BatchOptions__isset;
+
+class BatchOptions {
+ public:
+
+  static const char* ascii_fingerprint; // = "989D1F1AE8D148D5E2119FFEC4BBBEE3";
+  static const uint8_t binary_fingerprint[16]; // = {0x98,0x9D,0x1F,0x1A,0xE8,0xD1,0x48,0xD5,0xE2,0x11,0x9F,0xFE,0xC4,0xBB,0xBE,0xE3};
+
+  BatchOptions(const BatchOptions&);
+  BatchOptions& operator=(const BatchOptions&);
+  BatchOptions() : parallelism(0), staggerMs(0) {
+  }
+
+  virtual ~BatchOptions() throw();
+  int32_t parallelism;
+  int32_t staggerMs;
+
+  _BatchOptions__isset __isset;
+
+  void __set_parallelism(const int32_t val);
+
+  void __set_staggerMs(const int32_t val);
+
+  bool operator == (const BatchOptions & rhs) const
+  {
+    if (!(parallelism == rhs.parallelism))
+      return false;
+    if (!(staggerMs == rhs.staggerMs))
+      return false;
+    return true;
+  }
+  bool operator != (const BatchOptions &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const BatchOptions & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const BatchOptions& obj);
+};
+
+void swap(BatchOptions &a, BatchOptions &b);
+
+typedef struct _DomainResult__isset {
+  _DomainResult__isset() : domainName(false), success(false), error(false), durationMs(false), state(false), forced(false) {}
+  bool domainName :1;
+  bool success :1;
+  bool error :1;
+  bool durationMs :1;
+  bool state :1;
+  bool forced :1;
+} _DomainResult__isset;
+
+class DomainResult {
+ public:
+
+  static const char* ascii_fingerprint; // = "4FC1F050FC8E4F0FCF8815CD3FD89177";
+  static const uint8_t binary_fingerprint[16]; // = {0x4F,0xC1,0xF0,0x50,0xFC,0x8E,0x4F,0x0F,0xCF,0x88,0x15,0xCD,0x3F,0xD8,0x91,0x77};
+
+  DomainResult(const DomainResult&);
+  DomainResult& operator=(const DomainResult&);
+  DomainResult() : domainName(), success(0), durationMs(0), state((DomainState::type)0), forced(0) {
+  }
+
+  virtual ~DomainResult() throw();
+  std::string domainName;
+  bool success;
+  LibvirtException error;
+  double durationMs;
+  DomainState::type state;
+  bool forced;
+
+  _DomainResult__isset __isset;
+
+  void __set_domainName(const std::string& val);
+
+  void __set_success(const bool val);
+
+  void __set_error(const LibvirtException& val);
+
+  void __set_durationMs(const double val);
+
+  void __set_state(const DomainState::type val);
+
+  void __set_forced(const bool val);
+
+  bool operator == (const DomainResult & rhs) const
+  {
+    if (!(domainName == rhs.domainName))
+      return false;
+    if (!(success == rhs.success))
+      return false;
+    if (!(error == rhs.error))
+      return false;
+    if (!(durationMs == rhs.durationMs))
+      return false;
+    if (!(state == rhs.state))
+      return false;
+    if (!(forced == rhs.forced))
+      return false;
+    return true;
+  }
+  bool operator != (const DomainResult &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const DomainResult & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const DomainResult& obj);
+};
+
+void swap(DomainResult &a, DomainResult &b);
+
+typedef struct _DomainLockStats__isset {
+  _DomainLockStats__isset() : acquired(false), contended(false), waitMs(false), maxWaitMs(false), held(false) {}
+  bool acquired :1;
+  bool contended :1;
+  bool waitMs :1;
+  bool maxWaitMs :1;
+  bool held :1;
+} _DomainLockStats__isset;
+
+class DomainLockStats {
+ public:
+
+  static const char* ascii_fingerprint; // = "F0AE1AE2F9ADFFAA90E3D3839EFD3BEE";
+  static const uint8_t binary_fingerprint[16]; // = {0xF0,0xAE,0x1A,0xE2,0xF9,0xAD,0xFF,0xAA,0x90,0xE3,0xD3,0x83,0x9E,0xFD,0x3B,0xEE};
+
+  DomainLockStats(const DomainLockStats&);
+  DomainLockStats& operator=(const DomainLockStats&);
+  DomainLockStats() : acquired(0), contended(0), waitMs(0), maxWaitMs(0), held(0) {
+  }
+
+  virtual ~DomainLockStats() throw();
+  int64_t acquired;
+  int64_t contended;
+  double waitMs;
+  double maxWaitMs;
+  int32_t held;
+
+  _DomainLockStats__isset __isset;
+
+  void __set_acquired(const int64_t val);
+
+  void __set_contended(const int64_t val);
+
+  void __set_waitMs(const double val);
+
+  void __set_maxWaitMs(const double val);
+
+  void __set_held(const int32_t val);
+
+  bool operator == (const DomainLockStats & rhs) const
+  {
+    if (!(acquired == rhs.acquired))
+      return false;
+    if (!(contended == rhs.contended))
+      return false;
+    if (!(waitMs == rhs.waitMs))
+      return false;
+    if (!(maxWaitMs == rhs.maxWaitMs))
+      return false;
+    if (!(held == rhs.held))
+      return false;
+    return true;
+  }
+  bool operator != (const DomainLockStats &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const DomainLockStats & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const DomainLockStats& obj);
+};
+
+void swap(DomainLockStats &a, DomainLockStats &b);
+
+typedef struct _ServerStats__isset {
+  _ServerStats__isset() : uptimeSeconds(false), inFlight(false), queueDepth(false), errors(false), methods(false), lanes(false), shed(false), timedOut(false), stuck(false), domainLocks(false) {}
+  bool uptimeSeconds :1;
+  bool inFlight :1;
+  bool queueDepth :1;
+  bool errors :1;
+  bool methods :1;
+  bool lanes :1;
+  bool shed :1;
+  bool timedOut :1;
+  bool stuck :1;
+  bool domainLocks :1;
+} _ServerStats__isset;
+
+class ServerStats {
+ public:
+
+  static const char* ascii_fingerprint; // = "C1305F5B8897ECFD97D572B55BA8D3D0";
+  static const uint8_t binary_fingerprint[16]; // = {0xC1,0x30,0x5F,0x5B,0x88,0x97,0xEC,0xFD,0x97,0xD5,0x72,0xB5,0x5B,0xA8,0xD3,0xD0};
+
+  ServerStats(const ServerStats&);
+  ServerStats& operator=(const ServerStats&);
+  ServerStats() : uptimeSeconds(0), inFlight(0), queueDepth(0), errors(0), shed(0), timedOut(0), stuck(0) {
+  }
+
+  virtual ~ServerStats() throw();
+  int64_t uptimeSeconds;
+  int32_t inFlight;
+  int32_t queueDepth;
+  int64_t errors;
+  std::vector<MethodStats>  methods;
+  std::vector<LaneStats>  lanes;
+  int64_t shed;
+  int64_t timedOut;
+  int32_t stuck;
+  DomainLockStats domainLocks;
+
+  _ServerStats__isset __isset;
+
+  void __set_uptimeSeconds(const int64_t val);
+
+  void __set_inFlight(const int32_t val);
+
+  void __set_queueDepth(const int32_t val);
+
+  void __set_errors(const int64_t val);
+
+  void __set_methods(const std::vector<MethodStats> & val);
+
+  void __set_lanes(const std::vector<LaneStats> & val);
+
+  void __set_shed(const int64_t val);
+
+  void __set_timedOut(const int64_t val);
+
+  void __set_stuck(const int32_t val);
+
+  void __set_domainLocks(const DomainLockStats& val);
+
+  bool operator == (const ServerStats & rhs) const
+  {
+    if (!(uptimeSeconds == rhs.uptimeSeconds))
+      return false;
+    if (!(inFlight == rhs.inFlight))
+      return false;
+    if (!(queueDepth == rhs.queueDepth))
+      return false;
+    if (!(errors == rhs.errors))
+      return false;
+    if (!(methods == rhs.methods))
+      return false;
+    if (!(lanes == rhs.lanes))
+      return false;
+    if (!(shed == rhs.shed))
+      return false;
+    if (!(timedOut == rhs.timedOut))
+      return false;
+    if (!(stuck == rhs.stuck))
+      return false;
+    if (!(domainLocks == rhs.domainLocks))
+      return false;
+    return true;
+  }
+  bool operator != (const ServerStats &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ServerStats & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  friend std::ostream& operator<<(std::ostream& out, const ServerStats& obj);
+};
+
+void swap(ServerStats &a, ServerStats &b);
+
 
 
 #endif
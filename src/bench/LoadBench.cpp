@@ -0,0 +1,449 @@
+#include <Aim.h>
+
+#include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/protocol/TCompactProtocol.h>
+#include <thrift/transport/TSocket.h>
+#include <thrift/transport/TBufferTransports.h>
+
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+
+using namespace ::apache::thrift;
+using namespace ::apache::thrift::protocol;
+using namespace ::apache::thrift::transport;
+using namespace boost::posix_time;
+using namespace std;
+
+/*
+ * Closed loop load generator. Each thread opens its own connection and
+ * sends requests back to back, picking the method of each one at random
+ * with the weights of the mix, for the given time. Reports the throughput
+ * and the latency percentiles of each method.
+ *
+ * Meant to run against an AIM using the libvirt test driver (see
+ * bench/run-bench.sh), so it needs no real virtual machines.
+ */
+
+#define DEFAULT_HOST        "localhost"
+#define DEFAULT_PORT        60606
+#define DEFAULT_THREADS     8
+#define DEFAULT_SECONDS     10
+#define DEFAULT_MIX         "getDomainsLite:40,getDomainInfo:30,getNodeInfo:10,getDatastores:10,getServerStats:10"
+#define DEFAULT_CHUNK_SIZE  (1024 * 1024)
+
+enum Outcome { OK, FAILED, SHED };
+
+struct Options
+{
+    string host;
+    int port;
+    int threads;
+    int seconds;
+    bool compact;
+    string mix;
+    string file;
+};
+
+struct Sample
+{
+    int method;
+    Outcome outcome;
+    uint32_t micros;
+};
+
+typedef Outcome (*Call)(AimClient& client, const Options& options, unsigned int& seed);
+
+static vector<string> domains;
+
+static const string& anyDomain(unsigned int& seed)
+{
+    return domains[rand_r(&seed) % domains.size()];
+}
+
+static Outcome getDomains(AimClient& client, const Options& options, unsigned int& seed)
+{
+    vector<DomainInfo> result;
+    client.getDomains(result);
+    return OK;
+}
+
+static Outcome getDomainsLite(AimClient& client, const Options& options, unsigned int& seed)
+{
+    vector<DomainInfo> result;
+    client.getDomainsLite(result);
+    return OK;
+}
+
+static Outcome getDomainsChangedSince(AimClient& client, const Options& options, unsigned int& seed)
+{
+    DomainChanges result;
+    client.getDomainsChangedSince(result, 0, DomainFields::RESOURCES);
+    return OK;
+}
+
+static Outcome getDomainInfo(AimClient& client, const Options& options, unsigned int& seed)
+{
+    DomainInfo result;
+    client.getDomainInfo(result, anyDomain(seed));
+    return OK;
+}
+
+static Outcome existDomain(AimClient& client, const Options& options, unsigned int& seed)
+{
+    return client.existDomain(anyDomain(seed)) ? OK : FAILED;
+}
+
+static Outcome pauseResume(AimClient& client, const Options& options, unsigned int& seed)
+{
+    const string& domain = anyDomain(seed);
+    client.pause(domain);
+    client.resume(domain);
+    return OK;
+}
+
+static Outcome getNodeInfo(AimClient& client, const Options& options, unsigned int& seed)
+{
+    NodeInfo result;
+    client.getNodeInfo(result);
+    return OK;
+}
+
+static Outcome getDatastores(AimClient& client, const Options& options, unsigned int& seed)
+{
+    vector<Datastore> result;
+    client.getDatastores(result);
+    return OK;
+}
+
+static Outcome getDiskFileSize(AimClient& client, const Options& options, unsigned int& seed)
+{
+    return client.getDiskFileSize(options.file) >= 0 ? OK : FAILED;
+}
+
+static Outcome readChunk(AimClient& client, const Options& options, unsigned int& seed)
+{
+    FileChunk chunk;
+    client.readChunk(chunk, options.file, 0, DEFAULT_CHUNK_SIZE, false);
+    return OK;
+}
+
+static Outcome getServerStats(AimClient& client, const Options& options, unsigned int& seed)
+{
+    ServerStats result;
+    client.getServerStats(result);
+    return OK;
+}
+
+static const char* names[] = { "getDomains", "getDomainsLite", "getDomainsChangedSince", "getDomainInfo",
+    "existDomain", "pauseResume", "getNodeInfo", "getDatastores", "getDiskFileSize", "readChunk", "getServerStats",
+    NULL };
+
+static Call calls[] = { getDomains, getDomainsLite, getDomainsChangedSince, getDomainInfo, existDomain, pauseResume,
+    getNodeInfo, getDatastores, getDiskFileSize, readChunk, getServerStats };
+
+// Parse a list of method:weight pairs. Returns the method of each slot of a 100 slot table
+static bool parseMix(const string& mix, vector<int>& _return)
+{
+    vector<pair<int, int> > weights;
+    int total = 0;
+
+    size_t start = 0;
+    while (start < mix.size())
+    {
+        size_t end = mix.find(',', start);
+        end = (end == string::npos ? mix.size() : end);
+
+        string entry = mix.substr(start, end - start);
+        size_t colon = entry.find(':');
+        string method = entry.substr(0, colon);
+        int weight = (colon == string::npos ? 1 : atoi(entry.substr(colon + 1).c_str()));
+
+        int i = 0;
+        while (names[i] != NULL && method != names[i])
+        {
+            i++;
+        }
+
+        if (names[i] == NULL || weight <= 0)
+        {
+            fprintf(stderr, "Invalid mix entry '%s'\n", entry.c_str());
+            return false;
+        }
+
+        weights.push_back(make_pair(i, weight));
+        total += weight;
+        start = end + 1;
+    }
+
+    for (vector<pair<int, int> >::const_iterator it = weights.begin(); it != weights.end(); ++it)
+    {
+        int slots = (it->second * 100 + total - 1) / total;
+        _return.insert(_return.end(), slots, it->first);
+    }
+
+    return !_return.empty();
+}
+
+static boost::shared_ptr<AimClient> connect(const Options& options, boost::shared_ptr<TTransport>& transport)
+{
+    boost::shared_ptr<TSocket> socket(new TSocket(options.host, options.port));
+    transport.reset(new TFramedTransport(socket));
+
+    boost::shared_ptr<TProtocol> protocol;
+    if (options.compact)
+    {
+        protocol.reset(new TCompactProtocol(transport));
+    }
+    else
+    {
+        protocol.reset(new TBinaryProtocol(transport));
+    }
+
+    transport->open();
+    return boost::shared_ptr<AimClient>(new AimClient(protocol));
+}
+
+static void load(const Options& options, const vector<int>& mix, unsigned int seed, ptime end,
+        vector<Sample>& samples)
+{
+    boost::shared_ptr<TTransport> transport;
+    boost::shared_ptr<AimClient> client;
+
+    try
+    {
+        client = connect(options, transport);
+    }
+    catch (TException& e)
+    {
+        fprintf(stderr, "Unable to connect: %s\n", e.what());
+        return;
+    }
+
+    while (microsec_clock::universal_time() < end)
+    {
+        Sample sample;
+        sample.method = mix[rand_r(&seed) % mix.size()];
+
+        ptime start = microsec_clock::universal_time();
+
+        try
+        {
+            sample.outcome = calls[sample.method](*client, options, seed);
+        }
+        catch (OverloadException& e)
+        {
+            sample.outcome = SHED;
+        }
+        catch (TimeoutException& e)
+        {
+            sample.outcome = SHED;
+        }
+        catch (TTransportException& e)
+        {
+            fprintf(stderr, "Connection lost: %s\n", e.what());
+            return;
+        }
+        catch (TException& e)
+        {
+            sample.outcome = FAILED;
+        }
+
+        sample.micros = (microsec_clock::universal_time() - start).total_microseconds();
+        samples.push_back(sample);
+    }
+
+    transport->close();
+}
+
+static double percentile(const vector<uint32_t>& sorted, int percent)
+{
+    size_t index = (sorted.size() * percent + 99) / 100;
+    return sorted[index > 0 ? index - 1 : 0] / 1000.0;
+}
+
+static void report(const char* method, vector<uint32_t>& micros, int failed, int shed, double seconds)
+{
+    if (micros.empty())
+    {
+        return;
+    }
+
+    sort(micros.begin(), micros.end());
+
+    printf("%-24s %9lu %7d %7d %10.1f %9.2f %9.2f %9.2f %9.2f\n", method, (unsigned long) micros.size(), failed,
+            shed, micros.size() / seconds, percentile(micros, 50), percentile(micros, 90), percentile(micros, 99),
+            micros.back() / 1000.0);
+}
+
+static void printUsage(const char* program)
+{
+    printf("Usage: %s options\n", program);
+    printf( "    -h --help                       Show this help\n"
+            "    -H --host=<host>                AIM host (localhost)\n"
+            "    -p --port=<port>                AIM port (60606)\n"
+            "    -t --threads=<n>                Client threads, each with its own connection (8)\n"
+            "    -d --duration=<seconds>         Time to send requests for (10)\n"
+            "    -m --mix=<method:weight,...>    Methods to call and their weights\n"
+            "    -f --file=<path>                Datastore file for getDiskFileSize and readChunk\n"
+            "    -c --compact                    Use the compact protocol\n\n");
+
+    printf("Methods:");
+    for (int i = 0; names[i] != NULL; i++)
+    {
+        printf(" %s", names[i]);
+    }
+    printf("\nDefault mix: %s\n", DEFAULT_MIX);
+}
+
+int main(int argc, char** argv)
+{
+    const struct option longOptions[] = {
+        { "help", 0, NULL, 'h' },
+        { "host", 1, NULL, 'H' },
+        { "port", 1, NULL, 'p' },
+        { "threads", 1, NULL, 't' },
+        { "duration", 1, NULL, 'd' },
+        { "mix", 1, NULL, 'm' },
+        { "file", 1, NULL, 'f' },
+        { "compact", 0, NULL, 'c' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    Options options;
+    options.host = DEFAULT_HOST;
+    options.port = DEFAULT_PORT;
+    options.threads = DEFAULT_THREADS;
+    options.seconds = DEFAULT_SECONDS;
+    options.compact = false;
+    options.mix = DEFAULT_MIX;
+
+    int next;
+    while ((next = getopt_long(argc, argv, "hH:p:t:d:m:f:c", longOptions, NULL)) != -1)
+    {
+        switch (next)
+        {
+            case 'H': options.host = optarg; break;
+            case 'p': options.port = atoi(optarg); break;
+            case 't': options.threads = atoi(optarg); break;
+            case 'd': options.seconds = atoi(optarg); break;
+            case 'm': options.mix = optarg; break;
+            case 'f': options.file = optarg; break;
+            case 'c': options.compact = true; break;
+
+            case 'h':
+                printUsage(argv[0]);
+                return EXIT_SUCCESS;
+
+            default:
+                printUsage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    vector<int> mix;
+    if (options.threads <= 0 || options.seconds <= 0 || !parseMix(options.mix, mix))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (options.file.empty() && (options.mix.find("readChunk") != string::npos ||
+            options.mix.find("getDiskFileSize") != string::npos))
+    {
+        fprintf(stderr, "getDiskFileSize and readChunk need a datastore file (--file)\n");
+        return EXIT_FAILURE;
+    }
+
+    // Domain names used as arguments, the test driver defines a single one
+    try
+    {
+        boost::shared_ptr<TTransport> transport;
+        boost::shared_ptr<AimClient> client = connect(options, transport);
+
+        vector<DomainInfo> list;
+        client->getDomainsLite(list);
+        transport->close();
+
+        for (vector<DomainInfo>::const_iterator it = list.begin(); it != list.end(); ++it)
+        {
+            domains.push_back(it->name);
+        }
+    }
+    catch (TException& e)
+    {
+        fprintf(stderr, "Unable to list the domains at %s:%d: %s\n", options.host.c_str(), options.port, e.what());
+        return EXIT_FAILURE;
+    }
+
+    if (domains.empty())
+    {
+        domains.push_back("test");
+    }
+
+    printf("%d threads, %d seconds, %s protocol, %lu domains\nMix: %s\n\n", options.threads, options.seconds,
+            options.compact ? "compact" : "binary", (unsigned long) domains.size(), options.mix.c_str());
+
+    // Each thread keeps its own samples, merged once they are done
+    vector<vector<Sample> > samples(options.threads);
+    boost::thread_group threads;
+
+    ptime start = microsec_clock::universal_time();
+    ptime end = start + seconds(options.seconds);
+
+    for (int i = 0; i < options.threads; i++)
+    {
+        threads.create_thread(boost::bind(load, boost::cref(options), boost::cref(mix), (unsigned int) (i + 1) * 7919,
+                end, boost::ref(samples[i])));
+    }
+    threads.join_all();
+
+    double elapsed = (microsec_clock::universal_time() - start).total_microseconds() / 1000000.0;
+
+    map<int, vector<uint32_t> > micros;
+    map<int, int> failed;
+    map<int, int> shed;
+    vector<uint32_t> all;
+    int allFailed = 0;
+    int allShed = 0;
+
+    for (vector<vector<Sample> >::const_iterator it = samples.begin(); it != samples.end(); ++it)
+    {
+        for (vector<Sample>::const_iterator sample = it->begin(); sample != it->end(); ++sample)
+        {
+            micros[sample->method].push_back(sample->micros);
+            all.push_back(sample->micros);
+
+            if (sample->outcome == FAILED)
+            {
+                failed[sample->method]++;
+                allFailed++;
+            }
+            else if (sample->outcome == SHED)
+            {
+                shed[sample->method]++;
+                allShed++;
+            }
+        }
+    }
+
+    printf("%-24s %9s %7s %7s %10s %9s %9s %9s %9s\n", "Method", "Calls", "Errors", "Shed", "Calls/s", "p50 (ms)",
+            "p90 (ms)", "p99 (ms)", "Max (ms)");
+
+    for (map<int, vector<uint32_t> >::iterator it = micros.begin(); it != micros.end(); ++it)
+    {
+        report(names[it->first], it->second, failed[it->first], shed[it->first], elapsed);
+    }
+    report("Total", all, allFailed, allShed, elapsed);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,168 @@
+#include <Aim.h>
+#include <CompressedProcessor.h>
+
+#include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/protocol/TCompactProtocol.h>
+#include <thrift/transport/TBufferTransports.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+using namespace ::apache::thrift::protocol;
+using namespace ::apache::thrift::transport;
+using namespace boost::posix_time;
+using namespace std;
+
+/*
+ * Size (plain and compressed) and encoding/decoding time of the results
+ * of some RPCs with each protocol. Usage: protocol-bench [iterations] [domains]
+ */
+
+#define DEFAULT_ITERATIONS  1000
+#define DEFAULT_DOMAINS     100
+
+static string uuid(int i)
+{
+    char buffer[37];
+    snprintf(buffer, sizeof(buffer), "6e1b5ad4-%04x-4c2e-9a1e-%012x", i % 0x10000, i);
+    return buffer;
+}
+
+static string name(int i)
+{
+    char buffer[16];
+    snprintf(buffer, sizeof(buffer), "ABQ_%d", i);
+    return buffer;
+}
+
+static string domainXml(int i)
+{
+    ostringstream xml;
+
+    xml << "<domain type='kvm'><name>" << name(i) << "</name><memory>1048576</memory><vcpu>2</vcpu>"
+        << "<os><type arch='x86_64' machine='pc'>hvm</type><boot dev='hd'/></os>"
+        << "<features><acpi/><apic/><pae/></features><clock offset='utc'/>"
+        << "<devices><emulator>/usr/bin/qemu-kvm</emulator>"
+        << "<disk type='file' device='disk'><driver name='qemu' type='qcow2' cache='none'/>"
+        << "<source file='/var/lib/virt/abq-" << i << "/disk0.qcow2'/><target dev='hda' bus='ide'/></disk>"
+        << "<interface type='bridge'><mac address='52:54:00:00:" << (i / 256) % 100 << ":" << i % 100 << "'/>"
+        << "<source bridge='abiquo_3'/><model type='virtio'/></interface>"
+        << "<graphics type='vnc' port='" << 5900 + i << "' listen='0.0.0.0'/></devices></domain>";
+
+    return xml.str();
+}
+
+template <class T>
+static void measure(const char* method, const char* protocolName, TProtocolFactory& factory, const T& result,
+        int iterations)
+{
+    boost::shared_ptr<TMemoryBuffer> buffer(new TMemoryBuffer());
+    boost::shared_ptr<TProtocol> protocol = factory.getProtocol(buffer);
+
+    ptime start = microsec_clock::universal_time();
+    for (int i = 0; i < iterations; i++)
+    {
+        buffer->resetBuffer();
+        result.write(protocol.get());
+    }
+    double encode = (microsec_clock::universal_time() - start).total_microseconds() / (double) iterations;
+
+    string encoded = buffer->getBufferAsString();
+
+    start = microsec_clock::universal_time();
+    for (int i = 0; i < iterations; i++)
+    {
+        T decoded;
+        buffer->resetBuffer((uint8_t*) encoded.data(), encoded.size());
+        decoded.read(protocol.get());
+    }
+    double decode = (microsec_clock::universal_time() - start).total_microseconds() / (double) iterations;
+
+    // Size on the wire when sent to a client using compression (see CompressedProcessor)
+    uLongf compressed = compressBound(encoded.size());
+    vector<Bytef> deflated(compressed);
+    compress2(&deflated[0], &compressed, (const Bytef*) encoded.data(), encoded.size(), DEFAULT_COMPRESSION_LEVEL);
+
+    printf("%-22s %-8s %12lu %12lu %14.1f %14.1f\n", method, protocolName, (unsigned long) encoded.size(),
+            (unsigned long) compressed, encode, decode);
+}
+
+template <class T>
+static void bench(const char* method, const T& result, int iterations)
+{
+    TBinaryProtocolFactory binary;
+    TCompactProtocolFactory compact;
+
+    measure(method, "binary", binary, result, iterations);
+    measure(method, "compact", compact, result, iterations);
+}
+
+int main(int argc, char** argv)
+{
+    int iterations = argc > 1 ? atoi(argv[1]) : DEFAULT_ITERATIONS;
+    int domains = argc > 2 ? atoi(argv[2]) : DEFAULT_DOMAINS;
+
+    iterations = iterations > 0 ? iterations : DEFAULT_ITERATIONS;
+    domains = domains > 0 ? domains : DEFAULT_DOMAINS;
+
+    Aim_getDomains_result full;
+    Aim_getDomainsLite_result lite;
+    Aim_getDatapoints_result datapoints;
+
+    for (int i = 0; i < domains; i++)
+    {
+        DomainInfo info;
+        info.name = name(i);
+        info.uuid = uuid(i);
+        info.state = DomainState::ON;
+        info.numberVirtCpu = 2;
+        info.memory = 1048576;
+
+        lite.success.push_back(info);
+
+        info.xmlDesc = domainXml(i);
+        full.success.push_back(info);
+    }
+
+    const char* metrics[] = { "cpu_time", "used_mem", "disk_read_bytes", "disk_write_bytes", "if_rx_bytes",
+        "if_tx_bytes", NULL };
+
+    for (int m = 0; metrics[m] != NULL; m++)
+    {
+        Measure series;
+        series.metric = metrics[m];
+        series.dimensions["domain"] = name(0);
+        series.dimensions["uuid"] = uuid(0);
+
+        for (int i = 0; i < 60; i++)
+        {
+            Datapoint datapoint;
+            datapoint.timestamp = 1400000000 + i * 60;
+            datapoint.value = 1000 * i + m;
+            series.datapoints.push_back(datapoint);
+        }
+
+        datapoints.success.push_back(series);
+    }
+
+    full.__isset.success = true;
+    lite.__isset.success = true;
+    datapoints.__isset.success = true;
+
+    printf("%d iterations, %d domains\n\n", iterations, domains);
+    printf("%-22s %-8s %12s %12s %14s %14s\n", "Method", "Protocol", "Bytes", "Zlib bytes", "Encode (us)",
+            "Decode (us)");
+
+    bench("getDomains", full, iterations);
+    bench("getDomainsLite", lite, iterations);
+    bench("getDatapoints", datapoints, iterations);
+
+    return EXIT_SUCCESS;
+}
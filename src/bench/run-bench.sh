@@ -0,0 +1,63 @@
+#!/bin/sh
+
+#
+# Runs aim-bench against an AIM using the libvirt test driver (test:///default)
+# and a synthetic datastore on tmpfs, so no real virtual machines are needed.
+#
+# Usage: bench/run-bench.sh [aim-bench options]   (from src, after make bench)
+#
+
+BENCH_DIR=${BENCH_DIR:-/dev/shm/aim-bench}
+BENCH_PORT=${BENCH_PORT:-60666}
+DISK_SIZE_MB=${DISK_SIZE_MB:-64}
+
+cd `dirname $0`/..
+
+if [ ! -x ./aim ] || [ ! -x ./aim-bench ]; then
+    echo "Build aim and aim-bench first: make bench"
+    exit 1
+fi
+
+# Repository, datastore with a disk and initiator name, all in memory
+mkdir -p $BENCH_DIR/repository $BENCH_DIR/datastore
+dd if=/dev/zero of=$BENCH_DIR/datastore/disk0.raw bs=1M count=$DISK_SIZE_MB 2>/dev/null
+echo "InitiatorName=iqn.2014-01.com.abiquo:bench" >$BENCH_DIR/initiatorname.iscsi
+
+cat >$BENCH_DIR/aim.ini <<CONFIG
+[server]
+port = $BENCH_PORT
+
+[rimp]
+repository = $BENCH_DIR/repository
+datastoreValidTypes = ext2,ext3,ext4,xfs,nfs,tmpfs
+datastorePaths = $BENCH_DIR/datastore
+
+[storage]
+initiatorNameFile = $BENCH_DIR/initiatorname.iscsi
+
+[stats]
+database = $BENCH_DIR/aim.db
+CONFIG
+
+LIBVIRT_DEFAULT_URI=test:///default ./aim -c $BENCH_DIR/aim.ini >$BENCH_DIR/aim.log 2>&1 &
+AIM_PID=$!
+
+# Wait until it is listening
+for i in `seq 1 50`; do
+    grep -q "Aim listening at port" $BENCH_DIR/aim.log && break
+    sleep 0.1
+done
+
+if ! kill -0 $AIM_PID 2>/dev/null; then
+    echo "AIM did not start, see $BENCH_DIR/aim.log"
+    exit 1
+fi
+
+./aim-bench --port=$BENCH_PORT --file=$BENCH_DIR/datastore/disk0.raw "$@"
+RESULT=$?
+
+kill $AIM_PID
+wait $AIM_PID 2>/dev/null
+rm -rf $BENCH_DIR
+
+exit $RESULT